@@ -36,6 +36,8 @@ Supported values:\
 
 ie_option (ENABLE_PROFILING_FIRST_INFERENCE "Build with ITT tracing of first inference time." ON)
 
+ie_dependent_option (ENABLE_FIRST_INFERENCE_REPORT "Record the first inference time tasks by the built-in collector to the OV_FIRST_INFERENCE_REPORT file." OFF "ENABLE_PROFILING_FIRST_INFERENCE" OFF)
+
 ie_option_enum(SELECTIVE_BUILD "Enable OpenVINO conditional compilation or statistics collection. \
 In case SELECTIVE_BUILD is enabled, the SELECTIVE_BUILD_STAT variable should contain the path to the collected InelSEAPI statistics. \
 Usage: -DSELECTIVE_BUILD=ON -DSELECTIVE_BUILD_STAT=/path/*.csv" OFF
@@ -133,6 +133,13 @@ static const char report_folder_message[] = "Optional. Path to a folder where st
 static const char exec_graph_path_message[] =
     "Optional. Path to a file where to store executable graph information serialized.";
 
+// @brief message for report_first_inference option
+static const char report_first_inference_message[] =
+    "Optional. Store the breakdown of the first inference latency (model reading, transformations, graph "
+    "initialization, weights reordering and the first inference) as a flame graph JSON file "
+    "first_inference_report.json in the folder specified by -report_folder. Requires OpenVINO built with "
+    "ENABLE_FIRST_INFERENCE_REPORT.";
+
 // @brief message for progress bar option
 static const char progress_message[] =
     "Optional. Show progress bar (can affect performance measurement). Default values is "
@@ -293,6 +300,9 @@ DEFINE_string(report_folder, "", report_folder_message);
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
+/// @brief Enables the first inference latency breakdown report
+DEFINE_bool(report_first_inference, false, report_first_inference_message);
+
 /// @brief Define flag for showing progress bar <br>
 DEFINE_bool(progress, false, progress_message);
 
@@ -393,6 +403,7 @@ static void show_usage() {
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
+    std::cout << "    -report_first_inference   " << report_first_inference_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
     std::cout << "    -pcseq                    " << pcseq_message << std::endl;
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
@@ -166,6 +166,14 @@ int main(int argc, char* argv[]) {
         /** This vector stores paths to the processed images with input names**/
         auto inputFiles = parse_input_arguments(gflags::GetArgvs());
 
+        // The report has to be requested before the first call to OpenVINO, it's written at the application exit
+        if (FLAGS_report_first_inference) {
+            const auto reportPath =
+                (FLAGS_report_folder.empty() ? "" : FLAGS_report_folder + "/") + "first_inference_report.json";
+            set_environment_variable("OV_FIRST_INFERENCE_REPORT", reportPath);
+            slog::info << "First inference report will be stored to " << reportPath << slog::endl;
+        }
+
         // ----------------- 2. Loading the Inference Engine
         // -----------------------------------------------------------
         next_step();
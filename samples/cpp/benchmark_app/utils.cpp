@@ -5,6 +5,7 @@
 #include <format_reader_ptr.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <map>
 #include <nlohmann/json.hpp>
 #include <regex>
@@ -797,3 +798,11 @@ std::vector<std::string> filter_files_by_extensions(const std::vector<std::strin
     }
     return filtered;
 }
+
+void set_environment_variable(const std::string& name, const std::string& value) {
+#ifdef _WIN32
+    _putenv_s(name.c_str(), value.c_str());
+#else
+    setenv(name.c_str(), value.c_str(), 1);
+#endif
+}
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace openvino {
+namespace itt {
+namespace internal {
+
+/**
+ * @brief Entry points of the first inference report collector
+ * @details The itt library is linked statically into every OpenVINO module, so the collector itself is a part of the
+ * openvino library, which exports these functions (see src/inference/src/itt_collector.hpp). The modules which are
+ * built with ENABLE_FIRST_INFERENCE_REPORT have to link openvino::runtime.
+ */
+
+/// @brief Returns a copy of the task name which lives until the process exit or nullptr if the report isn't requested
+const char* collectorName(const char* name);
+
+void collectorTaskBegin(const char* name);
+
+void collectorTaskEnd();
+
+}  // namespace internal
+}  // namespace itt
+}  // namespace openvino
@@ -5,6 +5,8 @@
 #include <openvino/itt.hpp>
 #include <cstdlib>
 
+#include "collector.hpp"
+
 #ifdef ENABLE_PROFILING_ITT
 #include <ittnotify.h>
 #endif
@@ -37,17 +39,44 @@ void taskBegin(domain_t d, handle_t t) {
                         __itt_null,
                         __itt_null,
                         reinterpret_cast<__itt_string_handle*>(t));
+#ifdef ENABLE_FIRST_INFERENCE_REPORT
+    if (auto name = collectorName(reinterpret_cast<__itt_string_handle*>(t)->strA))
+        collectorTaskBegin(name);
+#endif
 }
 
 void taskEnd(domain_t d) {
     if (!callStackDepth() || --call_stack_depth < callStackDepth())
         __itt_task_end(reinterpret_cast<__itt_domain*>(d));
+#ifdef ENABLE_FIRST_INFERENCE_REPORT
+    collectorTaskEnd();
+#endif
 }
 
 void threadName(const char* name) {
     __itt_thread_set_name(name);
 }
 
+#elif defined(ENABLE_FIRST_INFERENCE_REPORT)
+
+// Without ittnotify the tasks are recorded by the collector only, the handle is the name of the task
+
+domain_t domain(char const *) { return nullptr; }
+
+handle_t handle(char const *name) {
+    return reinterpret_cast<handle_t>(const_cast<char*>(collectorName(name)));
+}
+
+void taskBegin(domain_t, handle_t t) {
+    collectorTaskBegin(t ? reinterpret_cast<const char*>(t) : "");
+}
+
+void taskEnd(domain_t) {
+    collectorTaskEnd();
+}
+
+void threadName(const char *) { }
+
 #else
 
 domain_t domain(char const *) { return nullptr; }
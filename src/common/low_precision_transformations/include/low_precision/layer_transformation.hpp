@@ -5,6 +5,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <list>
 #include <memory>
@@ -232,6 +233,8 @@ inline std::ostream &operator << (std::ostream &os, const DataPrecision& value)
 class LP_TRANSFORMATIONS_API LayerTransformation : public ngraph::pass::MatcherPass {
     static std::vector<ngraph::element::Type> defaultPrecisions;
     static std::mutex defaultPrecisionsMutex;
+    // bit per element type of defaultPrecisions, is read without the mutex
+    static std::atomic<uint64_t> defaultPrecisionsMask;
 
 public:
     class Params {
@@ -309,6 +312,8 @@ public:
 
     static void setDefaultPrecisions(const std::vector<ngraph::element::Type>& precisions);
     static std::vector<ngraph::element::Type> getDefaultPrecisions();
+    // checks the precision without copying of the default precisions and without locking, is used on hot paths
+    static bool isDefaultPrecision(const ngraph::element::Type& precision);
 
 protected:
 #ifdef LPT_PRINT_DEQUANTIZATION_INFO
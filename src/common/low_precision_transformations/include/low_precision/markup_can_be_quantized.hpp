@@ -32,4 +32,6 @@ class ngraph::pass::low_precision::MarkupCanBeQuantized : public ngraph::pass::F
 public:
     NGRAPH_RTTI_DECLARATION;
     bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
+    // marks one node, MarkupOptimizations uses it to share the graph traversal with the other markup passes
+    void markup(const std::shared_ptr<Node>& node);
 };
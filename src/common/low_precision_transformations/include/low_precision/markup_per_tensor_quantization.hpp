@@ -47,6 +47,8 @@ public:
     NGRAPH_RTTI_DECLARATION;
     explicit MarkupPerTensorQuantization(const std::vector<OperationPerTensorQuantizationRestriction>& restrictions = {});
     bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
+    // marks one node, see MarkupCanBeQuantized::markup
+    void markup(const std::shared_ptr<Node>& node);
 
 private:
     std::unordered_map<std::string, PerTensorQuantization> restrictionsByOperation;
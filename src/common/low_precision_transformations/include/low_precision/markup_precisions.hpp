@@ -50,6 +50,8 @@ public:
     NGRAPH_RTTI_DECLARATION;
     explicit MarkupPrecisions(const std::vector<OperationPrecisionRestriction>& restrictions = {});
     bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
+    // marks one node, see MarkupCanBeQuantized::markup
+    void markup(const std::shared_ptr<Node>& node);
 
 private:
     static bool isPrecisionPreserved(const std::shared_ptr<Node>& node);
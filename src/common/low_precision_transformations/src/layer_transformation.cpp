@@ -23,9 +23,20 @@ namespace low_precision {
 
 constexpr char LayerTransformation::originalLayerPostfix[];
 
+namespace {
+uint64_t precisionsMask(const std::vector<ngraph::element::Type>& precisions) {
+    uint64_t mask = 0;
+    for (const auto& precision : precisions) {
+        mask |= 1ull << static_cast<size_t>(static_cast<ngraph::element::Type_t>(precision));
+    }
+    return mask;
+}
+}  // namespace
+
 // order defines default precision
 std::vector<ngraph::element::Type> LayerTransformation::defaultPrecisions = precision_set::int8_support;
 std::mutex LayerTransformation::defaultPrecisionsMutex;
+std::atomic<uint64_t> LayerTransformation::defaultPrecisionsMask{precisionsMask(precision_set::int8_support)};
 
 LayerTransformation::LayerTransformation(const Params& params) :
     updatePrecisions(params.updatePrecisions),
@@ -456,6 +467,7 @@ void LayerTransformation::addPattern(ngraph::pass::GraphRewrite& pass, Transform
 void LayerTransformation::setDefaultPrecisions(const std::vector<ngraph::element::Type>& precisions) {
     std::lock_guard<std::mutex> lock(defaultPrecisionsMutex);
     defaultPrecisions = precisions;
+    defaultPrecisionsMask = precisionsMask(precisions);
 }
 
 std::vector<ngraph::element::Type> LayerTransformation::getDefaultPrecisions() {
@@ -463,6 +475,11 @@ std::vector<ngraph::element::Type> LayerTransformation::getDefaultPrecisions() {
     return defaultPrecisions;
 }
 
+bool LayerTransformation::isDefaultPrecision(const ngraph::element::Type& precision) {
+    return (defaultPrecisionsMask.load(std::memory_order_relaxed) &
+            (1ull << static_cast<size_t>(static_cast<ngraph::element::Type_t>(precision)))) != 0;
+}
+
 }  // namespace low_precision
 }  // namespace pass
 }  // namespace ngraph
@@ -168,20 +168,51 @@ MarkupOptimizations::MarkupOptimizations(
     quantizationRestrictions(quantizationRestrictions) {}
 
 bool ngraph::pass::low_precision::MarkupOptimizations::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
-    ngraph::pass::Manager markup(get_pass_config());
-    markup.set_per_pass_validation(false);
-    markup.register_pass<low_precision::MarkupCanBeQuantized>();
-    if (!precisionRestrictions.empty()) {
-        markup.register_pass<low_precision::MarkupPrecisions>(precisionRestrictions);
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::LPT_LT, "MarkupOptimizations");
+
+    const auto passConfig = get_pass_config();
+
+    // the node markups are independent of each other, so they share one traversal of the ordered operations
+    // instead of sorting the graph per pass
+    std::shared_ptr<low_precision::MarkupCanBeQuantized> canBeQuantized;
+    if (!passConfig->is_disabled<low_precision::MarkupCanBeQuantized>()) {
+        canBeQuantized = std::make_shared<low_precision::MarkupCanBeQuantized>();
+        canBeQuantized->set_pass_config(passConfig);
     }
-    if (!quantizationRestrictions.empty()) {
-        markup.register_pass<low_precision::MarkupPerTensorQuantization>(quantizationRestrictions);
+    std::shared_ptr<low_precision::MarkupPrecisions> precisions;
+    if (!precisionRestrictions.empty() && !passConfig->is_disabled<low_precision::MarkupPrecisions>()) {
+        precisions = std::make_shared<low_precision::MarkupPrecisions>(precisionRestrictions);
+        precisions->set_pass_config(passConfig);
     }
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::AvgPool>(f)) {
+    std::shared_ptr<low_precision::MarkupPerTensorQuantization> perTensorQuantization;
+    if (!quantizationRestrictions.empty() && !passConfig->is_disabled<low_precision::MarkupPerTensorQuantization>()) {
+        perTensorQuantization = std::make_shared<low_precision::MarkupPerTensorQuantization>(quantizationRestrictions);
+        perTensorQuantization->set_pass_config(passConfig);
+    }
+
+    bool hasAvgPool = false;
+    bool hasConcat = false;
+    for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
+        hasAvgPool = hasAvgPool || (std::dynamic_pointer_cast<ngraph::opset1::AvgPool>(node) != nullptr);
+        hasConcat = hasConcat || (std::dynamic_pointer_cast<ngraph::opset1::Concat>(node) != nullptr);
+        if (canBeQuantized) {
+            canBeQuantized->markup(node);
+        }
+        if (precisions) {
+            precisions->markup(node);
+        }
+        if (perTensorQuantization) {
+            perTensorQuantization->markup(node);
+        }
+    }
+
+    ngraph::pass::Manager markup(passConfig);
+    markup.set_per_pass_validation(false);
+    if (hasAvgPool) {
         markup.register_pass<low_precision::MarkupAvgPoolPrecisionPreserved>();
     }
     markup.register_pass<low_precision::PropagatePrecisions>();
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::Concat>(f)) {
+    if (hasConcat) {
         markup.register_pass<low_precision::AlignQuantizationIntervals>();
         markup.register_pass<low_precision::AlignQuantizationParameters>();
     }
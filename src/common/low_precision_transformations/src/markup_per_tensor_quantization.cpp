@@ -29,7 +29,14 @@ ngraph::pass::low_precision::MarkupPerTensorQuantization::MarkupPerTensorQuantiz
 }
 
 bool ngraph::pass::low_precision::MarkupPerTensorQuantization::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
-    auto setRestriction = [](const std::shared_ptr<Node>& node, const std::vector<size_t>& restrictedPorts) {
+    for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
+        markup(node);
+    }
+    return true;
+}
+
+void ngraph::pass::low_precision::MarkupPerTensorQuantization::markup(const std::shared_ptr<Node>& node) {
+    auto setRestriction = [](const std::shared_ptr<Node>& layer, const std::vector<size_t>& restrictedPorts) {
         auto createAttribute = [](Input<Node>& input){
             auto &rt = input.get_rt_info();
             rt.emplace(
@@ -39,47 +46,44 @@ bool ngraph::pass::low_precision::MarkupPerTensorQuantization::run_on_model(cons
 
         if (restrictedPorts.empty()) {
             // markup all ports
-            for (size_t item = 0ul; item < node->get_input_size(); item++) {
-                Input<Node> input = node->input(item);
+            for (size_t item = 0ul; item < layer->get_input_size(); item++) {
+                Input<Node> input = layer->input(item);
                 createAttribute(input);
             }
         } else {
             // markup specific ports
             for (const size_t item : restrictedPorts) {
-                Input<Node> input = node->input(item);
+                Input<Node> input = layer->input(item);
                 createAttribute(input);
             }
         }
     };
 
-    for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
-        if (node->get_input_size() == 0) {
-            continue;
-        }
-
-        const auto typeIt = restrictionsByOperation.find(node->get_type_info().name);
-        if (typeIt == restrictionsByOperation.end()) {
-            continue;
-        }
+    if (node->get_input_size() == 0) {
+        return;
+    }
 
-        const auto& restriction = typeIt->second;
-        if (restriction.portsByVersion.empty()) {
-            continue;
-        }
+    const auto typeIt = restrictionsByOperation.find(node->get_type_info().name);
+    if (typeIt == restrictionsByOperation.end()) {
+        return;
+    }
 
-        if (restriction.versionIsRequired) {
-            const auto it2 = restriction.portsByVersion.find(node->get_type_info().version);
-            if (it2 == restriction.portsByVersion.end()) {
-                continue;
-            }
+    const auto& restriction = typeIt->second;
+    if (restriction.portsByVersion.empty()) {
+        return;
+    }
 
-            const std::vector<size_t>& restrictedPorts = it2->second;
-            setRestriction(node, restrictedPorts);
-        } else {
-            assert(restriction.portsByVersion.size() == 1ul);
-            const std::vector<size_t>& restrictedPorts = restriction.portsByVersion.begin()->second;
-            setRestriction(node, restrictedPorts);
+    if (restriction.versionIsRequired) {
+        const auto it2 = restriction.portsByVersion.find(node->get_type_info().version);
+        if (it2 == restriction.portsByVersion.end()) {
+            return;
         }
+
+        const std::vector<size_t>& restrictedPorts = it2->second;
+        setRestriction(node, restrictedPorts);
+    } else {
+        assert(restriction.portsByVersion.size() == 1ul);
+        const std::vector<size_t>& restrictedPorts = restriction.portsByVersion.begin()->second;
+        setRestriction(node, restrictedPorts);
     }
-    return true;
 }
@@ -1310,6 +1310,12 @@ FakeQuantizeDequantization NetworkHelper::getDequantization(const std::shared_pt
     };
 
     Output<Node> dataNode = inPlace ? std::const_pointer_cast<Node>(node)->output(0) : node->input_value(parentIndex);
+    // most of the lookups find no dequantization operations, they return without the shared pointers casts
+    const Node* dataNodePtr = dataNode.get_node();
+    if (!ov::is_type<opset1::Multiply>(dataNodePtr) && !ov::is_type<opset1::Subtract>(dataNodePtr) &&
+        !ov::is_type<opset1::Convert>(dataNodePtr)) {
+        return FakeQuantizeDequantization(dataNode, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+    }
 
     const std::shared_ptr<ngraph::opset1::Multiply> multiply = ov::as_type_ptr<ngraph::opset1::Multiply>(dataNode.get_node_shared_ptr());
     std::shared_ptr<opset1::Constant> multiplyConstant;
@@ -1342,12 +1348,10 @@ FakeQuantizeDequantization NetworkHelper::getDequantization(const std::shared_pt
 
     const std::shared_ptr<opset1::Convert> convert = ov::as_type_ptr<opset1::Convert>(dataNode.get_node_shared_ptr());
     if (convert != nullptr) {
-        auto defaultPrecisions = LayerTransformation::getDefaultPrecisions();
-        auto el_type = convert->input(0).get_element_type();
-        auto foundIt = std::find(defaultPrecisions.begin(), defaultPrecisions.end(), el_type);
-        if (foundIt == defaultPrecisions.end() &&
-            el_type != element::i4  && el_type != element::u4 &&
-            el_type != element::f32 && el_type != element::f16) {
+        const auto& el_type = convert->input(0).get_element_type();
+        if (el_type != element::i4  && el_type != element::u4 &&
+            el_type != element::f32 && el_type != element::f16 &&
+            !LayerTransformation::isDefaultPrecision(el_type)) {
             return FakeQuantizeDequantization(dataNode, nullptr, subtract, subtractConvert, subtractConstant, multiply, multiplyConstant);
         }
         dataNode = convert->get_input_source_output(0);
@@ -25,7 +25,7 @@ class Pruning;
 
 /**
  * @ingroup ie_transformation_common_api
- * @brief Initialising masks for pruned operations
+ * @brief Initialising masks for pruned operations (Convolution and fully connected MatMul weights)
  */
 class ngraph::pass::InitMasks : public ngraph::pass::GraphRewrite {
 public:
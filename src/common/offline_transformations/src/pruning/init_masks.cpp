@@ -16,6 +16,7 @@ namespace pass {
 namespace init_masks {
 
 class InitConvMask;
+class InitMatMulMask;
 
 } // namespace init_masks
 } // namespace pass
@@ -57,8 +58,53 @@ public:
     }
 };
 
+class ngraph::pass::init_masks::InitMatMulMask : public MatcherPass {
+public:
+    InitMatMulMask() {
+        auto a = pattern::any_input();
+        auto b = pattern::any_input();
+        auto matmul = pattern::wrap_type<opset6::MatMul>({a, b});
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_output = pattern_map.at(matmul);
+            auto matmul_node = std::dynamic_pointer_cast<opset6::MatMul>(m_output.get_node_shared_ptr());
+            if (!matmul_node) return false;
+
+            // Initializing weights mask:
+            // 1. Looking for Const node with weights. Only precision conversions are allowed on the weights path
+            // as any other operation may change the meaning of the weights dimensions.
+            auto cur_node = matmul_node->get_input_node_shared_ptr(1);
+            while (ngraph::is_type<opset6::Convert>(cur_node)) {
+                cur_node = cur_node->get_input_node_shared_ptr(0);
+            }
+            if (!ngraph::is_type<opset6::Constant>(cur_node)) {
+                NGRAPH_DEBUG << "Can't find Constant weights for MatMul: " <<
+                m_output.get_node()->get_friendly_name() << std::endl;
+                return false;
+            }
+
+            // Fully connected layers only: 2D weights
+            if (cur_node->get_shape().size() != 2) {
+                NGRAPH_DEBUG << "MatMul " << m_output.get_node()->get_friendly_name() << " has "
+                             << cur_node->get_shape().size() << "D weights, only 2D weights can be pruned" << std::endl;
+                return false;
+            }
+
+            // 2. Init mask for Const node
+            const size_t outer_dim = matmul_node->get_transpose_b() ? 0 : 1;
+            InitConstMask({outer_dim}/* check only output neurons dim */).apply(cur_node);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MatMulInitMask");
+        register_matcher(m, callback);
+    }
+};
+
 
 ngraph::pass::InitMasks::InitMasks() {
     add_matcher<init_masks::InitConvMask>();
+    add_matcher<init_masks::InitMatMulMask>();
 }
 
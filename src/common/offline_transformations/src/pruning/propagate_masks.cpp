@@ -10,8 +10,10 @@
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset7.hpp>
 #include <ngraph/log.hpp>
 #include <ngraph/rt_info.hpp>
+#include <ngraph/validation_util.hpp>
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::PropagateMasks, "PropagateMasks", 0);
 
@@ -28,6 +30,10 @@ class Reduce;
 class StopPropagation;
 class FakeQuantize;
 class Concat;
+class MatMul;
+class Reshape;
+class Transpose;
+class MVN;
 
 } // namespace mask_propagation
 } // namespace pass
@@ -42,6 +48,36 @@ static ngraph::Shape broadcast_shape_to_rank(ngraph::Shape shape_to_broadcast, i
     return new_shape;
 }
 
+/* Checks Constant input of elementwise operation on zeros along the potential output channel dims
+ * (for 3/4 dimensional tensors) and along the dims which may be pruned in the other input */
+static void init_eltwise_const_mask(const ngraph::Output<ngraph::Node> & input, const ngraph::Output<ngraph::Node> & other) {
+    if (!ngraph::is_type<ngraph::opset6::Constant>(input.get_node())) return;
+    const auto & shape = input.get_shape();
+    ngraph::AxisSet dims;
+    if (shape.size() >= 3) {
+        dims.insert({0, 1});
+    }
+    if (auto other_mask = ngraph::getMask(other)) {
+        for (size_t dim = 0; dim < other_mask->size(); ++dim) {
+            const auto offset = static_cast<int64_t>(other_mask->size()) - static_cast<int64_t>(shape.size());
+            const auto input_dim = static_cast<int64_t>(dim) - offset;
+            if (input_dim >= 0 && shape[input_dim] > 1 && !other_mask->at(dim).empty()) {
+                dims.insert(input_dim);
+            }
+        }
+    }
+    ngraph::pass::InitConstMask(dims).apply(input.get_node_shared_ptr());
+}
+
+/* Input which can't be pruned lets the masks pass only through its broadcasted (1-size) dimensions */
+static void clean_not_broadcasted_dims(ngraph::Mask * mask, const ngraph::PartialShape & shape) {
+    for (size_t dim = 0; dim < mask->size(); ++dim) {
+        if (shape[dim].is_dynamic() || shape[dim].get_length() != 1) {
+            mask->at(dim).clear();
+        }
+    }
+}
+
 class ngraph::pass::mask_propagation::Convolution : public MatcherPass {
 public:
     Convolution() {
@@ -293,26 +329,46 @@ public:
             // Case when input masks should be united instead of intersection
             bool union_eltwise_type = ngraph::is_type<opset6::Multiply>(m_output.get_node_shared_ptr());
 
-            const auto & input_rank = m_input.get_partial_shape().rank().get_length();
-            const auto & weights_rank = m_weights.get_partial_shape().rank().get_length();
-            // Here assuming that masks can be propagated only through 3/4 dimensional tensors
-            // (since channel dim is necessary)
-            if (weights_rank < 3 || input_rank < 3) return false;
+            if (m_input.get_partial_shape().rank().is_dynamic() || m_weights.get_partial_shape().rank().is_dynamic())
+                return false;
 
-            // In case if first of the inputs is constant
-            InitConstMask({0, 1/* potential output channel dim */}).apply(m_input.get_node_shared_ptr());
+            // Constants are checked on zeros before the propagation
+            init_eltwise_const_mask(m_input, m_weights);
+            init_eltwise_const_mask(m_weights, m_input);
             auto input_mask = getMask(m_input);
-            if (!input_mask) {
-                NGRAPH_DEBUG << "No input mask for: " << m_output.get_node()->get_friendly_name() << std::endl;
+            auto weights_mask = getMask(m_weights);
+            if (!input_mask && !weights_mask) {
+                NGRAPH_DEBUG << "No input masks for: " << m_output.get_node()->get_friendly_name() << std::endl;
                 return false;
             }
 
-            InitConstMask({0, 1}).apply(m_weights.get_node_shared_ptr());
-            auto weights_mask = getMask(m_weights);
-            if (!weights_mask) {
-                NGRAPH_DEBUG << "No weights mask for: " << m_output.get_node()->get_friendly_name() << std::endl;
+            // Non constant input without mask (residual connection from the network input, etc.) can't be pruned.
+            // Its values are unknown, so the pruned values stay zero only after Multiply, and only along the
+            // broadcasted dimensions of that input. Other operations stop the propagation.
+            const auto input_shape = m_input.get_partial_shape();
+            const auto weights_shape = m_weights.get_partial_shape();
+            const bool input_is_fixed = !input_mask;
+            const bool weights_is_fixed = !weights_mask;
+            if ((input_is_fixed || weights_is_fixed) && !union_eltwise_type) {
+                NGRAPH_DEBUG << "Input without mask for: " << m_output.get_node()->get_friendly_name() << std::endl;
                 return false;
             }
+            if (input_is_fixed) {
+                input_mask = std::make_shared<Mask>(input_shape.rank().get_length());
+            }
+            if (weights_is_fixed) {
+                weights_mask = std::make_shared<Mask>(weights_shape.rank().get_length());
+            }
+            if (input_is_fixed || weights_is_fixed) {
+                union_eltwise_type = false;
+            }
+            // Masks of the fixed inputs are kept on the node inputs, as the other masks refer to them
+            if (input_is_fixed) {
+                setMask(m_output.get_node()->input(0), input_mask);
+            }
+            if (weights_is_fixed) {
+                setMask(m_output.get_node()->input(1), weights_mask);
+            }
             auto input_mask_row = input_mask.get();
             auto weights_mask_row = weights_mask.get();
 
@@ -332,19 +388,29 @@ public:
             };
             output_mask->add_callback(out_mask_callback, input_mask);
 
-            input_mask->add_callback([weights_mask_row](Mask::Ptr cur_mask) -> bool {
+            input_mask->add_callback([weights_mask_row, input_is_fixed, input_shape](Mask::Ptr cur_mask) -> bool {
                 cur_mask->copy_value_from_mask_reversed(weights_mask_row);
+                if (input_is_fixed) clean_not_broadcasted_dims(cur_mask.get(), input_shape);
                 return true;
             }, weights_mask);
-            input_mask->add_callback([output_mask_row](Mask::Ptr cur_mask) -> bool {
+            input_mask->add_callback([output_mask_row, input_is_fixed, input_shape](Mask::Ptr cur_mask) -> bool {
                 cur_mask->copy_value_from_mask_reversed(output_mask_row);
+                if (input_is_fixed) clean_not_broadcasted_dims(cur_mask.get(), input_shape);
                 return true;
             }, output_mask);
-            weights_mask->add_callback([input_mask_row](Mask::Ptr cur_mask) -> bool {
+            weights_mask->add_callback([input_mask_row, weights_is_fixed, weights_shape](Mask::Ptr cur_mask) -> bool {
                 cur_mask->copy_value_from_mask_reversed(input_mask_row);
+                if (weights_is_fixed) clean_not_broadcasted_dims(cur_mask.get(), weights_shape);
                 return true;
             }, input_mask);
 
+            // Fixed input takes the values of broadcasted dimensions before the output is merged
+            if (input_is_fixed) {
+                input_mask->apply_callback(weights_mask);
+            }
+            if (weights_is_fixed) {
+                weights_mask->apply_callback(input_mask);
+            }
             output_mask->apply_callback(input_mask);
             weights_mask->apply_callback(input_mask);
 
@@ -564,6 +630,376 @@ public:
     }
 };
 
+class ngraph::pass::mask_propagation::MatMul : public MatcherPass {
+public:
+    MatMul() {
+        auto a = pattern::any_input(pattern::has_static_shape());
+        auto b = pattern::any_input(pattern::has_static_shape());
+        auto matmul = pattern::wrap_type<opset6::MatMul>({a, b}, pattern::has_static_shape());
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_a = pattern_map.at(a);
+            const auto & m_b = pattern_map.at(b);
+            const auto & m_output = pattern_map.at(matmul);
+            auto matmul_node = std::dynamic_pointer_cast<opset6::MatMul>(m_output.get_node_shared_ptr());
+            if (!matmul_node) return false;
+
+            const auto a_shape = m_a.get_shape();
+            const auto b_shape = m_b.get_shape();
+            const auto out_shape = m_output.get_shape();
+            // 1D inputs are unsqueezed inside of MatMul, so their dims can't be mapped to the output dims directly
+            if (a_shape.size() < 2 || b_shape.size() < 2) return false;
+
+            auto a_mask = getMask(m_a);
+            auto b_mask = getMask(m_b);
+            if (!a_mask && !b_mask) {
+                NGRAPH_DEBUG << "No input masks for: " << m_output.get_node()->get_friendly_name() << std::endl;
+                return false;
+            }
+            // Input without mask can't be pruned, so all dims connected with it are kept
+            const bool a_is_fixed = !a_mask;
+            const bool b_is_fixed = !b_mask;
+            if (a_is_fixed) a_mask = std::make_shared<Mask>(a_shape.size());
+            if (b_is_fixed) b_mask = std::make_shared<Mask>(b_shape.size());
+            // Masks of the fixed inputs are kept on the node inputs, as the other masks refer to them
+            if (a_is_fixed) setMask(m_output.get_node()->input(0), a_mask);
+            if (b_is_fixed) setMask(m_output.get_node()->input(1), b_mask);
+
+            const size_t a_rank = a_shape.size();
+            const size_t b_rank = b_shape.size();
+            const size_t out_rank = out_shape.size();
+            const size_t a_rows = matmul_node->get_transpose_a() ? a_rank - 1 : a_rank - 2;
+            const size_t a_inner = matmul_node->get_transpose_a() ? a_rank - 2 : a_rank - 1;
+            const size_t b_inner = matmul_node->get_transpose_b() ? b_rank - 1 : b_rank - 2;
+            const size_t b_cols = matmul_node->get_transpose_b() ? b_rank - 2 : b_rank - 1;
+            const size_t out_rows = out_rank - 2;
+            const size_t out_cols = out_rank - 1;
+
+            // Input batch dim for every output batch dim, -1 for missing and broadcasted dims
+            auto get_batch_dims = [&out_shape, out_rank](const Shape & shape) {
+                std::vector<int64_t> batch_dims(out_rank - 2, -1);
+                const size_t offset = out_rank - shape.size();
+                for (size_t dim = offset; dim < out_rank - 2; ++dim) {
+                    if (shape[dim - offset] == out_shape[dim]) {
+                        batch_dims[dim] = static_cast<int64_t>(dim - offset);
+                    }
+                }
+                return batch_dims;
+            };
+            const auto a_batch_dims = get_batch_dims(a_shape);
+            const auto b_batch_dims = get_batch_dims(b_shape);
+
+            auto a_mask_row = a_mask.get();
+            auto b_mask_row = b_mask.get();
+            auto output_mask = std::make_shared<Mask>(out_rank);
+            auto output_mask_row = output_mask.get();
+
+            auto out_mask_callback = [=](Mask::Ptr cur_mask) -> bool {
+                cur_mask->clean_dim_values();
+                cur_mask->at(out_rows) = a_mask_row->at(a_rows);
+                cur_mask->at(out_cols) = b_mask_row->at(b_cols);
+                // Batch dim value (attention head, for example) is pruned only if it's pruned in both inputs
+                for (size_t dim = 0; dim < out_rank - 2; ++dim) {
+                    const auto a_dim = a_batch_dims[dim];
+                    const auto b_dim = b_batch_dims[dim];
+                    if (a_dim >= 0 && b_dim >= 0) {
+                        for (const auto & value : a_mask_row->at(a_dim)) {
+                            if (b_mask_row->at(b_dim).count(value)) {
+                                cur_mask->at(dim).insert(value);
+                            }
+                        }
+                    } else if (a_dim >= 0) {
+                        cur_mask->at(dim) = a_mask_row->at(a_dim);
+                    } else if (b_dim >= 0) {
+                        cur_mask->at(dim) = b_mask_row->at(b_dim);
+                    }
+                }
+                return true;
+            };
+            output_mask->add_callback(out_mask_callback, a_mask);
+            output_mask->add_callback(out_mask_callback, b_mask);
+
+            auto clean_callback = [](Mask::Ptr cur_mask) -> bool {
+                cur_mask->clean_dim_values();
+                return true;
+            };
+            if (a_is_fixed) {
+                a_mask->add_callback(clean_callback, b_mask);
+                a_mask->add_callback(clean_callback, output_mask);
+            } else {
+                // Reduction dims of both inputs are connected as the input channels of Convolution
+                a_mask->add_callback([b_mask_row, a_inner, b_inner](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(a_inner) = b_mask_row->at(b_inner);
+                    return true;
+                }, b_mask);
+                a_mask->add_callback([output_mask_row, a_rows, out_rows, a_batch_dims](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(a_rows) = output_mask_row->at(out_rows);
+                    for (size_t dim = 0; dim < a_batch_dims.size(); ++dim) {
+                        if (a_batch_dims[dim] >= 0)
+                            cur_mask->at(a_batch_dims[dim]) = output_mask_row->at(dim);
+                    }
+                    return true;
+                }, output_mask);
+            }
+            if (b_is_fixed) {
+                b_mask->add_callback(clean_callback, a_mask);
+                b_mask->add_callback(clean_callback, output_mask);
+            } else {
+                b_mask->add_callback([a_mask_row, a_inner, b_inner](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(b_inner) = a_mask_row->at(a_inner);
+                    return true;
+                }, a_mask);
+                b_mask->add_callback([output_mask_row, b_cols, out_cols, b_batch_dims](Mask::Ptr cur_mask) -> bool {
+                    cur_mask->at(b_cols) = output_mask_row->at(out_cols);
+                    for (size_t dim = 0; dim < b_batch_dims.size(); ++dim) {
+                        if (b_batch_dims[dim] >= 0)
+                            cur_mask->at(b_batch_dims[dim]) = output_mask_row->at(dim);
+                    }
+                    return true;
+                }, output_mask);
+            }
+
+            b_mask->apply_callback(a_mask);
+            output_mask->apply_callback(a_mask);
+
+            setMask(m_output, output_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MatMulMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
+/* Reshape which splits the last dimension into (heads number, head size) dims or merges them back.
+ * Head is pruned only if all its values are pruned. */
+class ngraph::pass::mask_propagation::Reshape : public MatcherPass {
+public:
+    Reshape() {
+        auto input = pattern::any_input(pattern::has_static_shape());
+        auto shape = pattern::wrap_type<opset6::Constant>();
+        auto reshape = pattern::wrap_type<opset6::Reshape>({input, shape}, pattern::has_static_shape());
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_input = pattern_map.at(input);
+            const auto & m_output = pattern_map.at(reshape);
+
+            auto input_mask = getMask(m_input);
+            if (!input_mask) return false;
+
+            const auto & input_shape = m_input.get_shape();
+            const auto & output_shape = m_output.get_shape();
+            size_t prefix = 0;
+            while (prefix < std::min(input_shape.size(), output_shape.size()) &&
+                   input_shape[prefix] == output_shape[prefix]) {
+                ++prefix;
+            }
+            const bool is_split = input_shape.size() == prefix + 1 && output_shape.size() == prefix + 2 &&
+                                  output_shape[prefix] * output_shape[prefix + 1] == input_shape[prefix];
+            const bool is_merge = output_shape.size() == prefix + 1 && input_shape.size() == prefix + 2 &&
+                                  input_shape[prefix] * input_shape[prefix + 1] == output_shape[prefix];
+            if (!is_split && !is_merge) {
+                NGRAPH_DEBUG << "Unsupported Reshape for the mask propagation: "
+                             << m_output.get_node()->get_friendly_name() << std::endl;
+                return false;
+            }
+            const size_t head_size = is_split ? output_shape[prefix + 1] : input_shape[prefix + 1];
+            const size_t heads_count = is_split ? output_shape[prefix] : input_shape[prefix];
+
+            auto heads_from_values = [head_size, heads_count](const std::set<uint64_t> & values) {
+                std::set<uint64_t> heads;
+                for (uint64_t head = 0; head < heads_count; ++head) {
+                    bool is_pruned = true;
+                    for (uint64_t value = head * head_size; value < (head + 1) * head_size && is_pruned; ++value)
+                        is_pruned = values.count(value);
+                    if (is_pruned) heads.insert(head);
+                }
+                return heads;
+            };
+            auto values_from_heads = [head_size](const std::set<uint64_t> & heads) {
+                std::set<uint64_t> values;
+                for (const auto & head : heads)
+                    for (uint64_t value = head * head_size; value < (head + 1) * head_size; ++value)
+                        values.insert(value);
+                return values;
+            };
+
+            auto input_mask_row = input_mask.get();
+            auto output_mask = std::make_shared<Mask>(output_shape.size());
+            auto output_mask_row = output_mask.get();
+
+            output_mask->add_callback([=](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < prefix; ++dim)
+                    cur_mask->at(dim) = input_mask_row->at(dim);
+                if (is_split) {
+                    cur_mask->at(prefix) = heads_from_values(input_mask_row->at(prefix));
+                    cur_mask->at(prefix + 1).clear();
+                } else {
+                    cur_mask->at(prefix) = values_from_heads(input_mask_row->at(prefix));
+                }
+                return true;
+            }, input_mask);
+            input_mask->add_callback([=](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < prefix; ++dim)
+                    cur_mask->at(dim) = output_mask_row->at(dim);
+                if (is_split) {
+                    cur_mask->at(prefix) = values_from_heads(output_mask_row->at(prefix));
+                } else {
+                    cur_mask->at(prefix) = heads_from_values(output_mask_row->at(prefix));
+                    cur_mask->at(prefix + 1).clear();
+                }
+                return true;
+            }, output_mask);
+
+            // Target shape is shrunk together with the output, so it shouldn't be shared with other nodes
+            auto shape_const = std::dynamic_pointer_cast<opset6::Constant>(pattern_map.at(shape).get_node_shared_ptr());
+            if (shape_const->get_output_target_inputs(0).size() > 1) {
+                auto new_shape_const = shape_const->clone_with_new_inputs({});
+                copy_runtime_info(shape_const, new_shape_const);
+                m_output.get_node()->input(1).replace_source_output(new_shape_const);
+                shape_const = std::dynamic_pointer_cast<opset6::Constant>(new_shape_const);
+            }
+            const auto shape_values = shape_const->cast_vector<int64_t>();
+            auto shape_mask = std::make_shared<Mask>(shape_values.size());
+            shape_mask->set_shape_like(true);
+            shape_mask->add_callback([output_mask_row, shape_values](Mask::Ptr cur_mask) -> bool {
+                // Special values (0 and -1) are calculated by Reshape itself
+                for (size_t dim = 0; dim < cur_mask->size(); ++dim) {
+                    if (shape_values[dim] > 0)
+                        cur_mask->at(dim) = output_mask_row->at(dim);
+                    else
+                        cur_mask->at(dim).clear();
+                }
+                return true;
+            }, output_mask);
+            output_mask->add_callback([](Mask::Ptr cur_mask) -> bool {
+                return true;
+            }, shape_mask);
+            setMask(shape_const->output(0), shape_mask);
+
+            output_mask->apply_callback(input_mask);
+            setMask(m_output, output_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(reshape, "ReshapeMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
+class ngraph::pass::mask_propagation::Transpose : public MatcherPass {
+public:
+    Transpose() {
+        auto input = pattern::any_input(pattern::has_static_rank());
+        auto order = pattern::wrap_type<opset6::Constant>();
+        auto transpose = pattern::wrap_type<opset6::Transpose>({input, order});
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_input = pattern_map.at(input);
+            const auto & m_output = pattern_map.at(transpose);
+
+            auto input_mask = getMask(m_input);
+            if (!input_mask) return false;
+
+            const auto rank = static_cast<int64_t>(m_input.get_partial_shape().rank().get_length());
+            const auto order_const = std::dynamic_pointer_cast<opset6::Constant>(pattern_map.at(order).get_node_shared_ptr());
+            auto order_values = order_const->cast_vector<int64_t>();
+            // Empty order means reversed dims
+            if (order_values.empty()) {
+                for (int64_t dim = rank - 1; dim >= 0; --dim)
+                    order_values.push_back(dim);
+            }
+            if (static_cast<int64_t>(order_values.size()) != rank ||
+                std::any_of(order_values.begin(), order_values.end(), [rank](int64_t dim) { return dim < 0 || dim >= rank; }))
+                return false;
+
+            auto input_mask_row = input_mask.get();
+            auto output_mask = std::make_shared<Mask>(rank);
+            auto output_mask_row = output_mask.get();
+
+            output_mask->add_callback([input_mask_row, order_values](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < order_values.size(); ++dim)
+                    cur_mask->at(dim) = input_mask_row->at(order_values[dim]);
+                return true;
+            }, input_mask);
+            input_mask->add_callback([output_mask_row, order_values](Mask::Ptr cur_mask) -> bool {
+                for (size_t dim = 0; dim < order_values.size(); ++dim)
+                    cur_mask->at(order_values[dim]) = output_mask_row->at(dim);
+                return true;
+            }, output_mask);
+
+            output_mask->apply_callback(input_mask);
+            setMask(m_output, output_mask);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(transpose, "TransposeMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
+class ngraph::pass::mask_propagation::MVN : public MatcherPass {
+public:
+    MVN() {
+        auto mvn = pattern::wrap_type<opset6::MVN, op::v0::MVN>(OutputVector{}, pattern::has_static_rank());
+
+        ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+            const auto & pattern_map = m.get_pattern_value_map();
+            const auto & m_output = pattern_map.at(mvn);
+            const auto & node = m_output.get_node_shared_ptr();
+            const auto & m_input = node->input_value(0);
+
+            const auto rank = m_output.get_partial_shape().rank();
+            AxisSet axes;
+            if (auto mvn_v0 = std::dynamic_pointer_cast<op::v0::MVN>(node)) {
+                axes = mvn_v0->get_reduction_axes();
+            } else {
+                const auto axes_const = get_constant_from_source(node->input_value(1));
+                if (!axes_const) return false;
+                axes = normalize_axes(node->description(), axes_const->cast_vector<int64_t>(), rank);
+            }
+
+            // Normalized dims can't be pruned, masks are propagated through the rest of the dims
+            if (auto input_mask = getMask(m_input)) {
+                auto input_mask_row = input_mask.get();
+                auto output_mask = std::make_shared<Mask>(rank.get_length());
+                auto output_mask_row = output_mask.get();
+
+                output_mask->add_callback([input_mask_row, axes](Mask::Ptr cur_mask) -> bool {
+                    for (size_t dim = 0; dim < cur_mask->size(); ++dim) {
+                        if (axes.count(dim))
+                            cur_mask->at(dim).clear();
+                        else
+                            cur_mask->at(dim) = input_mask_row->at(dim);
+                    }
+                    return true;
+                }, input_mask);
+                input_mask->add_callback([output_mask_row, axes](Mask::Ptr cur_mask) -> bool {
+                    for (size_t dim = 0; dim < cur_mask->size(); ++dim) {
+                        if (axes.count(dim))
+                            cur_mask->at(dim).clear();
+                        else
+                            cur_mask->at(dim) = output_mask_row->at(dim);
+                    }
+                    return true;
+                }, output_mask);
+
+                // Invalidate normalized dims of the parent masks
+                output_mask->apply_callback(input_mask);
+                setMask(m_output, output_mask);
+            }
+
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(mvn, "MVNMaskPropagation");
+        register_matcher(m, callback);
+    }
+};
+
 class ngraph::pass::mask_propagation::PassThrough : public MatcherPass {
 public:
     PassThrough() {
@@ -571,7 +1007,7 @@ public:
                                            opset6::Elu, opset6::HardSigmoid, opset6::PRelu, opset6::Mish,
                                            opset6::Softmax, opset6::SoftPlus, opset6::Convert, opset6::ConvertLike,
                                            opset6::AvgPool, opset6::MaxPool, opset6::ROIPooling, opset6::PSROIPooling,
-                                           opset6::Pad>();
+                                           opset6::Pad, op::v0::Gelu, opset7::Gelu>();
 
 
         ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -695,5 +1131,9 @@ ngraph::pass::PropagateMasks::PropagateMasks() {
     add_matcher<mask_propagation::Reduce>();
     add_matcher<mask_propagation::FakeQuantize>();
     add_matcher<mask_propagation::Concat>();
+    add_matcher<mask_propagation::MatMul>();
+    add_matcher<mask_propagation::Reshape>();
+    add_matcher<mask_propagation::Transpose>();
+    add_matcher<mask_propagation::MVN>();
     add_matcher<mask_propagation::StopPropagation>();
 }
@@ -16,7 +16,7 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::Pruning, "Pruning", 0);
 bool ngraph::pass::Pruning::run_on_model(const std::shared_ptr<Function>& f) {
     Manager manager(get_pass_config());
 
-    // Initialize masks only for Convolutions/GroupConvolutions weights (needed to init mask in source Constant of
+    // Initialize masks only for Convolutions/GroupConvolutions/MatMuls weights (needed to init mask in source Constant of
     // weights-calculating subgraph). For other node types masks initialized in PropagateMasks pass.
     manager.register_pass<InitMasks>();
     manager.register_pass<PropagateMasks>();
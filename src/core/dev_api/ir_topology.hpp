@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace ov {
+namespace ir_topology {
+
+/// \brief Layout of the optional binary topology section of the IR.
+///
+/// The section is appended to the end of the weights (.bin) file after all constants, so readers which are not aware
+/// of it ignore it. It is closed by the Footer below, which also binds the section to the exact .xml file written
+/// together with it: if the .xml was edited afterwards, the section is ignored and the model is read from the .xml.
+///
+/// All values are stored in the native byte order. Strings are stored once in the string table and referenced by
+/// index. Payload:
+///   uint32 format_version, int64 ir_version
+///   uint32 string count, {uint32 length, chars}...
+///   uint32 model name
+///   uint32 layer count, {layer}...
+///   uint32 edge count, {uint32 from_layer, uint32 from_output, uint32 to_layer, uint32 to_input}...
+/// Layer:
+///   uint32 id, uint32 name, uint32 type, uint32 version
+///   uint32 input count, {rt_info}...
+///   uint32 output count, {uint8 element type, shape, uint32 names count, {uint32 name}..., rt_info}...
+///   uint32 attribute count, {attribute}...
+///   rt_info
+/// Attribute: uint32 name, uint8 AttributeKind, value
+/// rt_info: uint32 count, {uint32 name, uint32 version, uint32 attribute count, {attribute}...}...
+/// Shape: int64 rank (-1 for dynamic rank), {int64 min, int64 max (-1 for unbounded)}...
+/// Edges refer to layer ids and to the real indices of the outputs and inputs.
+constexpr uint32_t format_version = 1;
+
+struct Footer {
+    char magic[8];
+    uint64_t offset;    // beginning of the section in the weights
+    uint64_t size;      // size of the section without the footer
+    uint64_t xml_size;  // size of the .xml file written together with the section
+    uint64_t xml_hash;  // hash() of the .xml file content
+};
+
+enum class AttributeKind : uint8_t {
+    BOOL = 0,            // uint8
+    STRING = 1,          // uint32 string
+    INT64 = 2,           // int64
+    DOUBLE = 3,          // double
+    VEC_INT32 = 4,       // uint32 count, int32...
+    VEC_INT64 = 5,       // uint32 count, int64...
+    VEC_UINT64 = 6,      // uint32 count, uint64...
+    VEC_FLOAT = 7,       // uint32 count, float...
+    VEC_STRING = 8,      // uint32 count, uint32 string...
+    CONST_DATA = 9,      // uint64 offset, uint64 size in the weights
+    PARTIAL_SHAPE = 10,  // shape
+    DIMENSION = 11,      // int64 min, int64 max
+    VARIABLE = 12,       // uint32 variable id string
+    ELEMENT_TYPES = 13   // uint32 count, uint8 element type...
+};
+
+inline void set_magic(Footer& footer) {
+    std::memcpy(footer.magic, "OVTOPO01", sizeof(footer.magic));
+}
+
+inline bool check_magic(const Footer& footer) {
+    return std::memcmp(footer.magic, "OVTOPO01", sizeof(footer.magic)) == 0;
+}
+
+/// \brief Fast non-cryptographic hash used to bind the section to the .xml content
+inline uint64_t hash(const char* data, size_t size) {
+    uint64_t seed = size;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        seed = (seed ^ word) * 0x100000001b3ULL;
+        seed ^= seed >> 29;
+    }
+    for (; i < size; ++i) {
+        seed = (seed ^ static_cast<uint8_t>(data[i])) * 0x100000001b3ULL;
+    }
+    return seed;
+}
+
+/// \brief Looks for the section at the end of the weights
+/// \return true and fills the footer if the weights contain a consistent section
+inline bool find_footer(const char* weights, size_t weights_size, Footer& footer) {
+    if (weights == nullptr || weights_size < sizeof(Footer))
+        return false;
+    std::memcpy(&footer, weights + weights_size - sizeof(Footer), sizeof(Footer));
+    return check_magic(footer) && footer.offset <= weights_size - sizeof(Footer) &&
+           footer.size == weights_size - sizeof(Footer) - footer.offset;
+}
+
+}  // namespace ir_topology
+}  // namespace ov
@@ -17,6 +17,11 @@ namespace pass {
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+    ConstantFolding() = default;
+    /// \param max_folded_size The nodes whose outputs would take more than max_folded_size bytes
+    ///                        are not folded, so e.g. decompression of weights can stay in the runtime.
+    ///                        0 means no limit.
+    explicit ConstantFolding(size_t max_folded_size) : m_max_folded_size(max_folded_size) {}
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
 
 private:
@@ -24,6 +29,10 @@ private:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& f);
+    /// \brief Checks that the outputs of the node fit into the max_folded_size budget
+    bool fits_folded_size(const Node* node) const;
+
+    size_t m_max_folded_size = 0;
 };
 
 OPENVINO_API void disable_constant_folding(const std::shared_ptr<Node>& node);
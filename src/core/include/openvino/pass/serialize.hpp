@@ -38,14 +38,22 @@ public:
               std::ostream& binFile,
               std::map<std::string, ngraph::OpSet> custom_opsets,
               Version version = Version::UNSPECIFIED);
-    Serialize(std::ostream& xmlFile, std::ostream& binFile, Version version = Version::UNSPECIFIED);
+    /// \param binary_topology Append a binary copy of the topology to the end of the weights. The IR frontend
+    /// builds the model from it without parsing the .xml, the .xml stays a complete IR for all other readers.
+    Serialize(std::ostream& xmlFile,
+              std::ostream& binFile,
+              Version version = Version::UNSPECIFIED,
+              bool binary_topology = false);
 
     OPENVINO_DEPRECATED("This constructor is deprecated. Please use new extension API")
     Serialize(const std::string& xmlPath,
               const std::string& binPath,
               std::map<std::string, ngraph::OpSet> custom_opsets,
               Version version = Version::UNSPECIFIED);
-    Serialize(const std::string& xmlPath, const std::string& binPath, Version version = Version::UNSPECIFIED);
+    Serialize(const std::string& xmlPath,
+              const std::string& binPath,
+              Version version = Version::UNSPECIFIED,
+              bool binary_topology = false);
 
 private:
     std::ostream* m_xmlFile;
@@ -54,6 +62,7 @@ private:
     const std::string m_binPath;
     const Version m_version;
     const std::map<std::string, ngraph::OpSet> m_custom_opsets;
+    bool m_binary_topology = false;
 };
 
 /**
@@ -4,6 +4,7 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <limits>
 #include <ngraph/op/constant.hpp>
 
 #include "ngraph/op/util/sub_graph_base.hpp"
@@ -12,6 +13,24 @@
 
 using namespace std;
 
+namespace {
+size_t get_outputs_size(const ov::Node* node) {
+    size_t size = 0;
+    for (const auto& output : node->outputs()) {
+        const auto& shape = output.get_partial_shape();
+        const auto& type = output.get_element_type();
+        if (shape.is_dynamic() || type.is_dynamic())
+            return std::numeric_limits<size_t>::max();
+        size += (ov::shape_size(shape.to_shape()) * type.bitwidth() + 7) / 8;
+    }
+    return size;
+}
+}  // namespace
+
+bool ov::pass::ConstantFolding::fits_folded_size(const Node* node) const {
+    return m_max_folded_size == 0 || get_outputs_size(node) <= m_max_folded_size;
+}
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f) {
     bool rewritten = pre_calculated_values_folding(f);
 
@@ -21,7 +40,8 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f
         }
 
         OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values())) {
+        const bool folded = fits_folded_size(node.get()) && node->constant_fold(replacements, node->input_values());
+        if (folded) {
             NGRAPH_CHECK(replacements.size() == node->get_output_size(),
                          "constant_fold_default returned incorrect number of replacements for ",
                          node);
@@ -95,7 +115,8 @@ bool ngraph::pass::ConstantFolding::pre_calculated_values_folding(const std::sha
                 }
             }
 
-            if (status && input_value.get_tensor().has_and_set_bound()) {
+            if (status && input_value.get_tensor().has_and_set_bound() &&
+                fits_folded_size(input_value.get_node())) {
                 auto input_node = input_value.get_node_shared_ptr();
                 auto replacement = std::make_shared<ngraph::op::Constant>(input_value.get_tensor().get_lower_value());
                 if (replacement && !ov::is_type<ngraph::op::Constant>(input_node)) {
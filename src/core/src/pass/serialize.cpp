@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "ir_topology.hpp"
 #include "itt.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset.hpp"
@@ -60,63 +61,132 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
-size_t hash_combine(const void* v, int64_t size) {
-    constexpr auto cel_size = sizeof(size_t);
-    auto seed = static_cast<size_t>(size);
-    const auto data = static_cast<const size_t*>(v);
-    const auto d_end = std::next(data, size / cel_size);
-    // The constant value used as a magic number has been
-    // traditionally used e.g. in boost library's hash_combine.
-    // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
-    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
+// Constants smaller than this are copied to the staging buffer, the larger ones are written directly
+constexpr size_t write_block_size = 4 << 20;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
 }
 
+// 64-bit hash of the constant data with xxHash64 structure: four independent lanes consume 32 bytes per
+// iteration, so the loop is limited by the memory bandwidth instead of the multiplication latency.
+uint64_t hash_constant(const void* v, size_t size) {
+    constexpr uint64_t p1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t p2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t p3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t p4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr uint64_t p5 = 0x27D4EB2F165667C5ULL;
+    const auto round = [](uint64_t acc, uint64_t input) {
+        return rotl(acc + input * p2, 31) * p1;
+    };
+    const auto merge = [&](uint64_t acc, uint64_t lane) {
+        return (acc ^ round(0, lane)) * p1 + p4;
+    };
+    const auto read = [](const char* ptr) {
+        uint64_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    };
+
+    const char* data = static_cast<const char*>(v);
+    const char* const end = data + size;
+    uint64_t hash;
+    if (size >= 32) {
+        uint64_t lanes[4] = {p1 + p2, p2, 0, 0 - p1};
+        for (; end - data >= 32; data += 32) {
+            for (size_t i = 0; i < 4; ++i) {
+                lanes[i] = round(lanes[i], read(data + i * 8));
+            }
+        }
+        hash = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+        for (size_t i = 0; i < 4; ++i) {
+            hash = merge(hash, lanes[i]);
+        }
+    } else {
+        hash = p5;
+    }
+    hash += size;
+    for (; end - data >= 8; data += 8) {
+        hash = rotl(hash ^ round(0, read(data)), 27) * p1 + p4;
+    }
+    for (; data < end; ++data) {
+        hash = rotl(hash ^ (static_cast<uint8_t>(*data) * p5), 11) * p1;
+    }
+    hash ^= hash >> 33;
+    hash *= p2;
+    hash ^= hash >> 29;
+    hash *= p3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/**
+ * @brief Writes the constants to the weights stream and deduplicates the equal ones.
+ *
+ * The small constants are gathered into large blocks and the large ones are passed to the stream without copying,
+ * so the stream receives a few large writes. flush() writes the last gathered block.
+ */
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
-    using HashValue = size_t;
+    using HashValue = uint64_t;
     using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data),
-          m_enable_compression(enable_compression),
-          m_blob_offset(bin_data.tellp()) {}
+          m_enable_compression(enable_compression) {}
 
     FilePosition write(const char* ptr, size_t size) {
-        const FilePosition write_pos = m_binary_output.tellp();
-        const auto offset = write_pos - m_blob_offset;
+        const auto offset = m_offset;
         if (!m_enable_compression) {
-            m_binary_output.write(ptr, size);
+            enqueue(ptr, size);
             return offset;
         }
-        // This hash is weak (but efficient) and must be replace with some other
-        // more stable hash algorithm. For example current hash algorithms gives
-        // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
-        // values when finding a match in hash map.
-        const HashValue hash = hash_combine(ptr, size);
+        const HashValue hash = hash_constant(ptr, size);
         const auto found = m_hash_to_file_positions.find(hash);
+        // equal hashes of different data are very unlikely, but still possible
         if (found != end(m_hash_to_file_positions) &&
             memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
             return found->second.first;
         }
 
-        m_binary_output.write(ptr, size);
+        enqueue(ptr, size);
         m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
 
         return offset;
     }
 
+    /// \brief Writes the gathered small constants to the stream
+    void flush() {
+        if (m_staging.empty())
+            return;
+        write_to_stream(m_staging.data(), m_staging.size());
+        m_staging.clear();
+    }
+
 private:
+    void enqueue(const char* ptr, size_t size) {
+        m_offset += size;
+        if (size < write_block_size) {
+            if (m_staging.size() + size > write_block_size)
+                flush();
+            m_staging.insert(m_staging.end(), ptr, ptr + size);
+            return;
+        }
+        flush();
+        write_to_stream(ptr, size);
+    }
+
+    void write_to_stream(const char* ptr, size_t size) {
+        m_binary_output.write(ptr, size);
+        NGRAPH_CHECK(m_binary_output, "Failed to write ", size, " bytes of the constants data");
+    }
+
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
-    FilePosition m_blob_offset;  // blob offset inside output stream
+    FilePosition m_offset = 0;  // offset of the next blob from the beginning of the weights
+    std::vector<char> m_staging;
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -762,24 +832,7 @@ void auto_pad_resolving(ov::Node* node) {
     }
 }
 
-void ngfunction_2_ir(pugi::xml_node& netXml,
-                     const ngraph::Function& f,
-                     const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                     ConstantWriter& constant_node_write_handler,
-                     int64_t version,
-                     bool deterministic) {
-    // If determinism is not required, include auto-generated names into xml
-    if (!deterministic || !is_name_auto_generated(f)) {
-        netXml.append_attribute("name").set_value(f.get_friendly_name().c_str());
-    }
-    netXml.append_attribute("version").set_value(version);
-    pugi::xml_node layers = netXml.append_child("layers");
-
-    const std::unordered_map<ngraph::Node*, int> layer_ids = create_layer_ids(f);
-    std::unordered_set<std::string> unique_names;
-
-    const bool exec_graph = is_exec_graph(f);
-
+std::vector<std::shared_ptr<ov::Node>> get_layers_order(const ngraph::Function& f, int64_t version) {
     auto sorted_ops = f.get_ordered_ops();
     if (version >= 11) {
         std::vector<std::shared_ptr<ov::Node>> result;
@@ -799,8 +852,28 @@ void ngfunction_2_ir(pugi::xml_node& netXml,
         }
         sorted_ops = result;
     }
+    return sorted_ops;
+}
 
-    for (const auto& n : sorted_ops) {
+void ngfunction_2_ir(pugi::xml_node& netXml,
+                     const ngraph::Function& f,
+                     const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                     ConstantWriter& constant_node_write_handler,
+                     int64_t version,
+                     bool deterministic) {
+    // If determinism is not required, include auto-generated names into xml
+    if (!deterministic || !is_name_auto_generated(f)) {
+        netXml.append_attribute("name").set_value(f.get_friendly_name().c_str());
+    }
+    netXml.append_attribute("version").set_value(version);
+    pugi::xml_node layers = netXml.append_child("layers");
+
+    const std::unordered_map<ngraph::Node*, int> layer_ids = create_layer_ids(f);
+    std::unordered_set<std::string> unique_names;
+
+    const bool exec_graph = is_exec_graph(f);
+
+    for (const auto& n : get_layers_order(f, version)) {
         ngraph::Node* node = n.get();
         const std::string& node_type_name{node->get_type_name()};
 
@@ -952,6 +1025,347 @@ void ngfunction_2_ir(pugi::xml_node& netXml,
     }
 }
 
+namespace topology {
+using ov::ir_topology::AttributeKind;
+
+class Buffer {
+public:
+    template <typename T>
+    void write(const T& value) {
+        append(&value, sizeof(T));
+    }
+
+    void append(const void* data, size_t size) {
+        m_data.append(static_cast<const char*>(data), size);
+    }
+
+    const std::string& str() const {
+        return m_data;
+    }
+
+private:
+    std::string m_data;
+};
+
+class StringTable {
+public:
+    uint32_t add(const std::string& value) {
+        const auto found = m_ids.find(value);
+        if (found != m_ids.end()) {
+            return found->second;
+        }
+        const auto id = static_cast<uint32_t>(m_strings.size());
+        m_ids.emplace(value, id);
+        m_strings.push_back(value);
+        return id;
+    }
+
+    void write(Buffer& buffer) const {
+        buffer.write(static_cast<uint32_t>(m_strings.size()));
+        for (const auto& value : m_strings) {
+            buffer.write(static_cast<uint32_t>(value.size()));
+            buffer.append(value.data(), value.size());
+        }
+    }
+
+private:
+    std::unordered_map<std::string, uint32_t> m_ids;
+    std::vector<std::string> m_strings;
+};
+
+void write_shape(Buffer& buffer, const ov::PartialShape& shape) {
+    if (shape.rank().is_dynamic()) {
+        buffer.write(int64_t{-1});
+        return;
+    }
+    buffer.write(static_cast<int64_t>(shape.size()));
+    for (const auto& d : shape) {
+        buffer.write(static_cast<int64_t>(d.get_min_length()));
+        buffer.write(static_cast<int64_t>(d.get_max_length()));
+    }
+}
+
+// Typed counterpart of XmlSerializer: every attribute is stored as a record with its kind, so the reader does not
+// need to convert strings to numbers. Attributes which can not be represented (sub-graph bodies, framework nodes)
+// make the whole section unsupported and the model is read from the .xml only.
+class AttributeWriter : public ngraph::AttributeVisitor {
+public:
+    AttributeWriter(StringTable& strings,
+                    ConstantWriter& constant_write_handler,
+                    const std::string& node_type_name,
+                    bool& supported)
+        : m_strings(strings),
+          m_constant_write_handler(constant_write_handler),
+          m_node_type_name(node_type_name),
+          m_supported(supported) {}
+
+    void write(Buffer& buffer) const {
+        buffer.write(m_count);
+        buffer.append(m_records.str().data(), m_records.str().size());
+    }
+
+    void add_string(const std::string& name, const std::string& value) {
+        begin(name, AttributeKind::STRING);
+        m_records.write(m_strings.add(value));
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            begin(name, AttributeKind::VARIABLE);
+            m_records.write(m_strings.add(a->get()->get_info().variable_id));
+        } else if (const auto& a =
+                       ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                           &adapter)) {
+            if (name == "value" && translate_type_name(m_node_type_name) == "Const") {
+                const uint64_t size = a->get()->size();
+                const uint64_t offset =
+                    m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()), size);
+                begin(name, AttributeKind::CONST_DATA);
+                m_records.write(offset);
+                m_records.write(size);
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::TypeVector>>(&adapter)) {
+            begin(name, AttributeKind::ELEMENT_TYPES);
+            m_records.write(static_cast<uint32_t>(a->get().size()));
+            for (const auto& type : a->get()) {
+                m_records.write(static_cast<uint8_t>(ngraph::element::Type_t(type)));
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            begin(name, AttributeKind::PARTIAL_SHAPE);
+            write_shape(m_records, a->get());
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            begin(name, AttributeKind::DIMENSION);
+            m_records.write(static_cast<int64_t>(a->get().get_min_length()));
+            m_records.write(static_cast<int64_t>(a->get().get_max_length()));
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            write_vector(name, AttributeKind::VEC_STRING, std::vector<std::string>(a->get().begin(), a->get().end()));
+        } else {
+            m_supported = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        begin(name, AttributeKind::BOOL);
+        m_records.write(static_cast<uint8_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        add_string(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        begin(name, AttributeKind::INT64);
+        m_records.write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        begin(name, AttributeKind::DOUBLE);
+        m_records.write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int>>& adapter) override {
+        write_vector(name, AttributeKind::VEC_INT32, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write_vector(name, AttributeKind::VEC_INT64, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write_vector(name, AttributeKind::VEC_UINT64, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        write_vector(name, AttributeKind::VEC_FLOAT, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        write_vector(name, AttributeKind::VEC_STRING, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<Function>>& adapter) override {
+        m_supported = false;
+    }
+
+private:
+    void begin(const std::string& name, AttributeKind kind) {
+        m_records.write(m_strings.add(name));
+        m_records.write(static_cast<uint8_t>(kind));
+        m_count++;
+    }
+
+    template <typename T>
+    void write_vector(const std::string& name, AttributeKind kind, const std::vector<T>& values) {
+        begin(name, kind);
+        m_records.write(static_cast<uint32_t>(values.size()));
+        if (!values.empty())
+            m_records.append(values.data(), values.size() * sizeof(T));
+    }
+
+    void write_vector(const std::string& name, AttributeKind kind, const std::vector<std::string>& values) {
+        begin(name, kind);
+        m_records.write(static_cast<uint32_t>(values.size()));
+        for (const auto& value : values) {
+            m_records.write(m_strings.add(value));
+        }
+    }
+
+    StringTable& m_strings;
+    ConstantWriter& m_constant_write_handler;
+    const std::string& m_node_type_name;
+    bool& m_supported;
+    uint32_t m_count = 0;
+    Buffer m_records;
+};
+
+void write_runtime_info(Buffer& buffer,
+                        StringTable& strings,
+                        ConstantWriter& constant_write_handler,
+                        RTMap& attributes,
+                        bool& supported) {
+    const std::string rt_info_type_name;
+    uint32_t count = 0;
+    Buffer records;
+    for (auto& item : attributes) {
+        if (item.second.is<ov::RuntimeAttribute>()) {
+            auto& rt_attribute = item.second.as<ov::RuntimeAttribute>();
+            const auto& type_info = rt_attribute.get_type_info();
+            AttributeWriter writer(strings, constant_write_handler, rt_info_type_name, supported);
+            if (rt_attribute.visit_attributes(writer)) {
+                records.write(strings.add(type_info.name));
+                records.write(strings.add(type_info.get_version()));
+                writer.write(records);
+                count++;
+            }
+        }
+    }
+    buffer.write(count);
+    buffer.append(records.str().data(), records.str().size());
+}
+
+/// \brief Builds the payload of the binary topology section, see ir_topology.hpp for the layout
+/// \return false if the model contains operations which can be represented only in the .xml
+bool ngfunction_2_topology(std::string& payload,
+                           const ngraph::Function& f,
+                           const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                           ConstantWriter& constant_write_handler,
+                           int64_t version) {
+    if (is_exec_graph(f))
+        return false;
+
+    bool supported = true;
+    StringTable strings;
+    Buffer layers;
+
+    const std::unordered_map<ngraph::Node*, int> layer_ids = create_layer_ids(f);
+    std::unordered_set<std::string> unique_names;
+
+    const auto sorted_ops = get_layers_order(f, version);
+    layers.write(static_cast<uint32_t>(sorted_ops.size()));
+    for (const auto& n : sorted_ops) {
+        ngraph::Node* node = n.get();
+        const std::string& node_type_name{node->get_type_name()};
+        // LSTMCell v0 peephole input is not serialized, keep the .xml workaround as the only representation
+        if (dynamic_cast<opset1::LSTMCell*>(node) || ov::is_type<ov::op::util::FrameworkNode>(node))
+            return false;
+
+        layers.write(static_cast<uint32_t>(layer_ids.at(node)));
+        layers.write(strings.add(get_node_unique_name(unique_names, node)));
+        layers.write(strings.add(translate_type_name(node_type_name)));
+        layers.write(strings.add(get_opset_name(node, custom_opsets)));
+
+        layers.write(static_cast<uint32_t>(node->get_input_size()));
+        for (auto& i : node->inputs()) {
+            if (version >= 11) {
+                write_runtime_info(layers, strings, constant_write_handler, i.get_rt_info(), supported);
+            } else {
+                layers.write(uint32_t{0});
+            }
+        }
+
+        const size_t output_size = ngraph::op::is_output(node) ? 0 : node->get_output_size();
+        layers.write(static_cast<uint32_t>(output_size));
+        for (size_t idx = 0; idx < output_size; ++idx) {
+            auto o = node->output(idx);
+            layers.write(static_cast<uint8_t>(ngraph::element::Type_t(o.get_element_type())));
+            write_shape(layers, o.get_partial_shape());
+
+            const auto& tensor_names = o.get_tensor().get_names();
+            std::vector<std::string> vector_names(tensor_names.begin(), tensor_names.end());
+            sort(vector_names.begin(), vector_names.end());
+            layers.write(static_cast<uint32_t>(vector_names.size()));
+            for (const auto& name : vector_names) {
+                layers.write(strings.add(name));
+            }
+            if (version >= 11) {
+                write_runtime_info(layers, strings, constant_write_handler, o.get_rt_info(), supported);
+            } else {
+                layers.write(uint32_t{0});
+            }
+        }
+
+        AttributeWriter writer(strings, constant_write_handler, node_type_name, supported);
+        NGRAPH_CHECK(node->visit_attributes(writer), "Visitor API is not supported in ", node);
+        for (const auto& rt_info_name : rt_info::list_of_names) {
+            const auto& found_rt_info = node->get_rt_info().find(rt_info_name);
+            if (found_rt_info != node->get_rt_info().end()) {
+                std::stringstream strm;
+                found_rt_info->second.print(strm);
+                writer.add_string(rt_info_name, strm.str());
+            }
+        }
+        writer.write(layers);
+
+        if (version >= 11) {
+            write_runtime_info(layers, strings, constant_write_handler, node->get_rt_info(), supported);
+        } else {
+            layers.write(uint32_t{0});
+        }
+
+        if (!supported)
+            return false;
+    }
+
+    Buffer edges;
+    uint32_t edges_count = 0;
+    for (const auto& node : f.get_ordered_ops()) {
+        for (const auto& i : node->inputs()) {
+            const auto source_output = i.get_source_output();
+            edges.write(static_cast<uint32_t>(layer_ids.at(source_output.get_node())));
+            edges.write(static_cast<uint32_t>(source_output.get_index()));
+            edges.write(static_cast<uint32_t>(layer_ids.at(node.get())));
+            edges.write(static_cast<uint32_t>(i.get_index()));
+            edges_count++;
+        }
+    }
+
+    Buffer result;
+    result.write(ov::ir_topology::format_version);
+    result.write(version);
+    const auto net_name = strings.add(f.get_friendly_name());
+    strings.write(result);
+    result.write(net_name);
+    result.append(layers.str().data(), layers.str().size());
+    result.write(edges_count);
+    result.append(edges.str().data(), edges.str().size());
+    payload = result.str();
+    return true;
+}
+
+void write_topology(std::ostream& bin_file,
+                    std::ostream::pos_type blob_offset,
+                    const std::string& xml,
+                    const ngraph::Function& f,
+                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                    ConstantWriter& constant_write_handler,
+                    int64_t version) {
+    std::string payload;
+    if (!ngfunction_2_topology(payload, f, custom_opsets, constant_write_handler, version))
+        return;
+    constant_write_handler.flush();
+
+    ov::ir_topology::Footer footer{};
+    ov::ir_topology::set_magic(footer);
+    footer.offset = static_cast<uint64_t>(bin_file.tellp() - blob_offset);
+    footer.size = payload.size();
+    footer.xml_size = xml.size();
+    footer.xml_hash = ov::ir_topology::hash(xml.data(), xml.size());
+    bin_file.write(payload.data(), payload.size());
+    bin_file.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+}
+}  // namespace topology
+
 std::string valid_xml_path(const std::string& path) {
     NGRAPH_CHECK(path.length() > 4, "Path for xml file is to short: \"" + path + "\"");
 
@@ -979,7 +1393,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool binary_topology = false) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1000,13 +1415,25 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
+    const auto blob_offset = bin_file.tellp();
     ConstantWriter constant_write_handler(bin_file);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
-    xml_doc.save(xml_file);
+    if (binary_topology) {
+        // the section is bound to the exact .xml content, so the document is saved to memory to be hashed
+        std::stringstream xml_stream;
+        xml_doc.save(xml_stream);
+        const auto xml = xml_stream.str();
+        xml_file.write(xml.data(), xml.size());
+        topology::write_topology(bin_file, blob_offset, xml, *f, custom_opsets, constant_write_handler, version);
+    } else {
+        xml_doc.save(xml_file);
+    }
+    constant_write_handler.flush();
     xml_file.flush();
     bin_file.flush();
+    NGRAPH_CHECK(xml_file && bin_file, "Failed to write the model");
 };
 
 }  // namespace
@@ -1014,17 +1441,18 @@ void serializeFunc(std::ostream& xml_file,
 namespace ov {
 bool pass::Serialize::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
     if (m_xmlFile && m_binFile) {
-        serializeFunc(*m_xmlFile, *m_binFile, f, m_version, m_custom_opsets);
+        serializeFunc(*m_xmlFile, *m_binFile, f, m_version, m_custom_opsets, false, m_binary_topology);
     } else {
         std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
         NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
-        // create xml file
-        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        // create xml file, the binary topology is bound to the exact bytes of it, so no newline translation
+        const auto xml_mode = m_binary_topology ? std::ios::out | std::ios::binary : std::ios::out;
+        std::ofstream xml_file(m_xmlPath, xml_mode);
         NGRAPH_CHECK(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
 
         try {
-            serializeFunc(xml_file, bin_file, f, m_version, m_custom_opsets);
+            serializeFunc(xml_file, bin_file, f, m_version, m_custom_opsets, false, m_binary_topology);
         } catch (const ngraph::CheckFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -1053,8 +1481,13 @@ pass::Serialize::Serialize(std::ostream& xmlFile,
       m_version{version},
       m_custom_opsets{custom_opsets} {}
 
-pass::Serialize::Serialize(std::ostream& xmlFile, std::ostream& binFile, pass::Serialize::Version version)
-    : pass::Serialize::Serialize(xmlFile, binFile, std::map<std::string, ngraph::OpSet>{}, version) {}
+pass::Serialize::Serialize(std::ostream& xmlFile,
+                           std::ostream& binFile,
+                           pass::Serialize::Version version,
+                           bool binary_topology)
+    : pass::Serialize::Serialize(xmlFile, binFile, std::map<std::string, ngraph::OpSet>{}, version) {
+    m_binary_topology = binary_topology;
+}
 
 pass::Serialize::Serialize(const std::string& xmlPath,
                            const std::string& binPath,
@@ -1066,8 +1499,13 @@ pass::Serialize::Serialize(const std::string& xmlPath,
       m_version{version},
       m_custom_opsets{custom_opsets} {}
 
-pass::Serialize::Serialize(const std::string& xmlPath, const std::string& binPath, pass::Serialize::Version version)
-    : pass::Serialize::Serialize(xmlPath, binPath, std::map<std::string, ngraph::OpSet>{}, version) {}
+pass::Serialize::Serialize(const std::string& xmlPath,
+                           const std::string& binPath,
+                           pass::Serialize::Version version,
+                           bool binary_topology)
+    : pass::Serialize::Serialize(xmlPath, binPath, std::map<std::string, ngraph::OpSet>{}, version) {
+    m_binary_topology = binary_topology;
+}
 OPENVINO_SUPPRESS_DEPRECATED_END
 
 OPENVINO_SUPPRESS_DEPRECATED_START
@@ -1136,6 +1574,7 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ngraph::Function>
     XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = f;
     visitor.on_attribute(name, fun);
+    constant_write_handler.flush();
 
     // IR
     hdr.model_offset = m_stream.tellp();
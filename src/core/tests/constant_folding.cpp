@@ -3262,3 +3262,53 @@ TEST(constant_folding, constant_loop) {
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, max_folded_size) {
+    auto constant = op::Constant::create(element::f16, Shape{1024}, {1});
+    auto convert = make_shared<op::Convert>(constant, element::f32);
+    auto f = make_shared<Function>(convert, ParameterVector{});
+
+    // the folded Convert takes 4096 bytes
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(1024);
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 1);
+
+    pass::Manager unlimited_pass_manager;
+    unlimited_pass_manager.register_pass<pass::ConstantFolding>(4096);
+    unlimited_pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    range_test_check(get_result_constant<float>(f, 0), vector<float>(1024, 1.f));
+}
+
+TEST(constant_folding, weights_decompression) {
+    // f16 weights dequantized per output channel, the rows aren't a multiple of the vector length of Convert
+    const Shape shape{3, 1029};
+    const vector<float> zero_points{1.f, -2.f, 3.f};
+    const vector<float> scales{0.5f, 0.25f, 2.f};
+    vector<float> values(shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = static_cast<float>(static_cast<int>(i % 255) - 127);
+    }
+    auto weights = op::Constant::create(element::f16, shape, values);
+    auto convert = make_shared<op::Convert>(weights, element::f32);
+    auto zero_point = op::Constant::create(element::f32, Shape{3, 1}, zero_points);
+    auto subtract = make_shared<op::v1::Subtract>(convert, zero_point);
+    auto scale = op::Constant::create(element::f32, Shape{3, 1}, scales);
+    auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+    auto f = make_shared<Function>(multiply, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Subtract>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    vector<float> expected(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        const size_t row = i / shape[1];
+        expected[i] = (values[i] - zero_points[row]) * scales[row];
+    }
+    range_test_check(get_result_constant<float>(f, 0), expected);
+}
@@ -4,10 +4,12 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
 #include <fstream>
 
 #include "openvino/opsets/opset8.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "read_ir.hpp"
 #include "util/test_common.hpp"
 
 class SerializatioConstantCompressionTest : public ov::test::TestsCommon {
@@ -207,3 +209,61 @@ TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsDifferentTypesI32I
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializatioConstantCompressionTest, NonIdenticalConstantsWithWeakHashCollision) {
+    // {2, 2} and {0, 128} had the same value of the previous hash, so only the first of them could be found by it
+    // and the copy of the second one was written again
+    constexpr int unique_const_count = 2;
+    const ov::Shape shape{2};
+
+    auto A = ov::opset8::Constant::create(ov::element::i64, shape, {2, 2});
+    auto B = ov::opset8::Constant::create(ov::element::i64, shape, {0, 128});
+    auto C = ov::opset8::Constant::create(ov::element::i64, shape, {0, 128});
+
+    auto ngraph_a = std::make_shared<ov::Model>(ov::NodeVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(ngraph_a);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int64_t));
+}
+
+TEST_F(SerializatioConstantCompressionTest, LargeAndSmallConstants) {
+    // the large constants (4 MB) bypass the staging block of the writer
+    const ov::Shape large_shape{1, 1024, 1024};
+    const ov::Shape small_shape{1000};
+
+    ov::NodeVector constants;
+    for (int i = 0; i < 4; ++i) {
+        constants.push_back(std::make_shared<ov::opset8::Constant>(ov::element::f32,
+                                                                   large_shape,
+                                                                   std::vector<float>(ov::shape_size(large_shape), i)));
+        constants.push_back(std::make_shared<ov::opset8::Constant>(ov::element::f32,
+                                                                   small_shape,
+                                                                   std::vector<float>(ov::shape_size(small_shape), i)));
+    }
+    constants.push_back(std::make_shared<ov::opset8::Constant>(ov::element::f32,
+                                                               large_shape,
+                                                               std::vector<float>(ov::shape_size(large_shape), 0)));
+
+    auto ngraph_a = std::make_shared<ov::Model>(constants, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(ngraph_a);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+    ASSERT_TRUE(file_size(bin_1) ==
+                4 * (ov::shape_size(large_shape) + ov::shape_size(small_shape)) * sizeof(float));
+
+    auto result = ov::test::readModel(m_out_xml_path_1, m_out_bin_path_1);
+    ASSERT_EQ(result->get_results().size(), constants.size());
+    for (size_t i = 0; i < constants.size(); ++i) {
+        const auto expected = ov::as_type_ptr<ov::opset8::Constant>(constants[i]);
+        const auto actual = ov::as_type_ptr<ov::opset8::Constant>(
+            result->get_results()[i]->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(actual);
+        ASSERT_EQ(expected->get_byte_size(), actual->get_byte_size());
+        ASSERT_EQ(0, std::memcmp(expected->get_data_ptr(), actual->get_data_ptr(), expected->get_byte_size()));
+    }
+}
@@ -6,8 +6,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 
+#include "ir_topology.hpp"
 #include "openvino/util/file_util.hpp"
 #include "read_ir.hpp"
 #include "util/graph_comparator.hpp"
@@ -51,6 +54,50 @@ TEST_P(SerializationTest, CompareFunctions) {
     EXPECT_TRUE(res.valid) << res.message;
 }
 
+namespace {
+std::string read_file(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Blanks out the layers of the .xml keeping its size and binds the binary topology section to the new content,
+// so the model can be read only from the section. Returns false if the weights don't contain the section.
+bool blank_xml_layers(const std::string& xml_path, const std::string& bin_path) {
+    std::string xml = read_file(xml_path);
+    std::string bin = read_file(bin_path);
+    ov::ir_topology::Footer footer;
+    if (!ov::ir_topology::find_footer(bin.data(), bin.size(), footer))
+        return false;
+
+    const auto begin = xml.find("<layers>");
+    const auto end = xml.rfind("</net>");
+    if (begin == std::string::npos || end == std::string::npos || begin > end)
+        return false;
+    std::fill(xml.begin() + begin, xml.begin() + end, ' ');
+    footer.xml_hash = ov::ir_topology::hash(xml.data(), xml.size());
+    std::memcpy(&bin[bin.size() - sizeof(footer)], &footer, sizeof(footer));
+
+    std::ofstream(xml_path, std::ios::binary) << xml;
+    std::ofstream(bin_path, std::ios::binary) << bin;
+    return true;
+}
+}  // namespace
+
+TEST_P(SerializationTest, CompareFunctionsWithBinaryTopology) {
+    auto expected = ov::test::readModel(m_model_path, m_binary_path);
+    ov::pass::Serialize(m_out_xml_path, m_out_bin_path, ov::pass::Serialize::Version::UNSPECIFIED, true)
+        .run_on_model(expected);
+    // the models which have the section are read from it only, the .xml without layers can't be read
+    blank_xml_layers(m_out_xml_path, m_out_bin_path);
+    auto result = ov::test::readModel(m_out_xml_path, m_out_bin_path);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(result, expected);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
 INSTANTIATE_TEST_SUITE_P(
     IRSerialization,
     SerializationTest,
@@ -87,3 +134,70 @@ INSTANTIATE_TEST_SUITE_P(ONNXSerialization,
                                          std::make_tuple("add_abc_initializers.onnx", "")));
 
 #endif
+
+using SerializationBinaryTopologyTest = SerializationTest;
+
+TEST_P(SerializationBinaryTopologyTest, ModelIsReadFromSection) {
+    auto expected = ov::test::readModel(m_model_path, m_binary_path);
+    ov::pass::Serialize(m_out_xml_path, m_out_bin_path, ov::pass::Serialize::Version::UNSPECIFIED, true)
+        .run_on_model(expected);
+    ASSERT_TRUE(blank_xml_layers(m_out_xml_path, m_out_bin_path));
+
+    auto result = ov::test::readModel(m_out_xml_path, m_out_bin_path);
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(result, expected);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
+TEST_P(SerializationBinaryTopologyTest, SectionIsBoundToXml) {
+    auto expected = ov::test::readModel(m_model_path, m_binary_path);
+    ov::pass::Serialize(m_out_xml_path, m_out_bin_path, ov::pass::Serialize::Version::UNSPECIFIED, true)
+        .run_on_model(expected);
+
+    const auto xml = read_file(m_out_xml_path);
+    const auto bin = read_file(m_out_bin_path);
+    ov::ir_topology::Footer footer;
+    ASSERT_TRUE(ov::ir_topology::find_footer(bin.data(), bin.size(), footer));
+    EXPECT_EQ(footer.xml_size, xml.size());
+    EXPECT_EQ(footer.xml_hash, ov::ir_topology::hash(xml.data(), xml.size()));
+
+    // the section doesn't match the edited .xml anymore, the model has to be read from the .xml
+    {
+        std::ofstream xml_file(m_out_xml_path, std::ios::app | std::ios::binary);
+        xml_file << "\n";
+    }
+    auto result = ov::test::readModel(m_out_xml_path, m_out_bin_path);
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(result, expected);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
+INSTANTIATE_TEST_SUITE_P(IRSerialization,
+                         SerializationBinaryTopologyTest,
+                         testing::Values(std::make_tuple("add_abc.xml", "add_abc.bin"),
+                                         std::make_tuple("nms5.xml", "nms5.bin"),
+                                         std::make_tuple("conv_with_rt_info.xml", "")));
+
+TEST(SerializationBinaryTopology, SubGraphsAreWrittenToXmlOnly) {
+    const std::string model_path = ov::util::path_join({SERIALIZED_ZOO, "ir/loop_2d_add.xml"});
+    const std::string binary_path = ov::util::path_join({SERIALIZED_ZOO, "ir/loop_2d_add.bin"});
+    const std::string out_xml_path = "SerializationBinaryTopology_SubGraphs.xml";
+    const std::string out_bin_path = "SerializationBinaryTopology_SubGraphs.bin";
+
+    auto expected = ov::test::readModel(model_path, binary_path);
+    ov::pass::Serialize(out_xml_path, out_bin_path, ov::pass::Serialize::Version::UNSPECIFIED, true)
+        .run_on_model(expected);
+
+    std::ifstream bin_file(out_bin_path, std::ios::binary);
+    const std::string bin((std::istreambuf_iterator<char>(bin_file)), std::istreambuf_iterator<char>());
+    bin_file.close();
+    std::remove(out_xml_path.c_str());
+    std::remove(out_bin_path.c_str());
+
+    ov::ir_topology::Footer footer;
+    EXPECT_FALSE(ov::ir_topology::find_footer(bin.data(), bin.size(), footer));
+}
@@ -7,11 +7,13 @@
 #include <xml_parse_utils.h>
 
 #include <ir_deserializer.hpp>
+#include <ir_topology_deserializer.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <openvino/op/util/framework_node.hpp>
 #include <pugixml.hpp>
 
 #include "openvino/core/validation_util.hpp"
+#include "openvino/util/log.hpp"
 
 using namespace ngraph;
 using namespace InferenceEngine;
@@ -194,6 +196,37 @@ class InputModel::InputModelIRImpl {
     std::unordered_map<std::string, ngraph::OpSet> m_opsets;
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
+    // .xml content which is parsed only if the binary topology section can not be used
+    std::string m_xml;
+    bool m_has_topology = false;
+    ov::ir_topology::Footer m_topology;
+
+    void parse_xml(std::istream& stream) {
+        pugi::xml_parse_result res = m_xml_doc.load(stream);
+        if (res.status != pugi::status_ok) {
+            IE_THROW() << res.description() << " at offset " << res.offset;
+        }
+        m_root = m_xml_doc.document_element();
+    }
+
+    // The binary topology section is used only if it was written together with exactly this .xml
+    bool read_topology_footer(std::istream& stream) {
+        if (!m_weights ||
+            !ov::ir_topology::find_footer(m_weights->get_ptr<char>(), m_weights->size(), m_topology)) {
+            return false;
+        }
+        const auto begin = stream.tellg();
+        if (begin < 0)
+            return false;
+        stream.seekg(0, std::ios::end);
+        const auto size = static_cast<uint64_t>(stream.tellg() - begin);
+        stream.seekg(begin);
+        if (size != m_topology.xml_size)
+            return false;
+        m_xml.resize(size);
+        stream.read(&m_xml[0], size);
+        return ov::ir_topology::hash(m_xml.data(), m_xml.size()) == m_topology.xml_hash;
+    }
 
 public:
     InputModelIRImpl(std::istream& stream,
@@ -201,11 +234,15 @@ public:
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
         : m_weights(weights),
           m_extensions(extensions) {
-        pugi::xml_parse_result res = m_xml_doc.load(stream);
-        if (res.status != pugi::status_ok) {
-            IE_THROW() << res.description() << " at offset " << res.offset;
+        m_has_topology = read_topology_footer(stream);
+        if (!m_has_topology) {
+            if (m_xml.empty()) {
+                parse_xml(stream);
+            } else {
+                std::istringstream xml_stream(m_xml);
+                parse_xml(xml_stream);
+            }
         }
-        m_root = m_xml_doc.document_element();
         m_opsets["opset1"] = ngraph::get_opset1();
         m_opsets["opset2"] = ngraph::get_opset2();
         m_opsets["opset3"] = ngraph::get_opset3();
@@ -230,6 +267,24 @@ std::shared_ptr<Function> InputModel::convert() {
 }
 
 std::shared_ptr<Function> InputModel::InputModelIRImpl::convert() {
+    if (m_has_topology) {
+        try {
+            ov::TopologyDeserializer deserializer(m_weights, m_topology, m_opsets, m_extensions);
+            auto function = deserializer.parse_function();
+            function->get_rt_info()["version"] = deserializer.get_version();
+            // ov::pass::Serialize does not write <pre-process>, so there is nothing else to read from the .xml
+            return function;
+        } catch (const std::exception& ex) {
+            // the section is only an acceleration, the .xml is a complete IR and remains the fallback in all builds,
+            // but the section bound to this .xml is expected to be valid, so the failure is reported
+            OPENVINO_WARN << "Binary topology section of the IR can not be read, the model is read from the .xml: "
+                          << ex.what();
+        }
+        std::istringstream xml_stream(m_xml);
+        parse_xml(xml_stream);
+        m_has_topology = false;
+    }
+
     std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> variables;
 
     // Load default opsets
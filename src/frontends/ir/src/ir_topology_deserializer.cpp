@@ -0,0 +1,559 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ir_topology_deserializer.hpp"
+
+#include <cstring>
+
+#include "ie_ngraph_utils.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "transformations/rt_info/attributes.hpp"
+#include "transformations/rt_info/primitives_priority_attribute.hpp"
+
+using namespace ov;
+using ov::ir_topology::AttributeKind;
+
+namespace {
+
+class Cursor {
+public:
+    Cursor(const char* begin, const char* end) : m_ptr(begin), m_end(end) {}
+
+    template <typename T>
+    T read() {
+        T value;
+        std::memcpy(&value, skip(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    const char* skip(size_t size) {
+        if (static_cast<size_t>(m_end - m_ptr) < size)
+            IE_THROW() << "Binary topology section of the IR is truncated";
+        const char* ptr = m_ptr;
+        m_ptr += size;
+        return ptr;
+    }
+
+    const char* position() const {
+        return m_ptr;
+    }
+
+private:
+    const char* m_ptr;
+    const char* m_end;
+};
+
+ov::PartialShape read_shape(Cursor& cursor) {
+    const auto rank = cursor.read<int64_t>();
+    if (rank < 0)
+        return ov::PartialShape::dynamic();
+    std::vector<ov::Dimension> dims;
+    dims.reserve(rank);
+    for (int64_t i = 0; i < rank; ++i) {
+        const auto min = cursor.read<int64_t>();
+        const auto max = cursor.read<int64_t>();
+        dims.emplace_back(min, max);
+    }
+    return ov::PartialShape(dims);
+}
+
+// Reads the records and remembers where the values are, they are decoded by the visitor of the operation
+TopologyDeserializer::AttributeRecords read_attributes(Cursor& cursor) {
+    const auto count = cursor.read<uint32_t>();
+    TopologyDeserializer::AttributeRecords records;
+    records.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        TopologyDeserializer::AttributeRecord record;
+        record.name = cursor.read<uint32_t>();
+        record.kind = static_cast<AttributeKind>(cursor.read<uint8_t>());
+        record.value = cursor.position();
+        switch (record.kind) {
+        case AttributeKind::BOOL:
+            cursor.skip(sizeof(uint8_t));
+            break;
+        case AttributeKind::STRING:
+        case AttributeKind::VARIABLE:
+            cursor.skip(sizeof(uint32_t));
+            break;
+        case AttributeKind::INT64:
+            cursor.skip(sizeof(int64_t));
+            break;
+        case AttributeKind::DOUBLE:
+            cursor.skip(sizeof(double));
+            break;
+        case AttributeKind::VEC_INT32:
+            cursor.skip(cursor.read<uint32_t>() * sizeof(int32_t));
+            break;
+        case AttributeKind::VEC_INT64:
+            cursor.skip(cursor.read<uint32_t>() * sizeof(int64_t));
+            break;
+        case AttributeKind::VEC_UINT64:
+            cursor.skip(cursor.read<uint32_t>() * sizeof(uint64_t));
+            break;
+        case AttributeKind::VEC_FLOAT:
+            cursor.skip(cursor.read<uint32_t>() * sizeof(float));
+            break;
+        case AttributeKind::VEC_STRING:
+            cursor.skip(cursor.read<uint32_t>() * sizeof(uint32_t));
+            break;
+        case AttributeKind::ELEMENT_TYPES:
+            cursor.skip(cursor.read<uint32_t>() * sizeof(uint8_t));
+            break;
+        case AttributeKind::CONST_DATA:
+            cursor.skip(2 * sizeof(uint64_t));
+            break;
+        case AttributeKind::PARTIAL_SHAPE:
+            read_shape(cursor);
+            break;
+        case AttributeKind::DIMENSION:
+            cursor.skip(2 * sizeof(int64_t));
+            break;
+        default:
+            IE_THROW() << "Unknown attribute kind in binary topology section of the IR";
+        }
+        record.size = cursor.position() - record.value;
+        records.push_back(record);
+    }
+    return records;
+}
+
+TopologyDeserializer::RuntimeInfoRecords read_runtime_info(Cursor& cursor) {
+    const auto count = cursor.read<uint32_t>();
+    TopologyDeserializer::RuntimeInfoRecords records(count);
+    for (auto& record : records) {
+        record.name = cursor.read<uint32_t>();
+        record.version = cursor.read<uint32_t>();
+        record.attributes = read_attributes(cursor);
+    }
+    return records;
+}
+
+class AttributeReader : public ov::AttributeVisitor {
+public:
+    AttributeReader(const TopologyDeserializer::AttributeRecords& records,
+                    const std::vector<std::string>& strings,
+                    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+                    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables)
+        : m_records(records),
+          m_strings(strings),
+          m_weights(weights),
+          m_variables(variables) {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        const auto* record = find(name);
+        if (!record)
+            return;
+        if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            const auto& variable_id = get_string(value<uint32_t>(*record, AttributeKind::VARIABLE));
+            if (!m_variables.count(variable_id)) {
+                m_variables[variable_id] = std::make_shared<ov::op::util::Variable>(
+                    ov::op::util::VariableInfo{ov::PartialShape::dynamic(), ov::element::dynamic, variable_id});
+            }
+            a->set(m_variables[variable_id]);
+        } else if (auto a =
+                       ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            auto cursor = open(*record, AttributeKind::CONST_DATA);
+            const auto offset = cursor.read<uint64_t>();
+            const auto size = cursor.read<uint64_t>();
+            const auto* shape = find("shape");
+            const auto* element_type = find("element_type");
+            if (!shape || !element_type)
+                IE_THROW() << "No shape or element type defined for Const op!";
+            if (!m_weights)
+                IE_THROW() << "Empty weights data in bin file or bin file cannot be found!";
+            if (offset > m_weights->size() || m_weights->size() - offset < size)
+                IE_THROW() << "Incorrect weights in bin file!";
+            const auto el_type = InferenceEngine::details::convertPrecision(
+                get_string(value<uint32_t>(*element_type, AttributeKind::STRING)));
+            const auto dims = get_vector<int64_t>(*shape, AttributeKind::VEC_INT64);
+            if (size < std::ceil(ngraph::shape_size(dims) * el_type.bitwidth() / 8.f))
+                IE_THROW() << "Attribute and shape size are inconsistent for Const op!";
+
+            char* data = m_weights->get_ptr<char>() + offset;
+            a->set(std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                data,
+                size,
+                m_weights));
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+            ov::element::TypeVector types;
+            for (const auto type : get_vector<uint8_t>(*record, AttributeKind::ELEMENT_TYPES)) {
+                types.emplace_back(static_cast<ov::element::Type_t>(type));
+            }
+            a->set(types);
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            auto cursor = open(*record, AttributeKind::PARTIAL_SHAPE);
+            a->set(read_shape(cursor));
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            auto cursor = open(*record, AttributeKind::DIMENSION);
+            const auto min = cursor.read<int64_t>();
+            const auto max = cursor.read<int64_t>();
+            a->set(ov::Dimension(min, max));
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            const auto values = get_strings(*record);
+            a->set(std::set<std::string>(values.begin(), values.end()));
+        } else {
+            IE_THROW() << "Attribute adapter can not be found for " << name << " parameter";
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        if (const auto* record = find(name))
+            adapter.set(get_string(value<uint32_t>(*record, AttributeKind::STRING)));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        if (const auto* record = find(name))
+            adapter.set(value<uint8_t>(*record, AttributeKind::BOOL) != 0);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        if (const auto* record = find(name))
+            adapter.set(value<double>(*record, AttributeKind::DOUBLE));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        if (const auto* record = find(name))
+            adapter.set(value<int64_t>(*record, AttributeKind::INT64));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        IE_THROW() << "Sub-graphs are not supported by binary topology section of the IR";
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        if (const auto* record = find(name))
+            adapter.set(get_vector<int32_t>(*record, AttributeKind::VEC_INT32));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        if (const auto* record = find(name))
+            adapter.set(get_vector<int64_t>(*record, AttributeKind::VEC_INT64));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        if (const auto* record = find(name))
+            adapter.set(get_vector<uint64_t>(*record, AttributeKind::VEC_UINT64));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        if (const auto* record = find(name))
+            adapter.set(get_vector<float>(*record, AttributeKind::VEC_FLOAT));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        if (const auto* record = find(name))
+            adapter.set(get_strings(*record));
+    }
+
+private:
+    const TopologyDeserializer::AttributeRecord* find(const std::string& name) const {
+        for (const auto& record : m_records) {
+            if (m_strings[record.name] == name)
+                return &record;
+        }
+        return nullptr;
+    }
+
+    static Cursor open(const TopologyDeserializer::AttributeRecord& record, AttributeKind kind) {
+        if (record.kind != kind)
+            IE_THROW() << "Unexpected kind of attribute in binary topology section of the IR";
+        return Cursor(record.value, record.value + record.size);
+    }
+
+    template <typename T>
+    static T value(const TopologyDeserializer::AttributeRecord& record, AttributeKind kind) {
+        return open(record, kind).read<T>();
+    }
+
+    template <typename T>
+    static std::vector<T> get_vector(const TopologyDeserializer::AttributeRecord& record, AttributeKind kind) {
+        auto cursor = open(record, kind);
+        std::vector<T> result(cursor.read<uint32_t>());
+        if (!result.empty())
+            std::memcpy(result.data(), cursor.skip(result.size() * sizeof(T)), result.size() * sizeof(T));
+        return result;
+    }
+
+    std::vector<std::string> get_strings(const TopologyDeserializer::AttributeRecord& record) const {
+        std::vector<std::string> result;
+        for (const auto id : get_vector<uint32_t>(record, AttributeKind::VEC_STRING)) {
+            result.push_back(get_string(id));
+        }
+        return result;
+    }
+
+    const std::string& get_string(uint32_t id) const {
+        if (id >= m_strings.size())
+            IE_THROW() << "Incorrect string index in binary topology section of the IR";
+        return m_strings[id];
+    }
+
+    const TopologyDeserializer::AttributeRecords& m_records;
+    const std::vector<std::string>& m_strings;
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& m_weights;
+    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& m_variables;
+};
+
+}  // namespace
+
+TopologyDeserializer::TopologyDeserializer(
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+    const ir_topology::Footer& footer,
+    const std::unordered_map<std::string, ngraph::OpSet>& opsets,
+    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+    : m_begin(weights->get_ptr<char>() + footer.offset),
+      m_end(weights->get_ptr<char>() + footer.offset + footer.size),
+      m_weights(weights),
+      m_opsets(opsets),
+      m_extensions(extensions) {}
+
+std::shared_ptr<ov::Model> TopologyDeserializer::parse_function() {
+    Cursor cursor(m_begin, m_end);
+    if (cursor.read<uint32_t>() != ir_topology::format_version)
+        IE_THROW() << "Unsupported version of binary topology section of the IR";
+    m_version = cursor.read<int64_t>();
+
+    const auto strings_count = cursor.read<uint32_t>();
+    m_strings.reserve(strings_count);
+    for (uint32_t i = 0; i < strings_count; ++i) {
+        const auto size = cursor.read<uint32_t>();
+        m_strings.emplace_back(cursor.skip(size), size);
+    }
+    auto get_string = [this](uint32_t id) -> const std::string& {
+        if (id >= m_strings.size())
+            IE_THROW() << "Incorrect string index in binary topology section of the IR";
+        return m_strings[id];
+    };
+    const auto model_name = get_string(cursor.read<uint32_t>());
+
+    struct edge {
+        size_t fromLayerId, fromOutput, toInput;
+    };
+
+    std::map<size_t /*layer-id*/, LayerRecord> layers;
+    std::vector<size_t /*layer-id*/> outputs;
+    std::vector<size_t> order;
+    std::set<size_t> dfs_used_nodes;
+    std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
+
+    const auto layers_count = cursor.read<uint32_t>();
+    for (uint32_t l = 0; l < layers_count; ++l) {
+        LayerRecord layer;
+        layer.id = cursor.read<uint32_t>();
+        layer.name = get_string(cursor.read<uint32_t>());
+        layer.type = get_string(cursor.read<uint32_t>());
+        layer.version = get_string(cursor.read<uint32_t>());
+
+        layer.inputs_rt_info.resize(cursor.read<uint32_t>());
+        for (auto& rt_info : layer.inputs_rt_info) {
+            rt_info = read_runtime_info(cursor);
+        }
+        layer.outputs.resize(cursor.read<uint32_t>());
+        for (auto& output : layer.outputs) {
+            output.precision = static_cast<ov::element::Type_t>(cursor.read<uint8_t>());
+            output.shape = read_shape(cursor);
+            const auto names_count = cursor.read<uint32_t>();
+            for (uint32_t i = 0; i < names_count; ++i) {
+                output.names.insert(get_string(cursor.read<uint32_t>()));
+            }
+            output.rt_info = read_runtime_info(cursor);
+        }
+        layer.attributes = read_attributes(cursor);
+        for (const auto& record : layer.attributes) {
+            get_string(record.name);
+        }
+        layer.rt_info = read_runtime_info(cursor);
+
+        if (layer.type == "Result" || layer.type == "Assign") {
+            outputs.push_back(layer.id);
+        }
+        if (layer.type == "Parameter") {
+            // Save Parameters order according to order in the section, they are ignored during DFS
+            dfs_used_nodes.insert(layer.id);
+            order.push_back(layer.id);
+            edges[layer.id] = {};
+        }
+        const auto id = layer.id;
+        if (!layers.emplace(id, std::move(layer)).second)
+            IE_THROW() << "Invalid IR! Layer id " << id << " is not unique!";
+    }
+
+    const auto edges_count = cursor.read<uint32_t>();
+    for (uint32_t e = 0; e < edges_count; ++e) {
+        const auto from_layer = cursor.read<uint32_t>();
+        const auto from_output = cursor.read<uint32_t>();
+        const auto to_layer = cursor.read<uint32_t>();
+        const auto to_input = cursor.read<uint32_t>();
+        edges[to_layer].push_back({from_layer, from_output, to_input});
+    }
+
+    // Run DFS starting from outputs to get nodes topological order
+    std::function<void(size_t)> dfs = [&edges, &order, &dfs_used_nodes, &dfs](const size_t id) {
+        if (dfs_used_nodes.count(id))
+            return;
+        dfs_used_nodes.insert(id);
+        for (auto& edge : edges[id]) {
+            dfs(edge.fromLayerId);
+        }
+        order.push_back(id);
+    };
+    std::for_each(outputs.begin(), outputs.end(), dfs);
+
+    ov::ParameterVector parameters;
+    ov::ResultVector results;
+    ov::SinkVector sinks;
+    std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
+    std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
+
+    for (auto& layer_id : order) {
+        const auto layerIt = layers.find(layer_id);
+        if (layerIt == layers.end())
+            IE_THROW() << "Attempt to access node " << layer_id << " that not in graph.";
+        const auto& layer = layerIt->second;
+        const auto& layer_edges = edges[layer_id];
+        ov::OutputVector inputs(layer_edges.size());
+        for (auto& e : layer_edges) {
+            const auto& input_node = id_to_node[e.fromLayerId];
+            if (!input_node)
+                IE_THROW() << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+            if (e.toInput >= inputs.size() || e.fromOutput >= input_node->get_output_size())
+                IE_THROW() << layer.type << " layer " << layer.name << " with id: " << layer.id << " is inconsistent!";
+            inputs[e.toInput] = input_node->output(e.fromOutput);
+        }
+
+        auto node = createNode(inputs, layer);
+        id_to_node[layer_id] = node;
+
+        if (const auto& parameter_node = std::dynamic_pointer_cast<ov::op::v0::Parameter>(node)) {
+            parameters.emplace_back(parameter_node);
+        }
+        if (const auto& result_node = std::dynamic_pointer_cast<ov::op::v0::Result>(node)) {
+            results.emplace_back(result_node);
+        }
+        if (const auto& sink = std::dynamic_pointer_cast<ov::op::Sink>(node)) {
+            sinks.emplace_back(sink);
+        }
+        if (const auto& read_value = std::dynamic_pointer_cast<ov::op::util::ReadValueBase>(node)) {
+            variable_id_to_read_value[read_value->get_variable_id()] = read_value;
+        }
+    }
+
+    auto function = std::make_shared<ov::Model>(results, sinks, parameters, model_name);
+    for (const auto& sink : sinks) {
+        if (const auto& assign = std::dynamic_pointer_cast<ov::op::util::AssignBase>(sink)) {
+            assign->add_control_dependency(variable_id_to_read_value.at(assign->get_variable_id()));
+        }
+    }
+    return function;
+}
+
+std::shared_ptr<ov::Node> TopologyDeserializer::createNode(const ov::OutputVector& inputs, const LayerRecord& layer) {
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!inputs[i].get_node())
+            IE_THROW() << layer.type << " layer " << layer.name << " with id: " << layer.id
+                       << " has incorrect input with index " << i << "!";
+        if (ov::element::Type_t::undefined == inputs[i].get_element_type())
+            IE_THROW() << layer.type << " layer " << layer.name << " with id: " << layer.id
+                       << " has undefined element type for input with index " << i << "!";
+    }
+
+    std::shared_ptr<ov::Node> node;
+    AttributeReader visitor(layer.attributes, m_strings, m_weights, m_variables);
+
+    auto extensionIt = m_extensions.find(ov::DiscreteTypeInfo(layer.type.c_str(), 0, layer.version.c_str()));
+    if (extensionIt != m_extensions.end()) {
+        node = (*extensionIt->second).create(inputs, visitor).at(0).get_node_shared_ptr();
+    }
+
+    // Same opset resolution as in XmlDeserializer::createNode
+    auto opsetIt = m_opsets.find(layer.version);
+    static const std::unordered_set<std::string> experimental_ops_added_to_opset = {
+        "ExperimentalDetectronDetectionOutput",
+        "ExperimentalDetectronGenerateProposalsSingleImage",
+        "ExperimentalDetectronPriorGridGenerator",
+        "ExperimentalDetectronROIFeatureExtractor",
+        "ExperimentalDetectronTopKROIs",
+        "GRUCell",
+        "RNNCell",
+        "Proposal"};
+    if (experimental_ops_added_to_opset.count(layer.type) &&
+        (layer.version == "experimental" || layer.version == "extension")) {
+        opsetIt = m_opsets.find("opset6");
+    }
+    if (!node && opsetIt != m_opsets.end()) {
+        const auto& type = layer.type == "Const" ? "Constant" : layer.type;
+        if (layer.version == "opset1" && (type == "MVN" || type == "ROIPooling" || type == "ReorgYolo")) {
+            opsetIt = m_opsets.find("opset2");
+            if (opsetIt == m_opsets.end())
+                IE_THROW() << "Cannot create " << layer.type << " layer " << layer.name << " id:" << layer.id
+                           << " from unsupported opset: " << layer.version;
+        }
+
+        node = std::shared_ptr<ov::Node>(opsetIt->second.create_insensitive(type));
+        if (!node)
+            IE_THROW() << "Opset " << layer.version << " doesn't contain the operation with type: " << type;
+        // Share Weights form constant blob
+        if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(node)) {
+            constant->alloc_buffer_on_visit_attributes(false);
+        }
+        node->set_arguments(inputs);
+        if (node->visit_attributes(visitor)) {
+            node->constructor_validate_and_infer_types();
+        }
+        // To be sure that all default values will be initialized:
+        node = node->clone_with_new_inputs(node->input_values());
+    }
+    if (!node) {
+        IE_THROW() << "Cannot create " << layer.type << " layer " << layer.name << " id:" << layer.id
+                   << " from unsupported opset: " << layer.version;
+    }
+
+    // Save run time info
+    auto& rtInfo = node->get_rt_info();
+    for (const auto& record : layer.attributes) {
+        const auto& name = m_strings[record.name];
+        if (record.kind != AttributeKind::STRING)
+            continue;
+        uint32_t id;
+        std::memcpy(&id, record.value, sizeof(id));
+        if (id >= m_strings.size())
+            IE_THROW() << "Incorrect string index in binary topology section of the IR";
+        if (name == "PrimitivesPriority") {
+            rtInfo.emplace(ov::PrimitivesPriority::get_type_info_static(), ov::PrimitivesPriority{m_strings[id]});
+        } else if (name == "alt_width") {
+            rtInfo["alt_width"] = m_strings[id];
+        }
+    }
+
+    node->set_friendly_name(layer.name);
+    for (size_t i = 0; i < layer.outputs.size() && i < node->get_output_size(); ++i) {
+        if (!layer.outputs[i].names.empty())
+            node->get_output_tensor(i).set_names(layer.outputs[i].names);
+    }
+
+    // read runtime info only for IR v11+
+    if (m_version > 10) {
+        set_runtime_info(node->get_rt_info(), layer.rt_info);
+        for (size_t i = 0; i < layer.outputs.size() && i < node->get_output_size(); ++i) {
+            set_runtime_info(node->output(i).get_rt_info(), layer.outputs[i].rt_info);
+        }
+        for (size_t i = 0; i < layer.inputs_rt_info.size() && i < node->get_input_size(); ++i) {
+            set_runtime_info(node->input(i).get_rt_info(), layer.inputs_rt_info[i]);
+        }
+    }
+
+    return node;
+}
+
+void TopologyDeserializer::set_runtime_info(RTMap& rt_info, const RuntimeInfoRecords& records) const {
+    ov::pass::Attributes attrs_factory;
+    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> no_variables;
+    for (const auto& record : records) {
+        if (record.name >= m_strings.size() || record.version >= m_strings.size())
+            IE_THROW() << "Incorrect string index in binary topology section of the IR";
+        const auto& attribute_name = m_strings[record.name];
+        const auto& type_info = ov::DiscreteTypeInfo(attribute_name.c_str(), 0, m_strings[record.version].c_str());
+        auto attr = attrs_factory.create_by_type_info(type_info);
+        if (attr.empty() || !attr.is<ov::RuntimeAttribute>())
+            IE_THROW() << "Attribute: " << attribute_name << " is not recognized as runtime attribute";
+        AttributeReader attribute_visitor(record.attributes, m_strings, m_weights, no_variables);
+        if (!attr.as<ov::RuntimeAttribute>().visit_attributes(attribute_visitor))
+            IE_THROW() << "VisitAttributes is not supported for: " << attribute_name << " attribute";
+        if (!rt_info.emplace(type_info, attr).second)
+            IE_THROW() << "multiple rt_info attributes are detected: " << attribute_name;
+    }
+}
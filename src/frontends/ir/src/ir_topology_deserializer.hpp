@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ir_topology.hpp"
+#include "ngraph/opsets/opset.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/op_extension.hpp"
+#include "openvino/op/util/variable.hpp"
+
+namespace ov {
+
+/// \brief Builds the model from the binary topology section which ov::pass::Serialize appends to the weights.
+/// The section carries the same information as the .xml: layers with typed attributes, integer edges and a string
+/// table, so no text has to be parsed. Any inconsistency is reported by an exception, the caller is expected to
+/// read the .xml then.
+class TopologyDeserializer {
+public:
+    TopologyDeserializer(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+                         const ir_topology::Footer& footer,
+                         const std::unordered_map<std::string, ngraph::OpSet>& opsets,
+                         const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
+
+    std::shared_ptr<ov::Model> parse_function();
+
+    int64_t get_version() const {
+        return m_version;
+    }
+
+    struct AttributeRecord {
+        uint32_t name;
+        ir_topology::AttributeKind kind;
+        const char* value;
+        size_t size;
+    };
+    using AttributeRecords = std::vector<AttributeRecord>;
+
+    struct RuntimeInfoRecord {
+        uint32_t name;
+        uint32_t version;
+        AttributeRecords attributes;
+    };
+    using RuntimeInfoRecords = std::vector<RuntimeInfoRecord>;
+
+private:
+    struct OutputRecord {
+        ov::element::Type_t precision;
+        ov::PartialShape shape;
+        std::unordered_set<std::string> names;
+        RuntimeInfoRecords rt_info;
+    };
+
+    struct LayerRecord {
+        size_t id;
+        std::string name;
+        std::string type;
+        std::string version;
+        std::vector<RuntimeInfoRecords> inputs_rt_info;
+        std::vector<OutputRecord> outputs;
+        AttributeRecords attributes;
+        RuntimeInfoRecords rt_info;
+    };
+
+    std::shared_ptr<ov::Node> createNode(const ov::OutputVector& inputs, const LayerRecord& layer);
+    void set_runtime_info(RTMap& rt_info, const RuntimeInfoRecords& records) const;
+
+    const char* m_begin;
+    const char* m_end;
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& m_weights;
+    const std::unordered_map<std::string, ngraph::OpSet>& m_opsets;
+    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& m_extensions;
+    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> m_variables;
+    std::vector<std::string> m_strings;
+    int64_t m_version = 0;
+};
+
+}  // namespace ov
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <exception>
 #include <future>
 #include <map>
@@ -39,8 +42,6 @@ namespace InferenceEngine {
  */
 class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
     enum InferState { Idle, Busy, Canceled, Stop };
-    using Futures = std::vector<std::shared_future<void>>;
-    using Promise = std::shared_ptr<std::promise<void>>;
     enum Stage_e : std::uint8_t { executor, task };
     IInferRequestInternal::Ptr _syncRequest;
 
@@ -49,10 +50,16 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
         explicit DisableCallbackGuard(AsyncInferRequestThreadSafeDefault* this_) : _this{this_} {
             std::lock_guard<std::mutex> lock{_this->_mutex};
             std::swap(_callback, _this->_callback);
+            _this->_callbackDisabled = true;
         }
         ~DisableCallbackGuard() {
             std::lock_guard<std::mutex> lock{_this->_mutex};
-            _this->_callback = _callback;
+            // The callback taken by the last stage of the previous pipeline may be already returned to the request,
+            // the stopped request keeps the callback cleared
+            if (_callback && _this->_state != InferState::Stop) {
+                _this->_callback = std::move(_callback);
+            }
+            _this->_callbackDisabled = false;
         }
         AsyncInferRequestThreadSafeDefault* _this = nullptr;
         Callback _callback;
@@ -80,32 +87,21 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
             case InferState::Canceled:
                 IE_THROW(InferCancelled);
             case InferState::Idle: {
-                _futures.erase(std::remove_if(std::begin(_futures),
-                                              std::end(_futures),
-                                              [](const std::shared_future<void>& future) {
-                                                  if (future.valid()) {
-                                                      return (std::future_status::ready ==
-                                                              future.wait_for(std::chrono::milliseconds{0}));
-                                                  } else {
-                                                      return true;
-                                                  }
-                                              }),
-                               _futures.end());
-                _promise = {};
-                _futures.emplace_back(_promise.get_future().share());
+                _runningPipeline = ++_startedPipelines;
+                ++_runningPipelines;
+                _state = InferState::Busy;
             } break;
             case InferState::Stop:
                 break;
             }
-            _state = InferState::Busy;
         }
         if (state != InferState::Stop) {
             try {
                 f();
             } catch (...) {
-                _promise.set_exception(std::current_exception());
                 std::lock_guard<std::mutex> lock{_mutex};
-                _state = InferState::Idle;
+                SetIdle();
+                CompletePipeline(_startedPipelines, std::current_exception());
                 throw;
             }
         }
@@ -182,37 +178,36 @@ public:
             IE_THROW(ParameterMismatch) << " Timeout can't be less " << InferRequest::WaitMode::RESULT_READY
                                         << " for InferRequest::Wait\n";
         }
-        auto status = std::future_status::deferred;
-
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock{_mutex};
-            return _futures.empty() ? std::shared_future<void>{} : _futures.back();
-        }();
-
-        if (!future.valid()) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        // Just wait for the last started pipeline
+        const auto pipeline = _startedPipelines;
+        if (pipeline == 0 || _state == InferState::Stop) {
             return StatusCode::INFER_NOT_STARTED;
         }
 
+        const auto completed = [&] {
+            return _completedPipelines >= pipeline;
+        };
         switch (millis_timeout) {
         case InferRequest::WaitMode::RESULT_READY: {
-            future.wait();
-            status = std::future_status::ready;
-        } break;
-        case InferRequest::WaitMode::STATUS_ONLY: {
-            status = future.wait_for(std::chrono::milliseconds{0});
+            _pipelineCompleted.wait(lock, completed);
         } break;
+        case InferRequest::WaitMode::STATUS_ONLY:
+            break;
         default: {
-            status = future.wait_for(std::chrono::milliseconds{millis_timeout});
+            _pipelineCompleted.wait_for(lock, std::chrono::milliseconds{millis_timeout}, completed);
         } break;
         }
 
-        if (std::future_status::ready == status) {
-            future.get();
-            return StatusCode::OK;
-        } else {
+        if (!completed()) {
             return StatusCode::RESULT_NOT_READY;
         }
+        if (nullptr != _pipelineException) {
+            auto exception = _pipelineException;
+            lock.unlock();
+            std::rethrow_exception(exception);
+        }
+        return StatusCode::OK;
     }
 
     void StartAsync() override {
@@ -310,9 +305,8 @@ protected:
     using Pipeline = std::vector<Stage>;
 
     /**
-     * @brief Creates and run the first stage task. If destructor was not called add a new std::future to the
-     * AsyncInferRequestThreadSafeDefault::_futures list that would be used to wait
-     * AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @brief Creates and run the first stage task. Only one pipeline runs at a time, so the end of the pipeline and
+     * the callback executor are kept by the request till the last stage
      * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Final or error stage executor
@@ -322,7 +316,9 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        _itEndStage = itEndStage;
+        _lastStageExecutor = callbackExecutor;
+        firstStageExecutor->run(MakeNextStageTask(itBeginStage));
     }
 
     /**
@@ -331,23 +327,13 @@ protected:
      * pipeline tasks
      */
     void StopAndWait() {
-        Futures futures;
-        InferState state = InferState::Idle;
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
-            state = _state;
-            if (state != InferState::Stop) {
-                _callback = {};
-                _state = InferState::Stop;
-                futures = std::move(_futures);
-            }
-        }
-        if (state != InferState::Stop) {
-            for (auto&& future : futures) {
-                if (future.valid()) {
-                    future.wait();
-                }
-            }
+        std::unique_lock<std::mutex> lock{_mutex};
+        if (_state != InferState::Stop) {
+            _callback = {};
+            _state = InferState::Stop;
+            _pipelineCompleted.wait(lock, [this] {
+                return _runningPipelines == 0;
+            });
         }
     }
 
@@ -383,78 +369,163 @@ protected:
 private:
     /**
      * @brief Create a task with next pipeline stage.
-     * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
-     * On last stage or if the exception is raised from `_pipeline` task
-     * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
+     * The task captures only the request and the stage iterator, so it is stored inside of @ref Task without
+     * a heap allocation and the steady state pipeline doesn't allocate memory.
      * @param[in]  itStage Iterator to next stage of pipeline
-     * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Executor that will run final stage with callback call
      * @return A next stage task
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage,
-                           const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind(
-            [this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
-                std::exception_ptr currentException = nullptr;
-                auto& thisStage = *itStage;
-                auto itNextStage = itStage + 1;
+    Task MakeNextStageTask(const Pipeline::iterator itStage) {
+        return [this, itStage] {
+            RunStage(itStage);
+        };
+    }
+
+    /**
+     * @brief Runs the stage and passes the next stage to its executor.
+     * On last stage or if the exception is raised from `_pipeline` task the last stage task is called or passed
+     * to callback executor if it is presented.
+     * @param[in]  itStage Iterator to the stage of pipeline
+     */
+    void RunStage(const Pipeline::iterator itStage) {
+        std::exception_ptr currentException = nullptr;
+        auto itNextStage = itStage + 1;
+        // The request may be restarted as soon as the next stage is passed to the executor
+        const bool isLastStage = (_itEndStage == itNextStage);
+        try {
+            auto& stageTask = std::get<Stage_e::task>(*itStage);
+            IE_ASSERT(nullptr != stageTask);
+            stageTask();
+            if (!isLastStage) {
+                auto& nextStageExecutor = std::get<Stage_e::executor>(*itNextStage);
+                IE_ASSERT(nullptr != nextStageExecutor);
+                nextStageExecutor->run(MakeNextStageTask(itNextStage));
+            }
+        } catch (...) {
+            currentException = std::current_exception();
+        }
+
+        if (isLastStage || (nullptr != currentException)) {
+            _stageException = std::move(currentException);
+            auto lastStageExecutor = _lastStageExecutor;
+            if (nullptr == lastStageExecutor) {
+                RunLastStage();
+            } else {
+                lastStageExecutor->run([this] {
+                    RunLastStage();
+                });
+            }
+        }
+    }
+
+    /**
+     * @brief The last stage calls the callback, if it is presented, and completes the pipeline with the exception of
+     * the stages or the callback. The waiting threads are notified under the lock, since the request can be destroyed
+     * as soon as the lock is released.
+     * @note The request is idle while the callback runs, so it can be restarted by the callback or by a thread which
+     * the callback notified. The callback is taken from the request for the call, so the last stage of the restarted
+     * pipeline which ends before the callback returns doesn't complete the pipeline: the request stays busy and the
+     * pipeline is completed with its own callback call after the running one returns. Hence the callback shouldn't
+     * wait for the pipeline it restarted. Once the request is stopped the callback isn't returned to it and the
+     * deferred pipeline is completed without the callback call, so the request can't be restarted while it is
+     * destroyed.
+     */
+    void RunLastStage() {
+        auto currentException = std::move(_stageException);
+        Callback callback;
+        std::uint64_t pipeline = 0;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            pipeline = _runningPipeline;
+            if (_callbackRunning && !_callbackDisabled) {
+                _deferredPipeline = pipeline;
+                _deferredException = std::move(currentException);
+                return;
+            }
+            SetIdle();
+            std::swap(callback, _callback);
+            _callbackRunning = _callbackRunning || static_cast<bool>(callback);
+        }
+        const bool callbackTaken = static_cast<bool>(callback);
+        std::unique_lock<std::mutex> lock{_mutex, std::defer_lock};
+        while (true) {
+            if (callback) {
                 try {
-                    auto& stageTask = std::get<Stage_e::task>(thisStage);
-                    IE_ASSERT(nullptr != stageTask);
-                    stageTask();
-                    if (itEndStage != itNextStage) {
-                        auto& nextStage = *itNextStage;
-                        auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
-                        IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
-                    }
+                    callback(currentException);
                 } catch (...) {
                     currentException = std::current_exception();
                 }
+            }
+            lock.lock();
+            const bool stopped = _state == InferState::Stop;
+            if (callback && !_callback && !stopped) {
+                std::swap(callback, _callback);
+            }
+            CompletePipeline(pipeline, std::move(currentException));
+            if (!callbackTaken || _deferredPipeline == 0) {
+                break;
+            }
+            // The pipeline restarted by the callback has ended while it was running
+            pipeline = _deferredPipeline;
+            currentException = std::move(_deferredException);
+            _deferredPipeline = 0;
+            if (stopped) {
+                // StopAndWait() has cleared the callback, the request is left stopped
+                CompletePipeline(pipeline, std::move(currentException));
+                break;
+            }
+            _state = InferState::Idle;
+            callback = {};
+            std::swap(callback, _callback);
+            lock.unlock();
+        }
+        if (callbackTaken) {
+            _callbackRunning = false;
+        }
+    }
 
-                if ((itEndStage == itNextStage) || (nullptr != currentException)) {
-                    auto lastStageTask = [this, currentException]() mutable {
-                        auto promise = std::move(_promise);
-                        Callback callback;
-                        {
-                            std::lock_guard<std::mutex> lock{_mutex};
-                            _state = InferState::Idle;
-                            std::swap(callback, _callback);
-                        }
-                        if (callback) {
-                            try {
-                                callback(currentException);
-                            } catch (...) {
-                                currentException = std::current_exception();
-                            }
-                            std::lock_guard<std::mutex> lock{_mutex};
-                            if (!_callback) {
-                                std::swap(callback, _callback);
-                            }
-                        }
-                        if (nullptr == currentException) {
-                            promise.set_value();
-                        } else {
-                            promise.set_exception(currentException);
-                        }
-                    };
-
-                    if (nullptr == callbackExecutor) {
-                        lastStageTask();
-                    } else {
-                        callbackExecutor->run(std::move(lastStageTask));
-                    }
-                }
-            },
-            std::move(callbackExecutor));
+    /**
+     * @brief Makes the request idle unless it is stopped, `_mutex` should be locked
+     */
+    void SetIdle() {
+        if (_state != InferState::Stop) {
+            _state = InferState::Idle;
+        }
+    }
+
+    /**
+     * @brief Marks the pipeline as completed and wakes up the waiting threads, `_mutex` should be locked
+     * @param[in]  pipeline The number of the pipeline
+     * @param[in]  exception The exception of the pipeline if any
+     */
+    void CompletePipeline(const std::uint64_t pipeline, std::exception_ptr exception) {
+        if (pipeline > _completedPipelines) {
+            _completedPipelines = pipeline;
+            _pipelineException = std::move(exception);
+        }
+        if (_runningPipelines > 0) {
+            --_runningPipelines;
+        }
+        _pipelineCompleted.notify_all();
     }
 
-    std::promise<void> _promise;
     mutable std::mutex _mutex;
-    Futures _futures;
+    std::condition_variable _pipelineCompleted;  //!< Notified on completion of every pipeline
+    std::uint64_t _startedPipelines = 0;         //!< The number of the last started pipeline
+    std::uint64_t _completedPipelines = 0;       //!< The number of the last completed pipeline
+    std::size_t _runningPipelines = 0;           //!< Started and not completed pipelines, awaited by StopAndWait
+    std::exception_ptr _pipelineException;       //!< The exception of the last completed pipeline
     InferState _state = InferState::Idle;
+
+    // The state of the running pipeline, reused by every start of the request
+    std::uint64_t _runningPipeline = 0;
+    Pipeline::iterator _itEndStage;
+    ITaskExecutor::Ptr _lastStageExecutor;
+    std::exception_ptr _stageException;
+
+    // The callback is taken by the last stage, the pipeline ended meanwhile is completed after the callback
+    bool _callbackRunning = false;
+    bool _callbackDisabled = false;  //!< The callback is disabled by the synchronous Infer
+    std::uint64_t _deferredPipeline = 0;
+    std::exception_ptr _deferredException;
 };
 }  // namespace InferenceEngine
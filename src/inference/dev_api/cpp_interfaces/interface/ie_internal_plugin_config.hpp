@@ -52,6 +52,104 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines the minimal rate of zero weights blocks starting from which FullyConnected constant fp32 weights are
+ * packed into block-sparse format and executed by sparse kernel. Float value in range [0, 1], 1 disables sparse kernel
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE);
+
+/**
+ * @brief Defines the time budget in milliseconds for empirical tuning of the number of streams and threads chosen by
+ * PERFORMANCE_HINT. The candidate configurations are compiled and benchmarked during LoadNetwork and the fastest one
+ * is used. Unsigned integer value, 0 (default) disables the tuning
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PERFORMANCE_HINT_TUNING_BUDGET);
+
+/**
+ * @brief Enables the global assignment of memory layouts in the CPU graph, which minimizes the amount of data moved
+ * by reorders over the whole graph instead of choosing the layouts node by node. Values are YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_GLOBAL_LAYOUT_ASSIGNMENT);
+
+/**
+ * @brief Enables the depth-first execution of convolution chains: the chains are split into horizontal bands which
+ * fit L2 cache and are computed one after another through the whole chain. Values are YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DEPTH_FIRST_TILING);
+
+/**
+ * @brief Defines the cache size in bytes the bands of CPU_DEPTH_FIRST_TILING are fit into. Unsigned integer value,
+ * 0 (default) means the per core L2 cache size of the host
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DEPTH_FIRST_TILING_CACHE_SIZE);
+
+/**
+ * @brief Enables the fusion of the attention pattern MatMul -> [Scale] -> [Add mask] -> Softmax -> MatMul into
+ * the single ScaledDotProductAttention node. The node has the reference kernel only, so the fusion is experimental.
+ * Values are YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SDPA_FUSION);
+
+/**
+ * @brief Enables the fusion of the input preprocessing (color conversion, resize, mean/scale and layout conversion)
+ * into the single FusedPreprocessing node. The node has the reference kernel only, so the fusion is experimental.
+ * Values are YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PREPROCESSING_FUSION);
+
+/**
+ * @brief Maps CPU graphs workspaces and constant data of 2 MB and larger with huge pages to reduce TLB misses.
+ * Values are NO (default), TRANSPARENT (madvise), 2MB and 1GB (hugetlbfs pages, the transparent huge pages and
+ * the regular pages are used if the hugetlbfs pool is exhausted)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+
+/**
+ * @brief Enables the pool of size classes for the CPU memory allocated during the inference (e.g. outputs of nodes
+ * with dynamic shapes), so the buffers are reused between inferences. Values are YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_POOL);
+
+/**
+ * @brief Executable network metric to get resident bytes of CPU graphs workspaces and constant data per NUMA node.
+ * The value type is std::map<int, uint64_t>, memory with unknown placement is accounted under -1 node id
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_NUMA_NODES_RESIDENT_BYTES = "CPU_NUMA_NODES_RESIDENT_BYTES";
+
+/**
+ * @brief Executable network metric to get bytes per inference, which CPU data movement nodes don't copy since their
+ * outputs are views on the input memory. The value type is uint64_t
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_VIEW_ELIMINATED_BYTES = "CPU_VIEW_ELIMINATED_BYTES";
+
+/**
+ * @brief Executable network metric to get bytes per inference, which are read and written by CPU reorders inserted
+ * between the nodes with different memory layouts or precisions. Reorders of constants are executed once and aren't
+ * accounted. The value type is uint64_t
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_REORDER_BYTES = "CPU_REORDER_BYTES";
+
+/**
+ * @brief Executable network metric to get statistics of the CPU memory allocated with KEY_CPU_HUGE_PAGES and
+ * KEY_CPU_MEMORY_POOL (allocated bytes, bytes mapped with huge pages, huge pages fallbacks, pool hits and misses,
+ * bytes bound to NUMA nodes and NUMA binding failures).
+ * The value type is std::map<std::string, uint64_t>, the map is empty if both options are disabled
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_MEMORY_ALLOCATION_STATS = "CPU_MEMORY_ALLOCATION_STATS";
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
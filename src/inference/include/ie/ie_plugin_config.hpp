@@ -219,6 +219,12 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric of the core (device name is empty) to get a number of LoadNetwork calls which returned
+ * already compiled network, see SHARE_COMPILED_MODELS config key. String value is "SHARED_COMPILED_MODELS_HITS"
+ */
+DECLARE_METRIC_KEY(SHARED_COMPILED_MODELS_HITS, uint64_t);
+
 }  // namespace Metrics
 
 /**
@@ -430,6 +436,32 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key defines the limit of the total size of compiled network blobs in the cache directory in bytes.
+ *
+ * When the limit is exceeded, the least recently used blobs are removed from the cache.
+ * Value is unsigned integer, 0 (default) means that the cache size is not limited
+ */
+DECLARE_CONFIG_KEY(CACHE_MAX_SIZE);
+
+/**
+ * @brief This key enables export of compiled network blobs to the cache in background.
+ *
+ * LoadNetwork returns the executable network without waiting for the export to the cache directory.
+ * Value is YES / NO (default)
+ */
+DECLARE_CONFIG_KEY(CACHE_ASYNC_EXPORT);
+
+/**
+ * @brief This key enables sharing of compiled networks between LoadNetwork calls of the same core.
+ *
+ * If a network with the same compilation config is loaded again while the network compiled before is alive,
+ * LoadNetwork returns the existing executable network instead of compiling or importing it one more time.
+ * Note that the configuration of the executable network (SetConfig) is shared as well.
+ * Value is YES / NO (default)
+ */
+DECLARE_CONFIG_KEY(SHARE_COMPILED_MODELS);
+
 }  // namespace PluginConfigParams
 
 /**
@@ -42,5 +42,38 @@ DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
  * is not 0, the network will be dispatched to the strongest device.
  */
 DECLARE_CONFIG_KEY(AUTO_NETWORK_PRIORITY);
+
+/**
+ * @brief Scheduling policy config option, defines how the MULTI device distributes the inferences among devices:
+ * MULTI_SCHEDULING_PRIORITY (default) - the inference goes to the first device in the priority list which has an idle
+ * infer request,
+ * MULTI_SCHEDULING_LATENCY - the inference goes to the device with the lowest expected completion time, which is
+ * estimated from the moving average of the inference latency and the number of inferences in flight on the device
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(SCHEDULING_PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(SCHEDULING_LATENCY);
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric of the MULTI executable network to get a std::map<std::string, uint64_t> of the number of inferences
+ * dispatched to each device, String value is METRIC_MULTI_DEVICE_DISPATCHED_INFERENCES
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_DEVICE_DISPATCHED_INFERENCES, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric of the MULTI executable network to get a std::map<std::string, float> of the exponentially weighted
+ * moving average of the inference latency (in milliseconds) on each device, String value is
+ * METRIC_MULTI_DEVICE_INFERENCE_LATENCY
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_DEVICE_INFERENCE_LATENCY, std::map<std::string, float>);
+
+/**
+ * @brief Metric of the MULTI executable network to get a std::map<std::string, int> of the number of inferences in
+ * flight on each device, String value is METRIC_MULTI_DEVICE_INFERENCES_IN_FLIGHT
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_DEVICE_INFERENCES_IN_FLIGHT, std::map<std::string, int>);
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides ov::CompletionQueue
+ * @file openvino/runtime/completion_queue.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <vector>
+
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/infer_request.hpp"
+
+namespace ov {
+
+/**
+ * @brief Queue of completed asynchronous inferences of many infer requests.
+ * A request bound to the queue reports every completion to the queue instead of a user callback, so a server thread
+ * can harvest completed requests in batches instead of handling each of them on the callback executor.
+ * Requests are identified by the tags passed to CompletionQueue::bind.
+ * @note All methods are thread safe. Copies of the object refer to the same queue.
+ */
+class OPENVINO_RUNTIME_API CompletionQueue {
+public:
+    /**
+     * @brief Completed inference of a bound request
+     */
+    struct Completion {
+        void* tag = nullptr;           //!< The tag the request was bound with
+        std::exception_ptr exception;  //!< The exception of the failed inference, nullptr on success
+    };
+
+    /**
+     * @brief Creates an empty queue
+     */
+    CompletionQueue();
+
+    /**
+     * @brief Binds the request to the queue: every completion of InferRequest::start_async is pushed to the queue.
+     * @note The callback of the request is replaced, the request can be bound to only one queue. The queue is kept
+     * alive by the bound requests. The request is idle when its completion is in the queue, so the harvesting thread
+     * can restart it without InferRequest::wait.
+     * @param request The request to bind
+     * @param tag The tag to identify completions of the request
+     */
+    void bind(InferRequest& request, void* tag);
+
+    /**
+     * @brief Waits for a completion and removes it from the queue
+     * @param completion The completion taken from the queue
+     * @return false if the queue is shut down and has no completions, true otherwise
+     */
+    bool wait_any(Completion& completion);
+
+    /**
+     * @brief Waits for a completion for the timeout and removes it from the queue
+     * @param completion The completion taken from the queue
+     * @param timeout Maximum duration in milliseconds to block for
+     * @return true if the completion is taken, false otherwise
+     */
+    bool wait_any_for(Completion& completion, const std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Takes the available completions without blocking
+     * @param completions The vector to append the taken completions to
+     * @param max_count Maximum number of completions to take
+     * @return The number of the taken completions
+     */
+    size_t poll(std::vector<Completion>& completions, size_t max_count);
+
+    /**
+     * @brief Returns the number of completions in the queue
+     */
+    size_t size() const;
+
+    /**
+     * @brief Wakes up all waiting threads, CompletionQueue::wait_any returns false as soon as the queue is empty.
+     * Completions of the bound requests are still pushed to the queue.
+     */
+    void shutdown();
+
+private:
+    class Impl;
+    std::shared_ptr<Impl> _impl;
+};
+
+}  // namespace ov
@@ -368,6 +368,32 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief This property defines the limit of the total size of compiled model blobs in the cache directory in bytes.
+ *
+ * When the limit is exceeded, the least recently used blobs are removed from the cache. 0 (default) means no limit
+ */
+static constexpr Property<uint64_t> cache_max_size{"CACHE_MAX_SIZE"};
+
+/**
+ * @brief This property enables export of compiled model blobs to the cache in background, so compile_model returns
+ * the compiled model without waiting for the export
+ */
+static constexpr Property<bool> cache_async_export{"CACHE_ASYNC_EXPORT"};
+
+/**
+ * @brief This property enables sharing of compiled models between compile_model calls of the same core
+ *
+ * If a model with the same properties is compiled again while the model compiled before is alive, compile_model
+ * returns the existing compiled model
+ */
+static constexpr Property<bool> share_compiled_models{"SHARE_COMPILED_MODELS"};
+
+/**
+ * @brief Read-only property of the core to get a number of compile_model calls which returned already compiled model
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> shared_compiled_models_hits{"SHARED_COMPILED_MODELS_HITS"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  *
@@ -10,4 +10,5 @@
 
 #pragma once
 
+#include "openvino/runtime/completion_queue.hpp"
 #include "openvino/runtime/core.hpp"
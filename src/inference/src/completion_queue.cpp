@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/completion_queue.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+namespace ov {
+
+/**
+ * The completions are kept in a vector with the read position, so the memory is reused once the queue is drained and
+ * a steady flow of completions doesn't allocate.
+ */
+class CompletionQueue::Impl {
+public:
+    void push(void* tag, std::exception_ptr exception) {
+        Completion completion;
+        completion.tag = tag;
+        completion.exception = std::move(exception);
+        std::lock_guard<std::mutex> lock{_mutex};
+        _completions.push_back(std::move(completion));
+        _completed.notify_one();
+    }
+
+    bool wait_any(Completion& completion) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _completed.wait(lock, [this] {
+            return available() > 0 || _shutdown;
+        });
+        return take(completion);
+    }
+
+    bool wait_any_for(Completion& completion, const std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _completed.wait_for(lock, timeout, [this] {
+            return available() > 0 || _shutdown;
+        });
+        return take(completion);
+    }
+
+    size_t poll(std::vector<Completion>& completions, size_t max_count) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        const auto count = std::min(available(), max_count);
+        const auto begin = _completions.begin() + _head;
+        completions.insert(completions.end(), std::make_move_iterator(begin), std::make_move_iterator(begin + count));
+        _head += count;
+        reclaim();
+        return count;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return available();
+    }
+
+    void shutdown() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _shutdown = true;
+        _completed.notify_all();
+    }
+
+private:
+    size_t available() const {
+        return _completions.size() - _head;
+    }
+
+    // `_mutex` should be locked
+    bool take(Completion& completion) {
+        if (available() == 0) {
+            return false;
+        }
+        completion = std::move(_completions[_head++]);
+        reclaim();
+        return true;
+    }
+
+    // Drops the taken completions once the most of the vector is taken, the capacity is kept
+    void reclaim() {
+        if (_head == _completions.size()) {
+            _completions.clear();
+            _head = 0;
+        } else if (_head > _completions.size() / 2) {
+            _completions.erase(_completions.begin(), _completions.begin() + _head);
+            _head = 0;
+        }
+    }
+
+    mutable std::mutex _mutex;
+    std::condition_variable _completed;
+    std::vector<Completion> _completions;
+    size_t _head = 0;
+    bool _shutdown = false;
+};
+
+CompletionQueue::CompletionQueue() : _impl{std::make_shared<Impl>()} {}
+
+void CompletionQueue::bind(InferRequest& request, void* tag) {
+    // The callback runs at the last stage of the request pipeline, it only pushes the completion to the queue
+    std::shared_ptr<Impl> impl = _impl;
+    request.set_callback([impl, tag](std::exception_ptr exception) {
+        impl->push(tag, std::move(exception));
+    });
+}
+
+bool CompletionQueue::wait_any(Completion& completion) {
+    return _impl->wait_any(completion);
+}
+
+bool CompletionQueue::wait_any_for(Completion& completion, const std::chrono::milliseconds timeout) {
+    return _impl->wait_any_for(completion, timeout);
+}
+
+size_t CompletionQueue::poll(std::vector<Completion>& completions, size_t max_count) {
+    return _impl->poll(completions, max_count);
+}
+
+size_t CompletionQueue::size() const {
+    return _impl->size();
+}
+
+void CompletionQueue::shutdown() {
+    _impl->shutdown();
+}
+
+}  // namespace ov
@@ -0,0 +1,205 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+
+#include "openvino/util/file_util.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+int64_t currentTime() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+// Unique name of a temporary file in the same directory as the target file
+std::string makeTemporaryFile(const std::string& fileName) {
+    static std::atomic<uint64_t> counter{0};
+    std::stringstream ss;
+    ss << fileName << "." << std::this_thread::get_id() << "." << currentTime() << "." << counter++ << ".tmp";
+    return ss.str();
+}
+
+// Replaces the target file by the temporary one, the temporary file is removed on failure
+bool commitTemporaryFile(const std::string& tmpFileName, const std::string& fileName) {
+    if (std::rename(tmpFileName.c_str(), fileName.c_str()) == 0)
+        return true;
+    // rename doesn't replace existing file on Windows
+    std::remove(fileName.c_str());
+    if (std::rename(tmpFileName.c_str(), fileName.c_str()) == 0)
+        return true;
+    std::remove(tmpFileName.c_str());
+    return false;
+}
+
+}  // namespace
+
+FileStorageCacheManager::FileStorageCacheManager(std::string&& cachePath, uint64_t maxSize)
+    : m_cachePath(std::move(cachePath)),
+      m_maxSize(maxSize) {
+    if (m_maxSize != 0) {
+        std::lock_guard<std::mutex> lock(m_indexMutex);
+        loadIndex();
+        evictEntries({});
+        saveIndex();
+    }
+}
+
+void FileStorageCacheManager::loadIndex() {
+    // the index may be updated by other processes sharing the cache directory, so it's merged with the current state
+    std::ifstream stream(getIndexFile());
+    std::string id;
+    IndexEntry entry;
+    while (stream >> id >> entry.size >> entry.lastAccess) {
+        auto it = m_index.find(id);
+        if (it == m_index.end()) {
+            m_index[id] = entry;
+        } else {
+            it->second.lastAccess = std::max(it->second.lastAccess, entry.lastAccess);
+        }
+    }
+
+    for (auto it = m_index.begin(); it != m_index.end();) {
+        if (FileUtils::fileExist(getBlobFile(it->first)))
+            ++it;
+        else
+            it = m_index.erase(it);
+    }
+
+    // blobs written without the size limit or by older versions aren't indexed, they are tracked as the least
+    // recently used ones, so the limit accounts them and they are evicted first
+    const std::string blobExt = ".blob";
+    try {
+        ov::util::iterate_files(m_cachePath, [&](const std::string& file, bool isDir) {
+            if (isDir || file.size() <= blobExt.size() ||
+                file.compare(file.size() - blobExt.size(), blobExt.size(), blobExt) != 0)
+                return;
+            const auto fileName = file.substr(file.find_last_of("/\\") + 1);
+            const auto id = fileName.substr(0, fileName.size() - blobExt.size());
+            if (m_index.count(id) == 0) {
+                auto& entry = m_index[id];
+                entry.size = static_cast<uint64_t>(FileUtils::fileSize(file));
+                entry.lastAccess = 0;
+            }
+        });
+    } catch (const std::runtime_error&) {
+        // the cache directory can't be listed, only the indexed blobs are accounted
+    }
+}
+
+void FileStorageCacheManager::saveIndex() const {
+    const auto indexFileName = getIndexFile();
+    const auto tmpFileName = makeTemporaryFile(indexFileName);
+    {
+        std::ofstream stream(tmpFileName);
+        for (const auto& entry : m_index)
+            stream << entry.first << " " << entry.second.size << " " << entry.second.lastAccess << "\n";
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpFileName.c_str());
+            return;
+        }
+    }
+    commitTemporaryFile(tmpFileName, indexFileName);
+}
+
+void FileStorageCacheManager::updateIndex(const std::string& id, uint64_t size) {
+    loadIndex();
+    auto& entry = m_index[id];
+    entry.size = size;
+    entry.lastAccess = currentTime();
+}
+
+void FileStorageCacheManager::evictEntries(const std::string& keepId) {
+    uint64_t totalSize = 0;
+    for (const auto& entry : m_index)
+        totalSize += entry.second.size;
+
+    // the blob which has been just written or read is never evicted, even if it exceeds the limit alone
+    while (totalSize > m_maxSize) {
+        auto lru = m_index.end();
+        for (auto it = m_index.begin(); it != m_index.end(); ++it) {
+            if (it->first != keepId && (lru == m_index.end() || it->second.lastAccess < lru->second.lastAccess))
+                lru = it;
+        }
+        if (lru == m_index.end())
+            break;
+
+        std::remove(getBlobFile(lru->first).c_str());
+        totalSize -= lru->second.size;
+        m_index.erase(lru);
+    }
+}
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    const auto blobFileName = getBlobFile(id);
+    const auto tmpFileName = makeTemporaryFile(blobFileName);
+    {
+        std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+        try {
+            writer(stream);
+        } catch (...) {
+            stream.close();
+            std::remove(tmpFileName.c_str());
+            throw;
+        }
+        stream.flush();
+        if (!stream.good()) {
+            // e.g. there is no space left, the network is just not cached
+            stream.close();
+            std::remove(tmpFileName.c_str());
+            return;
+        }
+    }
+    if (!commitTemporaryFile(tmpFileName, blobFileName))
+        return;
+
+    if (m_maxSize != 0) {
+        std::lock_guard<std::mutex> lock(m_indexMutex);
+        updateIndex(id, static_cast<uint64_t>(FileUtils::fileSize(blobFileName)));
+        evictEntries(id);
+        saveIndex();
+    }
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName)) {
+        {
+            std::ifstream stream(blobFileName, std::ios_base::binary);
+            reader(stream);
+        }
+
+        if (m_maxSize != 0) {
+            std::lock_guard<std::mutex> lock(m_indexMutex);
+            updateIndex(id, static_cast<uint64_t>(FileUtils::fileSize(blobFileName)));
+            saveIndex();
+        }
+    }
+}
+
+void FileStorageCacheManager::removeCacheEntry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+
+    if (m_maxSize != 0) {
+        std::lock_guard<std::mutex> lock(m_indexMutex);
+        loadIndex();
+        m_index.erase(id);
+        saveIndex();
+    }
+}
+
+}  // namespace InferenceEngine
@@ -11,7 +11,9 @@
 
 #include <fstream>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "file_utils.h"
@@ -75,22 +77,44 @@ public:
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
- * Uses simple file for read/write cached models.
+ * Uses simple file for read/write cached models. A blob is written to a temporary file first and renamed
+ * when it's completed, so a partially written blob is never visible to readers.
+ * If the size limit is set, the least recently used blobs are evicted, blob sizes and access times are tracked
+ * in the index file of the cache directory. Blobs of the directory which aren't in the index are accounted as
+ * the least recently used ones.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
+    struct IndexEntry {
+        uint64_t size = 0;
+        int64_t lastAccess = 0;
+    };
+
     std::string m_cachePath;
+    uint64_t m_maxSize = 0;
+    std::mutex m_indexMutex;
+    std::map<std::string, IndexEntry> m_index;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    std::string getIndexFile() const {
+        return FileUtils::makePath(m_cachePath, std::string("cache.index"));
+    }
+
+    void loadIndex();
+    void saveIndex() const;
+    void updateIndex(const std::string& id, uint64_t size);
+    void evictEntries(const std::string& keepId);
+
 public:
     /**
      * @brief Constructor
-     *
+     * @param cachePath Path to the cache directory
+     * @param maxSize Limit of the total size of cached blobs in bytes, 0 means no limit
      */
-    FileStorageCacheManager(std::string&& cachePath) : m_cachePath(std::move(cachePath)) {}
+    explicit FileStorageCacheManager(std::string&& cachePath, uint64_t maxSize = 0);
 
     /**
      * @brief Destructor
@@ -99,24 +123,11 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
 
-    void removeCacheEntry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
-    }
+    void removeCacheEntry(const std::string& id) override;
 };
 
 }  // namespace InferenceEngine
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_compiled_model_registry.hpp"
+
+namespace InferenceEngine {
+
+ov::SoPtr<IExecutableNetworkInternal> CompiledModelRegistry::find(const std::string& hash) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(hash);
+    if (it == m_entries.end())
+        return {};
+
+    ov::SoPtr<IExecutableNetworkInternal> network;
+    network._ptr = it->second.m_network.lock();
+    network._so = it->second.m_so.lock();
+    // plugins which are linked statically have no shared object
+    if (!network._ptr || (it->second.m_hasSo && !network._so)) {
+        m_entries.erase(it);
+        return {};
+    }
+    m_hits++;
+    return network;
+}
+
+void CompiledModelRegistry::add(const std::string& hash, const ov::SoPtr<IExecutableNetworkInternal>& network) {
+    if (!network._ptr)
+        return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    removeExpired();
+    m_entries[hash] = Entry{network._ptr, network._so, network._so != nullptr};
+}
+
+void CompiledModelRegistry::removeExpired() {
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->second.m_network.expired())
+            it = m_entries.erase(it);
+        else
+            ++it;
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+/**
+ * @brief This is a header file for the Inference Engine Compiled Model Registry class
+ *
+ * @file ie_compiled_model_registry.hpp
+ */
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
+#include "so_ptr.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief This class holds weak references to the networks compiled by the Inference Engine core
+ * The networks are identified by the hash of the network and its compilation config, so loading of the same
+ * network with the same config returns already compiled network while it is alive in the process.
+ * The registry doesn't prolong the lifetime of the networks: the entries expire together with the networks.
+ *
+ * Usage example:
+ *     auto hash = <calculate hash for network>;
+ *     auto lock = m_cacheGuard.getHashLock(hash);
+ *     auto network = m_registry.find(hash);
+ *     if (!network._ptr) {
+ *         network = <compile network>;
+ *         m_registry.add(hash, network);
+ *     }
+ */
+class CompiledModelRegistry {
+public:
+    /**
+     * @brief Looks for alive compiled network
+     *
+     * @param hash String representing hash of network
+     *
+     * @return The compiled network or empty pointer if there is no alive network with such hash
+     */
+    ov::SoPtr<IExecutableNetworkInternal> find(const std::string& hash);
+
+    /**
+     * @brief Registers compiled network, the registry keeps only weak reference to it
+     *
+     * @param hash String representing hash of network
+     * @param network The compiled network
+     */
+    void add(const std::string& hash, const ov::SoPtr<IExecutableNetworkInternal>& network);
+
+    /**
+     * @brief Returns number of loads which returned already compiled network
+     */
+    uint64_t getHits() const {
+        return m_hits.load();
+    }
+
+private:
+    struct Entry {
+        std::weak_ptr<IExecutableNetworkInternal> m_network;
+        std::weak_ptr<void> m_so;
+        bool m_hasSo;
+    };
+
+    void removeExpired();
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    std::atomic<uint64_t> m_hits{0};
+};
+
+}  // namespace InferenceEngine
@@ -6,6 +6,11 @@
 
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -22,6 +27,7 @@
 #include "file_utils.h"
 #include "ie_cache_guard.hpp"
 #include "ie_cache_manager.hpp"
+#include "ie_compiled_model_registry.hpp"
 #include "ie_icore.hpp"
 #include "ie_itt.hpp"
 #include "ie_network_reader.hpp"
@@ -38,6 +44,7 @@
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/log.hpp"
 #include "openvino/util/shared_object.hpp"
 #include "so_extension.hpp"
 #include "xml_parse_utils.h"
@@ -141,21 +148,68 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     public:
         struct CacheConfig {
             std::string _cacheDir;
+            uint64_t _cacheMaxSize = 0;
+            bool _asyncExport = false;
             std::shared_ptr<ie::ICacheManager> _cacheManager;
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            bool updateCacheManager = false;
+
             auto it = config.find(CONFIG_KEY(CACHE_DIR));
             if (it != config.end()) {
-                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
                 _cacheConfig._cacheDir = it->second;
-                if (!it->second.empty()) {
-                    FileUtils::createDirectoryRecursive(it->second);
-                    _cacheConfig._cacheManager = std::make_shared<ie::FileStorageCacheManager>(std::move(it->second));
+                updateCacheManager = true;
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_MAX_SIZE));
+            if (it != config.end()) {
+                try {
+                    _cacheConfig._cacheMaxSize = std::stoull(it->second);
+                } catch (const std::exception&) {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY(CACHE_MAX_SIZE)
+                               << ". Expected only unsigned integer numbers";
+                }
+                updateCacheManager = true;
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_ASYNC_EXPORT));
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES)) {
+                    _cacheConfig._asyncExport = true;
+                } else if (it->second == CONFIG_VALUE(NO)) {
+                    _cacheConfig._asyncExport = false;
+                } else {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY(CACHE_ASYNC_EXPORT)
+                               << ". Expected only YES/NO";
+                }
+                config.erase(it);
+            }
+
+            if (updateCacheManager) {
+                if (!_cacheConfig._cacheDir.empty()) {
+                    FileUtils::createDirectoryRecursive(_cacheConfig._cacheDir);
+                    _cacheConfig._cacheManager =
+                        std::make_shared<ie::FileStorageCacheManager>(std::string(_cacheConfig._cacheDir),
+                                                                      _cacheConfig._cacheMaxSize);
                 } else {
                     _cacheConfig._cacheManager = nullptr;
                 }
+            }
 
+            it = config.find(CONFIG_KEY(SHARE_COMPILED_MODELS));
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES)) {
+                    _shareCompiledModels = true;
+                } else if (it->second == CONFIG_VALUE(NO)) {
+                    _shareCompiledModels = false;
+                } else {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY(SHARE_COMPILED_MODELS)
+                               << ". Expected only YES/NO";
+                }
                 config.erase(it);
             }
         }
@@ -166,9 +220,14 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             return _cacheConfig;
         }
 
+        bool shareCompiledModels() const {
+            return _shareCompiledModels;
+        }
+
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic<bool> _shareCompiledModels{false};
     };
 
     // Core settings (cache config, etc)
@@ -176,6 +235,40 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
     ie::CacheGuard cacheGuard;
 
+    // Alive networks which can be returned by LoadNetwork again (SHARE_COMPILED_MODELS)
+    ie::CompiledModelRegistry compiledModels;
+
+    // Exports of compiled networks to the cache which are run in background (CACHE_ASYNC_EXPORT)
+    class AsyncExports {
+    public:
+        void run(std::function<void()> task) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pending.erase(std::remove_if(_pending.begin(),
+                                          _pending.end(),
+                                          [](const std::future<void>& f) {
+                                              return f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                                          }),
+                           _pending.end());
+            _pending.emplace_back(std::async(std::launch::async, std::move(task)));
+        }
+
+        void wait() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto& f : _pending)
+                f.wait();
+            _pending.clear();
+        }
+
+        ~AsyncExports() {
+            wait();
+        }
+
+    private:
+        std::mutex _mutex;
+        std::vector<std::future<void>> _pending;
+    };
+    AsyncExports asyncExports;
+
     struct PluginDescriptor {
         ov::util::FilePath libraryLocation;
         std::map<std::string, std::string> defaultConfig;
@@ -257,20 +350,40 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         ov::SoPtr<ie::IExecutableNetworkInternal> execNetwork;
         execNetwork = context ? plugin.compile_model(network, context, parsedConfig)
                               : plugin.compile_model(network, parsedConfig);
-        auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
+        auto cacheConfig = coreConfig.getCacheConfig();
+        auto cacheManager = cacheConfig._cacheManager;
         if (!forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin)) {
-            try {
-                // need to export network for further import from "cache"
-                OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Export");
-                cacheManager->writeCacheEntry(blobID, [&](std::ostream& networkStream) {
-                    networkStream << ie::CompiledBlobHeader(
-                        ie::GetInferenceEngineVersion()->buildNumber,
-                        ie::NetworkCompilationContext::calculateFileInfo(modelPath));
-                    execNetwork->Export(networkStream);
+            auto exportNetwork = [cacheManager, execNetwork, blobID, modelPath]() {
+                try {
+                    // need to export network for further import from "cache"
+                    OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Export");
+                    cacheManager->writeCacheEntry(blobID, [&](std::ostream& networkStream) {
+                        networkStream << ie::CompiledBlobHeader(
+                            ie::GetInferenceEngineVersion()->buildNumber,
+                            ie::NetworkCompilationContext::calculateFileInfo(modelPath));
+                        execNetwork->Export(networkStream);
+                    });
+                } catch (...) {
+                    cacheManager->removeCacheEntry(blobID);
+                    throw;
+                }
+            };
+            if (cacheConfig._asyncExport) {
+                // the network is cached in background, export failure just means that the network isn't cached.
+                // The entry is locked as in the synchronous case, so the loads of the same network wait for the
+                // export and the failure cleanup can't remove a blob written by another export
+                asyncExports.run([this, exportNetwork, blobID] {
+                    auto lock = cacheGuard.getHashLock(blobID);
+                    try {
+                        exportNetwork();
+                    } catch (const std::exception& ex) {
+                        OPENVINO_WARN << "Failed to export compiled network " << blobID << " to cache: " << ex.what();
+                    } catch (...) {
+                        OPENVINO_WARN << "Failed to export compiled network " << blobID << " to cache";
+                    }
                 });
-            } catch (...) {
-                cacheManager->removeCacheEntry(blobID);
-                throw;
+            } else {
+                exportNetwork();
             }
         }
         return execNetwork;
@@ -388,7 +501,10 @@ public:
         opsetNames.insert("opset8");
     }
 
-    ~CoreImpl() override = default;
+    ~CoreImpl() override {
+        // background exports use the plugins, so they must be finished before the plugins are unloaded
+        asyncExports.wait();
+    }
 
     /**
      * @brief Register plugins for devices which are located in .xml configuration file.
@@ -623,17 +739,27 @@ public:
         auto plugin = GetCPPPluginByName(parsed._deviceName);
         ov::SoPtr<ie::IExecutableNetworkInternal> res;
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
-        if (!forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin)) {
+        const bool cacheEnabled = !forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin);
+        const bool shareEnabled = !forceDisableCache && coreConfig.shareCompiledModels();
+        if (cacheEnabled || shareEnabled) {
             auto hash = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
-            bool loadedFromCache = false;
             auto lock = cacheGuard.getHashLock(hash);
-            res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
+            if (shareEnabled) {
+                res = compiledModels.find(hash);
+                if (res._ptr)
+                    return {res._ptr, res._so};
+            }
+            bool loadedFromCache = false;
+            if (cacheEnabled)
+                res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
             if (!loadedFromCache) {
                 res = compile_model_impl(network, plugin, parsed._config, nullptr, hash, {}, forceDisableCache);
             } else {
                 // Temporary workaround until all plugins support caching of original model inputs
                 InferenceEngine::SetExeNetworkInfo(res._ptr, network.getFunction(), isNewAPI());
             }
+            if (shareEnabled)
+                compiledModels.add(hash, res);
         } else {
             res = compile_model_impl(network, plugin, parsed._config, nullptr, {}, {}, forceDisableCache);
         }
@@ -648,15 +774,31 @@ public:
         auto plugin = GetCPPPluginByName(parsed._deviceName);
         ov::SoPtr<ie::IExecutableNetworkInternal> res;
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
-        if (cacheManager && DeviceSupportsImportExport(plugin)) {
+        const bool cacheEnabled = cacheManager && DeviceSupportsImportExport(plugin);
+        const bool shareEnabled = coreConfig.shareCompiledModels();
+        if (cacheEnabled || shareEnabled) {
             bool loadedFromCache = false;
             auto hash = CalculateFileHash(modelPath, parsed._deviceName, plugin, parsed._config);
             auto lock = cacheGuard.getHashLock(hash);
-            res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache, modelPath);
+            // the model file may be changed while the network compiled from it is alive
+            const auto sharedHash = hash + "_" + ie::NetworkCompilationContext::calculateFileInfo(modelPath);
+            if (shareEnabled) {
+                res = compiledModels.find(sharedHash);
+                if (res._ptr)
+                    return {res._ptr, res._so};
+            }
+            if (cacheEnabled)
+                res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache, modelPath);
             if (!loadedFromCache) {
-                auto cnnNetwork = ReadNetwork(modelPath, std::string());
-                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, hash, modelPath);
+                if (cacheManager && !cacheEnabled) {
+                    res = plugin.compile_model(modelPath, parsed._config);
+                } else {
+                    auto cnnNetwork = ReadNetwork(modelPath, std::string());
+                    res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, hash, modelPath);
+                }
             }
+            if (shareEnabled)
+                compiledModels.add(sharedHash, res);
         } else if (cacheManager) {
             res = plugin.compile_model(modelPath, parsed._config);
         } else {
@@ -793,6 +935,11 @@ public:
             }
         }
 
+        // metrics of the core itself
+        if (deviceName.empty() && name == METRIC_KEY(SHARED_COMPILED_MODELS_HITS)) {
+            return compiledModels.getHits();
+        }
+
         auto parsed = parseDeviceNameIntoConfig(deviceName);
         for (auto o : options) {
             parsed._config.insert(o);
@@ -1790,6 +1937,9 @@ Any Core::get_property(const std::string& deviceName, const std::string& name) c
                     "get_config is also possible for the individual devices before creating the AUTO on top.");
 
     OV_CORE_CALL_STATEMENT({
+        if (deviceName.empty() && ov::shared_compiled_models_hits == name) {
+            return _impl->GetMetric(deviceName, name);
+        }
         auto parsed = parseDeviceNameIntoConfig(deviceName);
         if (ov::supported_properties == name) {
             try {
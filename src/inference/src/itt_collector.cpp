@@ -0,0 +1,217 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "itt_collector.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace openvino {
+namespace itt {
+namespace internal {
+
+namespace {
+
+constexpr const char* firstInferenceReportEnv = "OV_FIRST_INFERENCE_REPORT";
+
+// Index of the open task which is dropped because of the tasks limit
+constexpr size_t droppedTask = std::numeric_limits<size_t>::max();
+
+// Indices of the open tasks of the current thread for every collector
+thread_local std::unordered_map<const Collector*, std::vector<size_t>> openTasks;
+
+int64_t collectorNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void escapeJson(std::ostream& stream, const char* str) {
+    for (; *str; ++str) {
+        const char c = *str;
+        if (c == '"' || c == '\\') {
+            stream << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", c);
+            stream << code;
+        } else {
+            stream << c;
+        }
+    }
+}
+
+// Writes the report of the process collector when the openvino library is unloaded. The collector itself is never
+// destroyed, as the other modules may still end their tasks at that time.
+struct ReportWriter {
+    ~ReportWriter() {
+        if (auto collector = Collector::instance())
+            collector->write();
+    }
+} reportWriter;
+
+}  // namespace
+
+Collector::Collector(std::string path, size_t maxTasks) : path(std::move(path)), maxTasks(maxTasks) {}
+
+Collector* Collector::instance() {
+    static Collector* collector = []() -> Collector* {
+        const char* path = std::getenv(firstInferenceReportEnv);
+        if (path == nullptr || *path == '\0') {
+            return nullptr;
+        }
+        return new Collector(path);
+    }();
+    return collector;
+}
+
+const char* Collector::name(const char* name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return names.emplace(name ? name : "").first->c_str();
+}
+
+void Collector::taskBegin(const char* name) {
+    const auto begin = collectorNow();
+    size_t index = droppedTask;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // Tasks are stored at the begin, so the limit drops the latest tasks and keeps the parents of the stored ones
+        if (tasks.size() < maxTasks) {
+            const auto thread = threads.emplace(std::this_thread::get_id(), threads.size()).first->second;
+            tasks.push_back({name, thread, begin, -1});
+            index = tasks.size() - 1;
+        }
+    }
+    openTasks[this].push_back(index);
+}
+
+void Collector::taskEnd() {
+    const auto end = collectorNow();
+    auto& open = openTasks[this];
+    if (open.empty()) {
+        return;
+    }
+    const auto index = open.back();
+    open.pop_back();
+    if (index == droppedTask) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks[index].end = end;
+}
+
+void Collector::write() const {
+    const auto writeTime = collectorNow();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (tasks.empty()) {
+        return;
+    }
+
+    std::vector<Task> sorted(tasks.begin(), tasks.end());
+    for (auto& task : sorted) {
+        if (task.end < 0) {
+            task.end = writeTime;
+        }
+    }
+    // Parents go before their children: the earlier begin first, the longer task first for the same begin
+    std::sort(sorted.begin(), sorted.end(), [](const Task& a, const Task& b) {
+        if (a.thread != b.thread)
+            return a.thread < b.thread;
+        if (a.begin != b.begin)
+            return a.begin < b.begin;
+        return a.end > b.end;
+    });
+
+    const auto origin = std::min_element(sorted.begin(), sorted.end(), [](const Task& a, const Task& b) {
+        return a.begin < b.begin;
+    })->begin;
+    const auto finish = std::max_element(sorted.begin(), sorted.end(), [](const Task& a, const Task& b) {
+        return a.end < b.end;
+    })->end;
+
+    // Nesting of the tasks is restored by their time intervals, the tasks of one thread are always properly nested
+    std::vector<std::vector<size_t>> children(sorted.size());
+    std::vector<std::vector<size_t>> roots(threads.size());
+    std::vector<size_t> stack;
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        if (i > 0 && sorted[i].thread != sorted[i - 1].thread) {
+            stack.clear();
+        }
+        while (!stack.empty() && sorted[stack.back()].end <= sorted[i].begin) {
+            stack.pop_back();
+        }
+        (stack.empty() ? roots[sorted[i].thread] : children[stack.back()]).push_back(i);
+        stack.push_back(i);
+    }
+
+    std::ofstream stream(path);
+    if (!stream.is_open()) {
+        return;
+    }
+    stream.precision(3);
+    stream << std::fixed;
+
+    const auto us = [](int64_t ns) {
+        return static_cast<double>(ns) / 1000.0;
+    };
+    std::function<void(size_t, size_t)> writeTask = [&](size_t index, size_t depth) {
+        const auto& task = sorted[index];
+        stream << std::string(depth * 2, ' ') << "{\"name\": \"";
+        escapeJson(stream, task.name);
+        stream << "\", \"value\": " << us(task.end - task.begin) << ", \"start\": " << us(task.begin - origin)
+               << ", \"children\": [";
+        for (size_t i = 0; i < children[index].size(); ++i) {
+            stream << (i == 0 ? "\n" : ",\n");
+            writeTask(children[index][i], depth + 1);
+        }
+        stream << "]}";
+    };
+
+    stream << "{\"name\": \"first_inference\", \"value\": " << us(finish - origin) << ", \"start\": 0.000"
+           << ", \"children\": [";
+    bool firstThread = true;
+    for (size_t thread = 0; thread < roots.size(); ++thread) {
+        if (roots[thread].empty()) {
+            continue;
+        }
+        const auto begin = sorted[roots[thread].front()].begin;
+        int64_t end = begin;
+        for (const auto root : roots[thread]) {
+            end = std::max(end, sorted[root].end);
+        }
+        stream << (firstThread ? "\n" : ",\n") << "  {\"name\": \"thread_" << thread << "\", \"value\": "
+               << us(end - begin) << ", \"start\": " << us(begin - origin) << ", \"children\": [";
+        firstThread = false;
+        for (size_t i = 0; i < roots[thread].size(); ++i) {
+            stream << (i == 0 ? "\n" : ",\n");
+            writeTask(roots[thread][i], 2);
+        }
+        stream << "]}";
+    }
+    stream << "]}\n";
+}
+
+const char* collectorName(const char* name) {
+    auto collector = Collector::instance();
+    return collector ? collector->name(name) : nullptr;
+}
+
+void collectorTaskBegin(const char* name) {
+    if (auto collector = Collector::instance())
+        collector->taskBegin(name);
+}
+
+void collectorTaskEnd() {
+    if (auto collector = Collector::instance())
+        collector->taskEnd();
+}
+
+}  // namespace internal
+}  // namespace itt
+}  // namespace openvino
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+/**
+ * @brief This is a header file for the collector of the first inference report
+ *
+ * @file itt_collector.hpp
+ */
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ie_api.h"
+
+namespace openvino {
+namespace itt {
+namespace internal {
+
+/**
+ * @brief In-process collector of the task timings, which are stored as a hierarchical flame graph JSON report
+ * @details The collector of the process is enabled by the OV_FIRST_INFERENCE_REPORT environment variable with the path
+ * to the report. It lives in the openvino library, the itt library linked into the other modules passes the tasks to it
+ * by the exported collector* functions. The report is written when the openvino library is unloaded.
+ * Tasks of one thread are nested by their time intervals.
+ */
+class Collector {
+public:
+    /**
+     * @param path Path to the report
+     * @param maxTasks Limit of the recorded tasks, the tasks started after the limit is reached are dropped, so the
+     * recorded tasks always have their parents
+     */
+    explicit Collector(std::string path, size_t maxTasks = 1 << 20);
+
+    /// @brief Returns the collector of the process or nullptr if the report isn't requested
+    static Collector* instance();
+
+    /// @brief Returns a copy of the task name which lives as long as the collector
+    const char* name(const char* name);
+
+    void taskBegin(const char* name);
+    void taskEnd();
+
+    /// @brief Writes the report, the tasks which aren't ended yet end at the time of the call
+    void write() const;
+
+private:
+    struct Task {
+        const char* name;
+        size_t thread;
+        int64_t begin;
+        int64_t end;
+    };
+
+    std::string path;
+    size_t maxTasks;
+    mutable std::mutex mutex;
+    std::unordered_set<std::string> names;
+    std::unordered_map<std::thread::id, size_t> threads;
+    std::deque<Task> tasks;
+};
+
+/**
+ * @brief Entry points of the process collector for openvino::itt
+ * @{
+ */
+INFERENCE_ENGINE_API_CPP(const char*) collectorName(const char* name);
+INFERENCE_ENGINE_API_CPP(void) collectorTaskBegin(const char* name);
+INFERENCE_ENGINE_API_CPP(void) collectorTaskEnd();
+/** @} */
+
+}  // namespace internal
+}  // namespace itt
+}  // namespace openvino
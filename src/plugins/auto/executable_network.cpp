@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <limits>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -54,6 +56,33 @@ thread_local MultiDeviceExecutableNetwork::WorkerInferRequest* MultiDeviceExecut
 // TODO: revert to the plain variable (see header file), when we moved to the next CentOS 8.x in our support matrix
 thread_local const char* MultiDeviceExecutableNetwork::_thisPreferredDeviceName = "";
 
+void DeviceStatistics::InferenceStarted() {
+    _dispatched++;
+    _inFlight++;
+}
+
+void DeviceStatistics::InferenceFinished(Time::duration latency) {
+    const float sample = std::chrono::duration<float, std::milli>(latency).count();
+    float average = _latency.load();
+    float updated = 0.f;
+    do {
+        updated = (average == 0.f) ? sample : average + latencySmoothing * (sample - average);
+    } while (!_latency.compare_exchange_weak(average, updated));
+    _inFlight--;
+}
+
+float DeviceStatistics::ExpectedCompletionTime() const {
+    const auto latency = _latency.load();
+    const auto inFlight = _inFlight.load();
+    const auto numRequests = (std::max)(_numRequests, 1);
+    if (latency == 0.f) {
+        // the latency is unknown yet, so the device is preferred while it has idle requests to collect the statistics
+        return inFlight < numRequests ? 0.f : std::numeric_limits<float>::max();
+    }
+    // the requests of the device work in parallel, so the device completes numRequests inferences per latency
+    return latency * (inFlight + 1) / numRequests;
+}
+
 struct IdleGuard {
     explicit IdleGuard(MultiDeviceExecutableNetwork::WorkerInferRequest* workerInferRequestPtr,
                        MultiDeviceExecutableNetwork::NotBusyWorkerRequests& notBusyWorkerRequests) :
@@ -85,6 +114,10 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto& policy = _config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY];
+    if (policy.empty())
+        policy = std::string{MultiDeviceConfigParams::MULTI_SCHEDULING_PRIORITY};
+    _latencyScheduling = policy.as<std::string>() == MultiDeviceConfigParams::MULTI_SCHEDULING_LATENCY;
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -114,6 +147,8 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
                               itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
     auto& workerRequests = _workerRequests[device];
     auto& idleWorkerRequests = _idleWorkerRequests[device];
+    auto& statistics = _deviceStatistics[device];
+    statistics._numRequests = static_cast<int>(numRequests);
     workerRequests.resize(numRequests);
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
@@ -123,9 +158,11 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
         workerRequest._inferRequest = {executableNetwork->CreateInferRequest(), executableNetwork._so};
         auto* workerRequestPtr = &workerRequest;
         workerRequestPtr->_index = num++;
+        workerRequestPtr->_statistics = &statistics;
         IE_ASSERT(idleWorkerRequests.try_push(std::make_pair(workerRequestPtr->_index, workerRequestPtr)) == true);
         workerRequest._inferRequest->SetCallback(
             [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
+                workerRequestPtr->_statistics->InferenceFinished(DeviceStatistics::Time::now() - workerRequestPtr->_startTime);
                 IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
                 {
@@ -136,8 +173,9 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
                 if (idleGuard.Release()->try_push(std::make_pair(workerRequestPtr->_index, workerRequestPtr))) {
                     // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
                     // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
+                    // with the latency-aware scheduling the device-agnostic task may wait for the faster device
                     Task t;
-                    if (_inferPipelineTasks.try_pop(t))
+                    if (CanScheduleCommonTask() && _inferPipelineTasks.try_pop(t))
                         ScheduleToWorkerInferRequest(std::move(t));
                     else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
                         ScheduleToWorkerInferRequest(std::move(t), device);
@@ -261,10 +299,12 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
             // initialize containers before run async task
             _idleWorkerRequests[device.deviceName];
             _workerRequests[device.deviceName];
+            _deviceStatistics[device.deviceName];
             _inferPipelineTasksDeviceSpecific[device.deviceName] = nullptr;
         }
         _idleWorkerRequests["CPU_HELP"];
         _workerRequests["CPU_HELP"];
+        _deviceStatistics["CPU_HELP"];
         _inferPipelineTasksDeviceSpecific["CPU_HELP"] = nullptr;
         _executor->run(_loadContext[CPU].task);
         _executor->run(_loadContext[ACTUALDEVICE].task);
@@ -455,6 +495,14 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             std::lock_guard<std::mutex> lock(_mutex);
             return _devicePriorities;
         }();
+        if (_latencyScheduling && preferred_device.empty()) {
+            // join the shortest expected queue: if the best device is busy, the task waits for it in the common queue
+            const auto bestDevice = SelectDeviceByExpectedLatency(devices);
+            devices.erase(std::remove_if(devices.begin(), devices.end(), [&](const DeviceInformation& d) {
+                              return d.deviceName != bestDevice;
+                          }),
+                          devices.end());
+        }
     }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
@@ -471,6 +519,34 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         _inferPipelineTasks.push(std::move(inferPipelineTask));
 }
 
+DeviceName MultiDeviceExecutableNetwork::SelectDeviceByExpectedLatency(const std::vector<DeviceInformation>& devices) const {
+    DeviceName bestDevice;
+    float bestTime = std::numeric_limits<float>::max();
+    for (auto&& device : devices) {
+        auto statistics = _deviceStatistics.find(device.deviceName);
+        if (statistics == _deviceStatistics.end())
+            continue;
+        // the devices with the same expected time are taken in the priority order
+        const auto time = statistics->second.ExpectedCompletionTime();
+        if (bestDevice.empty() || time < bestTime) {
+            bestDevice = device.deviceName;
+            bestTime = time;
+        }
+    }
+    return bestDevice;
+}
+
+bool MultiDeviceExecutableNetwork::CanScheduleCommonTask() const {
+    if (!_latencyScheduling)
+        return true;
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto bestDevice = SelectDeviceByExpectedLatency(_devicePriorities);
+    auto statistics = _deviceStatistics.find(bestDevice);
+    // if the best device is busy, one of its requests will schedule the task when it is finished
+    return statistics == _deviceStatistics.end() ||
+           statistics->second._inFlight.load() < statistics->second._numRequests;
+}
+
 bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
                                             NotBusyWorkerRequests& idleWorkerRequests,
                                             const DeviceName& preferred_device) {
@@ -480,9 +556,17 @@ bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
       workerRequestPtr = worker.second;
       IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
       _thisWorkerInferRequest = workerRequestPtr;
+      // the inference may finish (and call the callback) before the task returns, so the start is recorded before
+      workerRequestPtr->_startTime = DeviceStatistics::Time::now();
+      workerRequestPtr->_statistics->InferenceStarted();
       {
           auto capturedTask = std::move(inferPipelineTask);
-          capturedTask();
+          try {
+              capturedTask();
+          } catch (...) {
+              workerRequestPtr->_statistics->_inFlight--;
+              throw;
+          }
       }
       idleGuard.Release();
       return true;
@@ -775,10 +859,29 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_DEVICE_DISPATCHED_INFERENCES),
+            METRIC_KEY(MULTI_DEVICE_INFERENCE_LATENCY),
+            METRIC_KEY(MULTI_DEVICE_INFERENCES_IN_FLIGHT)
         });
+    } else if (name == METRIC_KEY(MULTI_DEVICE_DISPATCHED_INFERENCES)) {
+        std::map<std::string, uint64_t> dispatched;
+        for (auto&& statistics : _deviceStatistics)
+            dispatched[statistics.first] = statistics.second._dispatched.load();
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_DISPATCHED_INFERENCES, dispatched);
+    } else if (name == METRIC_KEY(MULTI_DEVICE_INFERENCE_LATENCY)) {
+        std::map<std::string, float> latency;
+        for (auto&& statistics : _deviceStatistics)
+            latency[statistics.first] = statistics.second._latency.load();
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_INFERENCE_LATENCY, latency);
+    } else if (name == METRIC_KEY(MULTI_DEVICE_INFERENCES_IN_FLIGHT)) {
+        std::map<std::string, int> inFlight;
+        for (auto&& statistics : _deviceStatistics)
+            inFlight[statistics.first] = statistics.second._inFlight.load();
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_INFERENCES_IN_FLIGHT, inFlight);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric key: " << name;
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <unordered_map>
 #include <map>
@@ -75,6 +76,23 @@ enum AutoLoadContextIndex {
 template<typename T>
 using DeviceMap = std::unordered_map<DeviceName, T>;
 
+// dispatch statistics of the device, the inference latency is used by the MULTI_SCHEDULING_LATENCY policy
+struct DeviceStatistics {
+    using Time = std::chrono::steady_clock;
+    // weight of the latest inference in the moving average of the latency
+    static constexpr float latencySmoothing = 0.1f;
+
+    void InferenceStarted();
+    void InferenceFinished(Time::duration latency);
+    // expected time (in milliseconds) to complete one more inference on the device
+    float ExpectedCompletionTime() const;
+
+    std::atomic<uint64_t>  _dispatched = {0};
+    std::atomic<int>       _inFlight = {0};
+    std::atomic<float>     _latency = {0.f};  // milliseconds, 0 until the first inference is finished
+    int                    _numRequests = 0;
+};
+
 class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault,
                                      public InferenceEngine::ITaskExecutor {
 public:
@@ -84,6 +102,8 @@ public:
         InferenceEngine::Task                     _task;
         std::exception_ptr                        _exceptionPtr = nullptr;
         int                                       _index = 0;
+        DeviceStatistics*                         _statistics = nullptr;
+        DeviceStatistics::Time::time_point        _startTime;
     };
     using NotBusyWorkerRequests = InferenceEngine::ThreadSafeBoundedPriorityQueue<std::pair<int, WorkerInferRequest*>>;
 
@@ -127,14 +147,18 @@ public:
     DeviceMap<std::unique_ptr<InferenceEngine::ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
+    bool                                                        _latencyScheduling = false;
 
 private:
     void GenerateWorkers(const std::string& device, const InferenceEngine::SoExecutableNetworkInternal& executableNetwork);
     void WaitActualNetworkReady() const;
     void WaitFirstNetworkReady();
+    DeviceName SelectDeviceByExpectedLatency(const std::vector<DeviceInformation>& devices) const;
+    bool CanScheduleCommonTask() const;
     static bool RunPipelineTask(InferenceEngine::Task& inferPipelineTask,
                                 NotBusyWorkerRequests& idleWorkerRequests,
                                 const DeviceName& preferred_device);
@@ -54,6 +54,13 @@ namespace {
         }
         return config;
     }
+    void CheckSchedulingPolicy(const std::string& policy) {
+        if (policy != MultiDeviceConfigParams::MULTI_SCHEDULING_PRIORITY &&
+            policy != MultiDeviceConfigParams::MULTI_SCHEDULING_LATENCY) {
+            IE_THROW() << "Unsupported config value: " << policy
+                       << " for key: " << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY;
+        }
+    }
     std::vector<std::string> supported_configKeys = []() -> decltype(PerfHintsConfig::SupportedKeys()) {
                     auto res = PerfHintsConfig::SupportedKeys();
                     res.push_back(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
@@ -61,6 +68,7 @@ namespace {
                     res.push_back(PluginConfigParams::KEY_PERF_COUNT);
                     res.push_back(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS);
                     res.push_back(MultiDeviceConfigParams::KEY_AUTO_NETWORK_PRIORITY);
+                    res.push_back(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
                     return res;
                 }();
 }  // namespace
@@ -290,6 +298,11 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
         metaDevices = ParseMetaDevices(priorities->second, fullConfig);
         multiNetworkConfig.insert(*priorities);
     }
+    auto schedulingPolicy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (schedulingPolicy != fullConfig.end()) {
+        CheckSchedulingPolicy(schedulingPolicy->second);
+        multiNetworkConfig.insert(*schedulingPolicy);
+    }
 
     DeviceMap<SoExecutableNetworkInternal> executableNetworkPerDevice;
     std::mutex load_mutex;
@@ -586,6 +599,8 @@ void MultiDeviceInferencePlugin::CheckConfig(const std::map<std::string, std::st
                 IE_THROW() << "Unsupported config value: " << kvp.second
                            << " for key: " << kvp.first;
             }
+        } else if (kvp.first == MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY) {
+            CheckSchedulingPolicy(kvp.second);
         } else if (std::find(perf_hints_configs.begin(), perf_hints_configs.end(), kvp.first) != perf_hints_configs.end()) {
             PerfHintsConfig::CheckConfigAndValue(kvp);
         } else if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), kvp.first)) {
@@ -129,6 +129,97 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE == key) {
+            float val_f = -1.0f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                           << ". Expected only float numbers";
+            }
+            if (val_f < 0.0f || val_f > 1.0f) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                           << ". Expected only float numbers in range [0, 1]";
+            }
+            fcSparseWeightsDecompressionRate = val_f;
+        } else if (PluginConfigInternalParams::KEY_CPU_PERFORMANCE_HINT_TUNING_BUDGET == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PERFORMANCE_HINT_TUNING_BUDGET
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PERFORMANCE_HINT_TUNING_BUDGET
+                           << ". Expected only non-negative integer numbers";
+            }
+            perfHintTuningBudget = val_i;
+        } else if (PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT == key) {
+            if (val == PluginConfigParams::YES)
+                globalLayoutAssignment = true;
+            else if (val == PluginConfigParams::NO)
+                globalLayoutAssignment = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING == key) {
+            if (val == PluginConfigParams::YES)
+                depthFirstTiling = true;
+            else if (val == PluginConfigParams::NO)
+                depthFirstTiling = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING_CACHE_SIZE == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING_CACHE_SIZE
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING_CACHE_SIZE
+                           << ". Expected only non-negative integer numbers";
+            }
+            depthFirstTilingCacheSize = static_cast<size_t>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_SDPA_FUSION == key) {
+            if (val == PluginConfigParams::YES)
+                sdpaFusion = true;
+            else if (val == PluginConfigParams::NO)
+                sdpaFusion = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SDPA_FUSION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PREPROCESSING_FUSION == key) {
+            if (val == PluginConfigParams::YES)
+                preprocessingFusion = true;
+            else if (val == PluginConfigParams::NO)
+                preprocessingFusion = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PREPROCESSING_FUSION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_HUGE_PAGES == key) {
+            if (val == PluginConfigParams::NO)
+                memoryAllocatorConfig.hugePages = MemoryAllocator::HugePages::Disabled;
+            else if (val == "TRANSPARENT")
+                memoryAllocatorConfig.hugePages = MemoryAllocator::HugePages::Transparent;
+            else if (val == "2MB")
+                memoryAllocatorConfig.hugePages = MemoryAllocator::HugePages::Explicit2M;
+            else if (val == "1GB")
+                memoryAllocatorConfig.hugePages = MemoryAllocator::HugePages::Explicit1G;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HUGE_PAGES
+                           << ". Expected only NO/TRANSPARENT/2MB/1GB";
+        } else if (PluginConfigInternalParams::KEY_CPU_MEMORY_POOL == key) {
+            if (val == PluginConfigParams::YES)
+                memoryAllocatorConfig.pool = true;
+            else if (val == PluginConfigParams::NO)
+                memoryAllocatorConfig.pool = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_MEMORY_POOL
+                           << ". Expected only YES/NO";
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -7,6 +7,7 @@
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
 #include "utils/debug_capabilities.h"
+#include "utils/memory_allocator.h"
 
 #include <string>
 #include <map>
@@ -27,6 +28,15 @@ struct Config {
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 100ul;
+    float fcSparseWeightsDecompressionRate = 1.0f;
+    // time budget in milliseconds for tuning of the performance hint, 0 disables the tuning
+    int perfHintTuningBudget = 0;
+    bool globalLayoutAssignment = false;
+    bool depthFirstTiling = false;
+    size_t depthFirstTilingCacheSize = 0;
+    bool sdpaFusion = false;
+    bool preprocessingFusion = false;
+    MemoryAllocator::Config memoryAllocatorConfig;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
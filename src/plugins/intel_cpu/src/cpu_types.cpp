@@ -188,6 +188,8 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "Subgraph", Subgraph},
         { "PriorBox", PriorBox},
         { "PriorBoxClustered", PriorBoxClustered},
+        { "ScaledDotProductAttention", ScaledDotProductAttention},
+        { "FusedPreprocessing", FusedPreprocessing},
 };
 
 Type TypeFromName(const std::string& type) {
@@ -373,6 +375,10 @@ std::string NameFromType(const Type type) {
             return "Reference";
         case Subgraph:
             return "Subgraph";
+        case ScaledDotProductAttention:
+            return "ScaledDotProductAttention";
+        case FusedPreprocessing:
+            return "FusedPreprocessing";
         default:
             return "Unknown";
     }
@@ -104,6 +104,8 @@ enum Type {
     Subgraph,
     PriorBox,
     PriorBoxClustered,
+    ScaledDotProductAttention,
+    FusedPreprocessing,
 };
 
 enum Algorithm {
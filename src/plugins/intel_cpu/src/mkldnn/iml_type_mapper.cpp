@@ -36,6 +36,7 @@ impl_desc_type MKLDNNPlugin::parse_impl_name(std::string impl_desc_name) {
     SEARCH_WORD(_1x1);
     SEARCH_WORD(_dw);
     SEARCH_WORD(reorder);
+    SEARCH_WORD(sparse);
     if ((res & impl_desc_type::avx2) != impl_desc_type::avx2 &&
         (res & impl_desc_type::avx512) != impl_desc_type::avx512)
         SEARCH_WORD(avx);
@@ -89,6 +90,9 @@ const char* MKLDNNPlugin::impl_type_to_string(impl_desc_type type) {
     CASE(jit_avx512_amx);
     CASE(jit_avx512_amx_1x1);
     CASE(jit_avx512_amx_dw);
+    CASE(jit_avx512_sparse);
+    CASE(jit_avx2_sparse);
+    CASE(ref_sparse);
     CASE(brgconv_avx512);
     CASE(brgconv_avx2);
     CASE(brgconv_avx);
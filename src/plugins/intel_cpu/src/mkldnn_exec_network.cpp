@@ -26,6 +26,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
 
 using namespace MKLDNNPlugin;
@@ -70,6 +71,11 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
     bool isFloatModel = !ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(function);
 
+    const auto& allocatorConfig = _cfg.memoryAllocatorConfig;
+    if (allocatorConfig.hugePages != MemoryAllocator::HugePages::Disabled || allocatorConfig.pool) {
+        _memoryAllocator = std::make_shared<MemoryAllocator>(allocatorConfig);
+    }
+
     if (_cfg.batchLimit > 1) {
         // check topology for applicability
         if (!CanProcessDynBatch(_network)) {
@@ -156,6 +162,10 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                // on multi-socket hosts the stream memory is bound to the NUMA node of the stream threads,
+                // so it isn't placed on a remote node by a thread which touches it first
+                graphLock._graph.setNumaNodeId(nullptr != streamsExecutor && getAvailableNUMANodes().size() > 1 ? numaNodeId : -1);
+                graphLock._graph.setMemoryAllocator(_memoryAllocator);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -220,6 +230,10 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(PluginConfigInternalParams::METRIC_CPU_NUMA_NODES_RESIDENT_BYTES);
+        metrics.push_back(PluginConfigInternalParams::METRIC_CPU_VIEW_ELIMINATED_BYTES);
+        metrics.push_back(PluginConfigInternalParams::METRIC_CPU_REORDER_BYTES);
+        metrics.push_back(PluginConfigInternalParams::METRIC_CPU_MEMORY_ALLOCATION_STATS);
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -234,6 +248,22 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_NUMA_NODES_RESIDENT_BYTES) {
+        std::map<int, uint64_t> residentBytes;
+        std::unordered_set<const void*> visited;
+        for (auto& graph : _graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (graphLock._graph.IsReady())
+                graphLock._graph.collectNumaNodesResidentBytes(residentBytes, visited);
+        }
+        return residentBytes;
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_VIEW_ELIMINATED_BYTES) {
+        // all the graphs of the streams are identical
+        return GetGraph()._graph.getViewEliminatedBytes();
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_REORDER_BYTES) {
+        return GetGraph()._graph.getReorderBytes();
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_MEMORY_ALLOCATION_STATS) {
+        return _memoryAllocator ? _memoryAllocator->getStats() : std::map<std::string, uint64_t>{};
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -287,6 +317,6 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
 }
 
 void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
-    CNNNetworkSerializer serializer(modelStream, extensionManager);
+    CNNNetworkSerializer serializer(modelStream, extensionManager, _tunedConfig);
     serializer <<_network;
 }
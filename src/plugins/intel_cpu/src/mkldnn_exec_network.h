@@ -46,6 +46,14 @@ public:
 
     void Export(std::ostream& modelStream) override;
 
+    /**
+     * @brief Sets the properties chosen by tuning of the performance hint, they are exported with the network
+     * so the network imported from the cache doesn't need to be tuned again
+     */
+    void setTunedConfig(const std::map<std::string, std::string>& tunedConfig) {
+        _tunedConfig = tunedConfig;
+    }
+
 protected:
     friend class MKLDNNInferRequestBase;
     MKLDNNExtensionManager::Ptr extensionManager;
@@ -55,6 +63,7 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    std::map<std::string, std::string>          _tunedConfig;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -66,6 +75,8 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // shared by the graphs of all the streams, null if the default allocation is used
+    MemoryAllocator::Ptr                        _memoryAllocator;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
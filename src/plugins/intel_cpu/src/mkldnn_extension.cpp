@@ -4,8 +4,10 @@
 
 #include "mkldnn_extension.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/op/fused_preprocessing.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
 
 #include <ngraph/ngraph.hpp>
@@ -35,8 +37,10 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
 
 #define NGRAPH_OP(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
         NGRAPH_OP(FullyConnectedNode, MKLDNNPlugin)
+        NGRAPH_OP(FusedPreprocessingNode, MKLDNNPlugin)
         NGRAPH_OP(LeakyReluNode, MKLDNNPlugin)
         NGRAPH_OP(PowerStaticNode, MKLDNNPlugin)
+        NGRAPH_OP(ScaledDotProductAttentionNode, MKLDNNPlugin)
         NGRAPH_OP(SwishNode, MKLDNNPlugin)
 #undef NGRAPH_OP
 
@@ -17,6 +17,7 @@
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
 #include "mkldnn_graph_optimizer.h"
+#include "mkldnn_layout_optimizer.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "memory_solver.hpp"
@@ -49,6 +50,7 @@
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "utils/numa_utils.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -67,6 +69,9 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
 
     if (IsReady())
         ForgetGraphData();
+    // the workspace and the constant data live as long as the graph,
+    // the allocator binds them to the NUMA node of the stream
+    MemoryAllocator::Scope allocatorScope{memoryAllocator, MemoryAllocator::Lifetime::Persistent, numaNodeId};
     // disable weights caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
@@ -320,6 +325,11 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    if (config.globalLayoutAssignment) {
+        MKLDNNLayoutOptimizer layoutOptimizer;
+        layoutOptimizer.OptimizeLayouts(*this);
+    }
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -339,6 +349,74 @@ void MKLDNNGraph::InitGraph() {
     ExtractConstantAndExecutableNodes();
 
     ExecuteConstantNodesOnly();
+
+    BindConstantsToNumaNode();
+}
+
+void MKLDNNGraph::BindConstantsToNumaNode() const {
+    // constant data is shared between the streams of the same NUMA node via weights cache only,
+    // otherwise it may point to the original model constants, which must not be migrated.
+    // The memory allocator binds the buffers on allocation
+    if (numaNodeId < 0 || !weightsCache || memoryAllocator)
+        return;
+
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::BindConstantsToNumaNode");
+    for (const auto& edge : graphEdges) {
+        if (!edge->getParent()->isConstant() || edge->getStatus() != MKLDNNEdge::Status::Validated)
+            continue;
+        const auto& memory = edge->getMemory();
+        if (memory.getDesc().isDefined())
+            bindToNumaNode(memory.GetData(), memory.GetSize(), numaNodeId);
+    }
+}
+
+void MKLDNNGraph::collectNumaNodesResidentBytes(std::map<int, uint64_t>& residentBytes, std::unordered_set<const void*>& visited) const {
+    if (memWorkspace && memWorkspace->getDesc().isDefined() && visited.insert(memWorkspace->GetData()).second)
+        MKLDNNPlugin::collectNumaNodesResidentBytes(memWorkspace->GetData(), memWorkspace->GetSize(), residentBytes);
+
+    for (const auto& edge : graphEdges) {
+        if (!edge->getParent()->isConstant() || edge->getStatus() != MKLDNNEdge::Status::Validated)
+            continue;
+        const auto& memory = edge->getMemory();
+        if (memory.getDesc().isDefined() && visited.insert(memory.GetData()).second)
+            MKLDNNPlugin::collectNumaNodesResidentBytes(memory.GetData(), memory.GetSize(), residentBytes);
+    }
+}
+
+uint64_t MKLDNNGraph::getViewEliminatedBytes() const {
+    uint64_t bytes = 0;
+    for (const auto& node : graphNodes) {
+        const auto* selected_pd = node->getSelectedPrimitiveDescriptor();
+        if (!selected_pd || node->isConstant() || !one_of(node->getType(), Gather, StridedSlice, Transpose, Split))
+            continue;
+        const auto& outConfs = selected_pd->getConfig().outConfs;
+        for (size_t port = 0; port < outConfs.size(); port++) {
+            const auto& desc = outConfs[port].desc;
+            if (outConfs[port].inPlace < 0 || !desc->isDefined())
+                continue;
+            // the data are copied anyway when all the consumers read them through reorders
+            const auto edges = node->getChildEdgesAtPort(port);
+            if (std::any_of(edges.begin(), edges.end(), [](const MKLDNNEdgePtr& edge) { return edge->getChild()->getType() != Reorder; }))
+                bytes += desc->getShape().getElementsCount() * desc->getPrecision().size();
+        }
+    }
+    return bytes;
+}
+
+uint64_t MKLDNNGraph::getReorderBytes() const {
+    uint64_t bytes = 0;
+    for (const auto& node : graphNodes) {
+        const auto* selected_pd = node->getSelectedPrimitiveDescriptor();
+        if (!selected_pd || node->getType() != Reorder || node->isConstant())
+            continue;
+        const auto& srcDesc = selected_pd->getConfig().inConfs[0].desc;
+        const auto& dstDesc = selected_pd->getConfig().outConfs[0].desc;
+        if (!srcDesc->isDefined() || !dstDesc->isDefined())
+            continue;
+        bytes += srcDesc->getShape().getElementsCount() * srcDesc->getPrecision().size() +
+                 dstDesc->getShape().getElementsCount() * dstDesc->getPrecision().size();
+    }
+    return bytes;
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -656,6 +734,10 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    // bind before the first touch, so the pages are placed on the node of the stream regardless of the touching thread.
+    // The memory allocator binds the whole mapping of the workspace on allocation
+    if (numaNodeId >= 0 && !memoryAllocator)
+        bindToNumaNode(memWorkspace->GetData(), total_size, numaNodeId);
 
     if (edge_clusters.empty())
         return;
@@ -854,13 +936,23 @@ void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request, int batch) {
 
     mkldnn::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+    auto executeNodes = [&]() {
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream);
+        }
+    };
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+    if (firstInfer) {
+        firstInfer = false;
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::FirstInfer");
+        executeNodes();
+    } else {
+        executeNodes();
     }
 
     if (infer_count != -1) infer_count++;
@@ -1221,6 +1313,7 @@ void MKLDNNGraph::EnforceBF16() {
         RNNCell,        // recurent nets
         RNNSeq,         // recurent nets
         MatMul,         // bert nets
+        ScaledDotProductAttention,  // bert nets
         ROIPooling,     // object detection nets
         Interpolate,    // super resolution nets
     };
@@ -11,11 +11,13 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "cache/multi_cache.h"
+#include "utils/memory_allocator.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_set>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequestBase;
@@ -184,6 +186,45 @@ public:
         return graphHasDynamicInput;
     }
 
+    /**
+     * @brief Sets NUMA node the graph workspace and constant data are bound to, negative value disables binding
+     */
+    void setNumaNodeId(int id) {
+        numaNodeId = id;
+    }
+
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
+    /**
+     * @brief Sets the allocator of the graph workspace, constant data and the memory reallocated during the inference,
+     *        null allocator keeps the oneDNN allocations
+     */
+    void setMemoryAllocator(const MemoryAllocator::Ptr& allocator) {
+        memoryAllocator = allocator;
+    }
+
+    const MemoryAllocator::Ptr& getMemoryAllocator() const {
+        return memoryAllocator;
+    }
+
+    /**
+     * @brief Adds resident bytes of the graph workspace and constant data to the per NUMA node statistics.
+     *        Memory shared between graphs (e.g. cached weights) is accounted once, since visited pointers are skipped.
+     */
+    void collectNumaNodesResidentBytes(std::map<int, uint64_t>& residentBytes, std::unordered_set<const void*>& visited) const;
+
+    /**
+     * @brief Returns bytes per inference, which aren't copied since the outputs of the data movement nodes are views on their inputs
+     */
+    uint64_t getViewEliminatedBytes() const;
+
+    /**
+     * @brief Returns bytes per inference, which are read and written by the reorders between the nodes with different layouts or precisions
+     */
+    uint64_t getReorderBytes() const;
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -204,6 +245,9 @@ protected:
     // values mean increment it within each Infer() call
     int infer_count = -1;
 
+    // The first Infer() call is reported as a separate first inference task
+    bool firstInfer = true;
+
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
@@ -216,6 +260,8 @@ protected:
 
     bool isQuantizedFlag = false;
     bool graphHasDynamicInput = false;
+    int numaNodeId = -1;
+    MemoryAllocator::Ptr memoryAllocator;
 
     static mkldnn::engine eng;
 
@@ -232,6 +278,7 @@ protected:
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    void BindConstantsToNumaNode() const;
 
     friend class MKLDNNInferRequestBase;
     friend class MKLDNNLegacyInferRequest;
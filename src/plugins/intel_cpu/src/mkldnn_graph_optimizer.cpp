@@ -12,6 +12,7 @@
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
 #include "nodes/mkldnn_deconv_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
@@ -47,6 +48,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <numeric>
 
 #include "mkldnn_itt.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -58,7 +60,14 @@ using namespace InferenceEngine;
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
 void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "EnableFCSparseWeights");
+    EnableFCSparseWeights(graph);
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -166,6 +175,154 @@ void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &grap
     graph.RemoveDroppedEdges();
 }
 
+void MKLDNNGraphOptimizer::FuseFCAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConstNode = [](const MKLDNNNodePtr& node) {
+        return node->getType() == Input && node->isConstant() && node->getChildEdges().size() == 1;
+    };
+
+    auto isSuitableDecompressionNode = [](const MKLDNNNodePtr& node, Algorithm alg) {
+        return node->getAlgorithm() == alg && node->getParentEdges().size() == 2 &&
+               node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    // Returns per-group decompression values [N, G] broadcasted from per-tensor or per-channel constant,
+    // empty vector means that the constant shape is not supported
+    auto getDecompressionValues = [](const MKLDNNNodePtr& constNode, const VectorDims& weightsDims) {
+        std::vector<float> values;
+        const auto constDims = getNormalizedDimsBySize(constNode->getOutputShapeAtPort(0).getStaticDims(), weightsDims.size());
+        if (constDims.size() != weightsDims.size() || constDims.back() != 1)
+            return values;
+        for (size_t i = 0; i < constDims.size() - 1; i++) {
+            if (constDims[i] != 1 && constDims[i] != weightsDims[i])
+                return values;
+        }
+
+        auto constInput = std::dynamic_pointer_cast<MKLDNNInputNode>(constNode);
+        if (!constInput)
+            return values;
+        const auto constMemory = constInput->getMemoryPtr();
+        const size_t constSize = std::accumulate(constDims.begin(), constDims.end(), size_t{1}, std::multiplies<size_t>());
+        std::vector<float> constValues(constSize);
+        cpu_convert(constMemory->GetPtr(), constValues.data(), constMemory->getDesc().getPrecision(), Precision::FP32, constSize);
+
+        const size_t N = weightsDims[0];
+        const size_t G = weightsDims.size() == 3 ? weightsDims[1] : 1;
+        values.resize(N * G);
+        for (size_t n = 0; n < N; n++) {
+            for (size_t g = 0; g < G; g++) {
+                const size_t idx = (constDims[0] == 1 ? 0 : n) * (weightsDims.size() == 3 ? constDims[1] : 1) +
+                                   (weightsDims.size() == 3 && constDims[1] != 1 ? g : 0);
+                values[n * G + g] = constValues[idx];
+            }
+        }
+        return values;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(graphNodes[i]);
+        if (!fcNode || fcNode->getInputShapeAtPort(1).getRank() != 2 || fcNode->getInputShapeAtPort(0).getRank() > 3)
+            continue;
+
+        auto weightsPath = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        MKLDNNNodePtr reshapeNode;
+        if (weightsPath->getType() == Reshape) {
+            if (weightsPath->getChildEdges().size() != 1 || weightsPath->getParentEdges().size() != 2)
+                continue;
+            reshapeNode = weightsPath;
+            weightsPath = reshapeNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        if (!isSuitableDecompressionNode(weightsPath, EltwiseMultiply))
+            continue;
+        const auto multiplyNode = weightsPath;
+        const size_t scalePort = isSuitableConstNode(multiplyNode->getParentEdgesAtPort(1)[0]->getParent()) ? 1 : 0;
+        const auto scaleNode = multiplyNode->getParentEdgesAtPort(scalePort)[0]->getParent();
+        if (!isSuitableConstNode(scaleNode))
+            continue;
+
+        weightsPath = multiplyNode->getParentEdgesAtPort(1 - scalePort)[0]->getParent();
+        MKLDNNNodePtr subtractNode, zeroPointsNode;
+        if (isSuitableDecompressionNode(weightsPath, EltwiseSubtract)) {
+            subtractNode = weightsPath;
+            zeroPointsNode = subtractNode->getParentEdgesAtPort(1)[0]->getParent();
+            if (!isSuitableConstNode(zeroPointsNode))
+                continue;
+            weightsPath = subtractNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        const auto convertNode = weightsPath;
+        if (convertNode->getType() != Convert || convertNode->getChildEdges().size() != 1)
+            continue;
+        const auto weightsNode = convertNode->getParentEdgesAtPort(0)[0]->getParent();
+        const auto weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
+        if (!isSuitableConstNode(weightsNode) || !one_of(weightsPrecision, Precision::U8, Precision::I8))
+            continue;
+
+        // compressed weights are [N, K] for per-channel and [N, G, K / G] for group-wise decompression
+        const auto& weightsDims = weightsNode->getOutputShapeAtPort(0).getStaticDims();
+        const auto& fcWeightsDims = fcNode->getInputShapeAtPort(1).getStaticDims();
+        if ((reshapeNode ? 3 : 2) != weightsDims.size() || weightsDims[0] != fcWeightsDims[0])
+            continue;
+
+        const auto scales = getDecompressionValues(scaleNode, weightsDims);
+        if (scales.empty())
+            continue;
+        std::vector<float> zeroPoints;
+        if (zeroPointsNode) {
+            zeroPoints = getDecompressionValues(zeroPointsNode, weightsDims);
+            if (zeroPoints.empty())
+                continue;
+        }
+
+        fcNode->setWeightsDecompression(scales, zeroPoints, weightsDims.size() == 3 ? weightsDims[1] : 1);
+        fcNode->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+        if (reshapeNode) {
+            reshapeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshapeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
+
+        for (const auto& constNode : {scaleNode, zeroPointsNode}) {
+            if (!constNode)
+                continue;
+            auto constEdge = constNode->getChildEdgeAt(0);
+            constEdge->drop();
+            graph.RemoveEdge(constEdge);
+        }
+
+        graph.DropNode(multiplyNode);
+        if (subtractNode)
+            graph.DropNode(subtractNode);
+        graph.DropNode(convertNode);
+    }
+}
+
+void MKLDNNGraphOptimizer::EnableFCSparseWeights(MKLDNNGraph &graph) {
+    const float minSparseRate = graph.getConfig().fcSparseWeightsDecompressionRate;
+    if (minSparseRate >= 1.f)
+        return;
+
+    for (const auto& node : graph.GetNodes()) {
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (!fcNode || fcNode->withWeightsDecompression() || fcNode->getInputShapeAtPort(1).getRank() != 2 ||
+            fcNode->getInputShapeAtPort(0).getRank() > 3 || fcNode->getOriginalInputPrecisionAtPort(0) != Precision::FP32 ||
+            fcNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+
+        const auto weightsNode = std::dynamic_pointer_cast<MKLDNNInputNode>(fcNode->getParentEdgesAtPort(1)[0]->getParent());
+        if (!weightsNode || !weightsNode->isConstant() || weightsNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+
+        const auto weightsMemory = weightsNode->getMemoryPtr();
+        const auto& weightsDims = weightsMemory->getStaticDims();
+        const float sparseRate = MKLDNNFullyConnectedNode::getZeroWeightsBlocksRate(
+                reinterpret_cast<const float*>(weightsMemory->GetPtr()), weightsDims[0], weightsDims[1]);
+        if (sparseRate >= minSparseRate)
+            fcNode->setSparseWeights(true);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionMatMulAndBias(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
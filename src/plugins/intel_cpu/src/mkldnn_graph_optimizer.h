@@ -19,6 +19,8 @@ public:
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
 
 private:
+    void FuseFCAndWeightsDecompression(MKLDNNGraph &graph);
+    void EnableFCSparseWeights(MKLDNNGraph &graph);
     void FuseConvolutionMatMulAndBias(MKLDNNGraph &graph);
     void FuseDeconvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseMultiplyAndAdd(MKLDNNGraph &graph);
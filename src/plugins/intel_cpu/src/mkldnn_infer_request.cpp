@@ -22,6 +22,8 @@
 #include <debug.h>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
+#include "utils/numa_utils.h"
+#include "utils/memory_allocator.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -146,11 +148,40 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::redefineMemoryForInputNodes() {
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequestBase::markAllocatedBlob(const std::string& name) {
+    allocatedBlobs.insert(name);
+    // the new blob is bound by the next inference
+    blobsNumaNodeId = -1;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::bindAllocatedBlobsToNumaNode() {
+    // the request may be executed by the streams of different NUMA nodes, so the blobs allocated by the plugin
+    // are migrated to the node of the current stream, user blobs are never rebound
+    blobsNumaNodeId = graph->getNumaNodeId();
+    if (blobsNumaNodeId < 0)
+        return;
+
+    for (const auto& name : allocatedBlobs) {
+        for (const auto blobs : {&_inputs, &_outputs}) {
+            const auto blob = blobs->find(name);
+            if (blob == blobs->end() || !blob->second)
+                continue;
+            void* data = blob->second->buffer();
+            bindToNumaNode(data, blob->second->byteSize(), blobsNumaNodeId);
+        }
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequestBase::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
+    // the memory reallocated for new shapes is taken from the pool of the allocator
+    MemoryAllocator::Scope allocatorScope{graph->getMemoryAllocator(), MemoryAllocator::Lifetime::Transient};
+
+    if (graph->getNumaNodeId() != blobsNumaNodeId)
+        bindAllocatedBlobsToNumaNode();
 
     ThrowIfCanceled();
 
@@ -459,6 +490,7 @@ void MKLDNNPlugin::MKLDNNLegacyInferRequest::SetBlob(const std::string& name, co
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
             }
+            allocatedBlobs.erase(name);
             _inputs[name] = data;
         }
     }
@@ -501,6 +533,7 @@ void MKLDNNPlugin::MKLDNNLegacyInferRequest::SetBlob(const std::string& name, co
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
+        allocatedBlobs.erase(name);
         _outputs[name] = data;
     }
 }
@@ -531,6 +564,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNLegacyInferRequest::GetBlob(const
 
                 _inputs[name] = make_blob_with_precision(desc);
                 _inputs[name]->allocate();
+                markAllocatedBlob(name);
 
                 if (!isDynamic &&
                     desc == MemoryDescUtils::convertToTensorDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc()) &&
@@ -576,6 +610,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNLegacyInferRequest::GetBlob(const
 
                         data = make_blob_with_precision(desc);
                         data->allocate();
+                        markAllocatedBlob(name);
                     } else {
                         const auto &expectedTensorDesc = isDynamic ? InferenceEngine::TensorDesc(desc.getPrecision(),
                                                                                                  InferenceEngine::TensorDesc::getLayoutByRank(
@@ -738,6 +773,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
+        allocatedBlobs.erase(name);
         _inputs[name] = data;
     } else {
         if (compoundBlobPassed) {
@@ -766,6 +802,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
+        allocatedBlobs.erase(name);
         _outputs[name] = data;
     }
 }
@@ -802,6 +839,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
                 _inputs[name] = make_blob_with_precision(desc);
                 _inputs[name]->allocate();
+                markAllocatedBlob(name);
 
                 if (!isDynamic &&
                     desc == MemoryDescUtils::convertToTensorDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc()) &&
@@ -837,6 +875,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
                     data = make_blob_with_precision(desc);
                     data->allocate();
+                    markAllocatedBlob(name);
                 } else {
                     if (!shape.compatible(ov::PartialShape(data->getTensorDesc().getDims()))) {
                         IE_THROW(ParameterMismatch) << "Network input and output use the same name: " << name << ", but expect blobs with different shapes.";
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_set>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -56,8 +57,12 @@ protected:
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
 
+    void markAllocatedBlob(const std::string& name);
+
     MKLDNNGraph* graph = nullptr;
     std::unordered_map<std::string, void*> externalPtr;
+    // names of the blobs allocated by the plugin, which follow the NUMA node of the executing stream
+    std::unordered_set<std::string> allocatedBlobs;
 
 private:
     void PushStates();
@@ -65,10 +70,12 @@ private:
     void redefineMemoryForInputNodes();
 
     void changeDefaultPtr();
+    void bindAllocatedBlobsToNumaNode();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    int                                 blobsNumaNodeId = -1;
 };
 
 class MKLDNNLegacyInferRequest : public MKLDNNInferRequestBase {
@@ -0,0 +1,113 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layout_optimizer.h"
+#include "mkldnn_itt.h"
+
+#include <algorithm>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// the number of passes over the graph is limited, though the optimization usually converges after a couple of passes
+constexpr size_t maxOptimizationPasses = 10;
+
+const PortConfig* getParentPortConfig(const MKLDNNEdgePtr& edge) {
+    auto parentPD = edge->getParent()->getSelectedPrimitiveDescriptor();
+    if (parentPD == nullptr || parentPD->getConfig().outConfs.empty())
+        return nullptr;
+    int inNum = edge->getInputNum();
+    if (inNum < 0 || inNum >= parentPD->getConfig().outConfs.size())
+        inNum = 0;
+    return &parentPD->getConfig().outConfs[inNum];
+}
+
+const PortConfig* getChildPortConfig(const MKLDNNEdgePtr& edge) {
+    auto childPD = edge->getChild()->getSelectedPrimitiveDescriptor();
+    if (childPD == nullptr)
+        return nullptr;
+    const int outNum = edge->getOutputNum();
+    if (outNum < 0 || outNum >= childPD->getConfig().inConfs.size())
+        return nullptr;
+    return &childPD->getConfig().inConfs[outNum];
+}
+
+}  // namespace
+
+bool MKLDNNLayoutOptimizer::canChangeLayout(const MKLDNNNodePtr& node) {
+    // these nodes choose the descriptors with their own rules (e.g. in-place concatenation, the layout preferred by
+    // convolution and eltwise kernels) or have fixed layouts
+    static const Type fixedTypes[] = {Input, Output, MemoryInput, MemoryOutput, Reorder, Concatenation, Split, Subgraph,
+                                      Convolution, Eltwise};
+    return std::find(std::begin(fixedTypes), std::end(fixedTypes), node->getType()) == std::end(fixedTypes) &&
+           node->getSelectedPrimitiveDescriptor() != nullptr && node->getSupportedPrimitiveDescriptors().size() > 1;
+}
+
+size_t MKLDNNLayoutOptimizer::getEdgeCost(const MKLDNNEdgePtr& edge, const MemoryDesc& parentDesc, const MemoryDesc& childDesc) {
+    // reorders of the constants are executed once on load network stage
+    if (edge->getParent()->isConstant() || childDesc.isCompatible(parentDesc))
+        return 0;
+    const auto& shape = parentDesc.getShape();
+    const auto& dims = shape.isStatic() ? shape.getStaticDims() : shape.getMinDims();
+    size_t elements = 1;
+    for (auto dim : dims)
+        elements *= dim;
+    // the reorder reads the tensor in the parent precision and writes it in the child one, so the precision conversion
+    // is accounted too. Even the reorder of the empty tensor has the cost of the additional node
+    return std::max<size_t>(elements * (parentDesc.getPrecision().size() + childDesc.getPrecision().size()), 1);
+}
+
+size_t MKLDNNLayoutOptimizer::getNodeCost(const MKLDNNNodePtr& node, const NodeConfig& config) {
+    size_t cost = 0;
+    for (size_t i = 0; i < config.inConfs.size() && i < node->getParentEdges().size(); i++) {
+        auto edge = node->getParentEdgeAt(i);
+        if (auto parentConfig = getParentPortConfig(edge))
+            cost += getEdgeCost(edge, *parentConfig->desc, *config.inConfs[i].desc);
+    }
+    for (size_t i = 0; i < config.outConfs.size(); i++) {
+        for (const auto& edge : node->getChildEdgesAtPort(i)) {
+            if (auto childConfig = getChildPortConfig(edge))
+                cost += getEdgeCost(edge, *config.outConfs[i].desc, *childConfig->desc);
+        }
+    }
+    return cost;
+}
+
+void MKLDNNLayoutOptimizer::OptimizeLayouts(MKLDNNGraph& graph) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNLayoutOptimizer::OptimizeLayouts");
+
+    for (size_t pass = 0; pass < maxOptimizationPasses; pass++) {
+        bool changed = false;
+        for (const auto& node : graph.GetNodes()) {
+            if (!canChangeLayout(node))
+                continue;
+
+            const auto& supportedPDs = node->getSupportedPrimitiveDescriptors();
+            const auto selectedPD = node->getSelectedPrimitiveDescriptor();
+            const auto implType = selectedPD->getImplementationType();
+            size_t bestCost = getNodeCost(node, selectedPD->getConfig());
+            int bestIndex = -1;
+            for (size_t i = 0; i < supportedPDs.size() && bestCost > 0; i++) {
+                const auto& config = supportedPDs[i].getConfig();
+                if (&supportedPDs[i] == selectedPD || supportedPDs[i].getImplementationType() != implType ||
+                    config.inConfs.size() > node->getParentEdges().size())
+                    continue;
+                const auto cost = getNodeCost(node, config);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestIndex = static_cast<int>(i);
+                }
+            }
+            if (bestIndex >= 0) {
+                node->selectPrimitiveDescriptorByIndex(bestIndex);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_graph.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Refines the primitive descriptors selected node by node to minimize the amount of data moved by reorders over
+ * the whole graph. The node by node selection takes into account only the layouts of the parents, so a node which
+ * supports several layouts (e.g. a non-oneDNN one) may choose the layout of its parent and cause reorders to all its
+ * children. The optimizer minimizes the cost of the graph, which is the number of bytes read and written by the
+ * reorders on the edges with incompatible descriptors (layout or precision), by iterated conditional modes: each node
+ * takes the descriptor minimizing the cost of its own edges, which never increases the total cost, until there are no
+ * changes. Only the descriptors of the same implementation type as the selected one are considered, and the nodes
+ * preferring layouts for their kernels (convolutions, eltwise) keep their choice, so the kernel costs stay the same.
+ */
+class MKLDNNLayoutOptimizer {
+public:
+    void OptimizeLayouts(MKLDNNGraph& graph);
+
+private:
+    static bool canChangeLayout(const MKLDNNNodePtr& node);
+    static size_t getEdgeCost(const MKLDNNEdgePtr& edge, const MemoryDesc& parentDesc, const MemoryDesc& childDesc);
+    static size_t getNodeCost(const MKLDNNNodePtr& node, const NodeConfig& config);
+};
+
+}  // namespace MKLDNNPlugin
@@ -20,6 +20,7 @@
 #include "cpu_shape.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
+#include "utils/memory_allocator.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "memory_desc/cpu_memory_desc.h"
 
@@ -59,7 +60,17 @@ void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type,
 }
 
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bool pads_zeroing) {
-    if (data == nullptr) {
+    // the previous buffer is released after the primitive is replaced, the same way as oneDNN releases its buffers
+    std::shared_ptr<void> allocation;
+    if (data == nullptr && desc.data.format_kind != dnnl_format_kind_wino)
+        allocation = MemoryAllocator::allocateInScope(desc.get_size());
+
+    if (allocation) {
+        // oneDNN zeroes pads of the memory it allocates, so the pads of the own buffer are zeroed too
+        prim.reset(new memory(desc, eng, DNNL_MEMORY_NONE));
+        prim->set_data_handle(allocation.get());
+    } else if (data == nullptr) {
+        ownAllocation.reset();
         prim.reset(new memory(desc, eng));
 
         size_t real_size = 0;
@@ -86,6 +97,7 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
         //
         // ========================
     }
+    ownAllocation = std::move(allocation);
 }
 
 void MKLDNNMemory::Create(const MemoryDesc &desc, const void *data, bool pads_zeroing) {
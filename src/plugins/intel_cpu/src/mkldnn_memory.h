@@ -126,6 +126,8 @@ private:
     mkldnn::engine eng;
     bool useExternalStorage = false;
     size_t memUpperBound = 0ul;
+    // buffer of MemoryAllocator, the buffer is allocated by oneDNN if there is no allocator scope
+    std::shared_ptr<void> ownAllocation;
 };
 
 using MKLDNNMemoryPtr = std::shared_ptr<MKLDNNMemory>;
@@ -9,6 +9,7 @@
 #include "mkldnn_itt.h"
 
 #include "caseless.hpp"
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <limits>
@@ -303,16 +304,13 @@ bool MKLDNNNode::canBeInPlace() const {
         return false;
     }
 
-    if (getParentEdges().size() != 1 || getParentEdgeAt(0)->getParent()->getChildEdges().size() != 1 ||
-            (getParentEdgeAt(0)->getParent()->isConstant() && !getParentEdgeAt(0)->getChild()->isConstant()))
+    if (getParentEdges().size() != 1)
         return false;
 
     // TODO: we need to extend this logic to properly handle all possible inplace conflicts
-    if (getParentEdges().size() == 1 && getParentEdgeAt(0)->getParent()->getType() == Reshape) {
-        auto reshapeNode = getParentEdgeAt(0)->getParent();
-        if (reshapeNode->getParentEdgeAt(0)->getParent()->getChildEdges().size() != 1)
-            return false;
-    }
+    const auto memoryOwner = getInputMemoryOwner();
+    if (!memoryOwner || (memoryOwner->isConstant() && !isConstant()))
+        return false;
 
     auto inShape = getInputShapeAtPort(0);
     for (size_t cIdx = 0; cIdx < outputShapes.size(); cIdx++) {
@@ -323,6 +321,86 @@ bool MKLDNNNode::canBeInPlace() const {
     return true;
 }
 
+MKLDNNNodePtr MKLDNNNode::getInputMemoryOwner() const {
+    auto node = getParentEdgesAtPort(0)[0]->getParent();
+    while (node->getChildEdges().size() == 1) {
+        if (!one_of(node->getType(), Reshape, Gather, StridedSlice, Transpose) || node->getParentEdges().empty())
+            return node;
+        node = node->getParentEdgesAtPort(0)[0]->getParent();
+    }
+    return nullptr;
+}
+
+bool MKLDNNNode::canOutputBeView() const {
+    if (isDynamicNode() || getOutputShapeAtPort(0).hasZeroDims() || getParentEdgeAt(0)->getParent()->isConstant())
+        return false;
+
+    std::vector<MKLDNNNodePtr> consumers;
+    for (const auto& edge : getChildEdgesAtPort(0))
+        consumers.push_back(edge->getChild());
+    while (!consumers.empty()) {
+        const auto consumer = consumers.back();
+        consumers.pop_back();
+        if (consumer->getType() == Output)
+            return false;
+        // Reshape is in-place, so its consumers read the same memory
+        if (consumer->getType() == Reshape) {
+            for (const auto& edge : consumer->getChildEdgesAtPort(0))
+                consumers.push_back(edge->getChild());
+        }
+    }
+    return true;
+}
+
+MemoryDescPtr MKLDNNNode::makeViewDesc(InferenceEngine::Precision prc, const Shape& shape) {
+    const auto dense = BlockedDescCreator::getCommonCreators().at(LayoutType::ncsp)->createDesc(prc, shape);
+    return std::make_shared<CpuBlockedMemoryDesc>(prc, shape, dense.getBlockDims(), dense.getOrder(), Shape::UNDEFINED_DIM,
+                                                  VectorDims{}, dense.getStrides());
+}
+
+void MKLDNNNode::selectOptimalViewDescriptor() {
+    const auto isView = [](const NodeDesc& pd) {
+        return !pd.getConfig().outConfs.empty() && pd.getConfig().outConfs[0].inPlace >= 0;
+    };
+    auto view = std::find_if(supportedPrimitiveDescriptors.begin(), supportedPrimitiveDescriptors.end(), isView);
+    if (view != supportedPrimitiveDescriptors.end()) {
+        const auto parentEdge = getParentEdgeAt(0);
+        const auto parentPd = parentEdge->getParent()->getSelectedPrimitiveDescriptor();
+        if (parentPd != nullptr && !parentPd->getConfig().outConfs.empty()) {
+            int inNum = parentEdge->getInputNum();
+            if (inNum < 0 || inNum >= parentPd->getConfig().outConfs.size()) {
+                inNum = 0;
+            }
+            if (view->getConfig().inConfs[0].desc->isCompatible(*parentPd->getConfig().outConfs[inNum].desc)) {
+                selectPrimitiveDescriptorByIndex(static_cast<int>(view - supportedPrimitiveDescriptors.begin()));
+                return;
+            }
+        }
+        supportedPrimitiveDescriptors.erase(view);
+    }
+    MKLDNNNode::selectOptimalPrimitiveDescriptor();
+}
+
+void MKLDNNNode::initOptimalViewDescriptor(size_t viewOffset) {
+    auto selected_pd = getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr)
+        IE_THROW() << "Preferable primitive descriptor is not set.";
+    auto config = selected_pd->getConfig();
+    for (size_t i = 0; i < config.inConfs.size(); i++) {
+        config.inConfs[i].desc = getDefinedInputDesc(config, i);
+    }
+
+    const auto inDesc = config.inConfs[0].desc->as<BlockedMemoryDesc>();
+    const auto outDesc = config.outConfs[0].desc->as<BlockedMemoryDesc>();
+    config.outConfs[0].desc = std::make_shared<CpuBlockedMemoryDesc>(outDesc->getPrecision(), outDesc->getShape(), outDesc->getBlockDims(),
+                                                                     outDesc->getOrder(), inDesc->getOffsetPadding() + viewOffset);
+    initDescriptor(config);
+}
+
+bool MKLDNNNode::isOutputView() const {
+    return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].inPlace >= 0;
+}
+
 void MKLDNNNode::resolveInPlaceEdges() {
     // TODO [DS]: first version dynamic shapes do not support inPlace logic
     // after enabling inPlace logic for dynamic shapes we need to update this method for nodes with several edges at single port
@@ -415,6 +493,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     SEARCH_TYPE(uni);
 
     SEARCH_TYPE(winograd);
+    SEARCH_TYPE(sparse);
     SEARCH_TYPE(_dw);
     SEARCH_TYPE(_1x1);
 
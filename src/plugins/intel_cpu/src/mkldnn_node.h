@@ -679,6 +679,34 @@ protected:
     void selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& priority, bool ignoreConstInputs);
     bool isConfigDefined(const NodeConfig &config) const;
     virtual bool canBeInPlace() const;
+    /**
+     * @brief Returns the node which owns the memory of the input at port 0: the first node before the chain of
+     * Reshape and the data movement nodes, which may be views on their input memory. Returns nullptr if the memory
+     * is shared with other consumers
+     */
+    MKLDNNNodePtr getInputMemoryOwner() const;
+
+    /**
+     * @brief Checks if the output at port 0 can be a view on the memory of the input at port 0 instead of the data copy.
+     * Views aren't created for dynamic shapes, constant data and the data read by the graph outputs directly,
+     * since the outputs are pulled from the memory start regardless of the view offset
+     */
+    bool canOutputBeView() const;
+    /**
+     * @brief Plain descriptor of the view port with undefined offset, so it's compatible with the memory at any offset
+     */
+    static MemoryDescPtr makeViewDesc(InferenceEngine::Precision prc, const Shape& shape);
+    /**
+     * @brief Selects the view config only if the parent produces the memory of port 0 in the view layout, so no reorder
+     * of the whole input is inserted in front of the view. Otherwise the view config is dropped and the node keeps
+     * running on the layout of the parent
+     */
+    void selectOptimalViewDescriptor();
+    /**
+     * @brief Defines the selected view config: the output at port 0 starts viewOffset elements after the input at port 0
+     */
+    void initOptimalViewDescriptor(size_t viewOffset);
+    bool isOutputView() const;
 
     virtual const std::vector<impl_desc_type>& getPrimitivesPriority();
 
@@ -85,6 +85,8 @@
 #include "nodes/subgraph.h"
 #include "nodes/mkldnn_priorbox_node.h"
 #include "nodes/mkldnn_priorbox_clustered_node.h"
+#include "nodes/mkldnn_scaled_dot_product_attention_node.h"
+#include "nodes/mkldnn_fused_preprocessing_node.h"
 
 #define MKLDNN_NODE(__prim, __type) \
     registerNodeIfRequired(MKLDNNPlugin, __prim, __type, MKLDNNNodeImpl<__prim>)
@@ -178,4 +180,6 @@ MKLDNNPlugin::MKLDNNNode::NodesFactory::NodesFactory()
     MKLDNN_NODE(MKLDNNColorConvertNode, ColorConvert);
     MKLDNN_NODE(MKLDNNPriorBoxNode, PriorBox);
     MKLDNN_NODE(MKLDNNPriorBoxClusteredNode, PriorBoxClustered);
+    MKLDNN_NODE(MKLDNNScaledDotProductAttentionNode, ScaledDotProductAttention);
+    MKLDNN_NODE(MKLDNNFusedPreprocessingNode, FusedPreprocessing);
 }
@@ -9,6 +9,7 @@
 #include "mkldnn_extension.h"
 #include "mkldnn_itt.h"
 #include "mkldnn_serialize.h"
+#include "mkldnn_streams_tuner.h"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
@@ -16,6 +17,7 @@
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_icore.hpp>
 #include <fstream>
+#include <limits>
 #include <vector>
 #include <tuple>
 #include <unordered_set>
@@ -80,10 +82,12 @@
 #include <transformations/init_node_info.hpp>
 #include <transformations/disable_decompression_convert_constant_folding.hpp>
 #include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/op_conversions/fq_decomposition.hpp>
 #include <transformations/utils/utils.hpp>
 #include <snippets/pass/collapse_subgraph.hpp>
 #include "ngraph_transformations/snippets_mark_skipped.hpp"
+#include "ngraph_transformations/depth_first_tiling.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset2.hpp>
@@ -115,6 +119,7 @@
 #include "nodes/mkldnn_normalize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
+#include "ngraph_transformations/mark_fc_weights_decompression.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
@@ -153,6 +158,9 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     if (useLpt) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
+    } else {
+        // Weights-only compressed MatMuls: keep compressed constants to decompress them inside FullyConnected node
+        manager.register_pass<MarkFCWeightsDecompression>();
     }
     auto get_convert_precisions = []() {
         precisions_array array = {
@@ -406,6 +414,12 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
             return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForSubtract(node);
         });
+    } else {
+        // zero points subtraction of the compressed weights is fused into FullyConnected node as is
+        pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
+            const auto parent = node->get_input_node_shared_ptr(0);
+            return ngraph::is_type<ngraph::opset1::Convert>(parent) && ov::pass::constant_folding_is_disabled(parent);
+        });
     }
 
     manager.run_passes(nGraphFunc);
@@ -522,16 +536,24 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                     const auto& outputs = n->outputs();
                     const bool bad_output_rank = std::any_of(outputs.begin(), outputs.end(),
                                                              [&](const ov::Output<const ov::Node>& out) {return  rank_is_too_large(out.get_tensor());});
-                    return has_only_const_inputs || bad_input_rank || bad_output_rank;
+                    // weights decompression operations are fused into FullyConnected node
+                    auto is_decompression_input = [](const ov::Input<const ov::Node>& in) {
+                        auto parent = in.get_source_output().get_node_shared_ptr();
+                        if (ov::is_type<ngraph::opset1::Subtract>(parent))
+                            parent = parent->get_input_node_shared_ptr(0);
+                        return ov::is_type<ngraph::opset1::Convert>(parent) && ov::pass::constant_folding_is_disabled(parent);
+                    };
+                    const bool is_decompression = std::any_of(inputs.begin(), inputs.end(), is_decompression_input);
+                    return has_only_const_inputs || bad_input_rank || bad_output_rank || is_decompression;
                 });
         tokenization_manager.run_passes(nGraphFunc);
     }
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets, const Config& conf) {
     auto nGraphFunc = clonedNetwork.getFunction();
     TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets);
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    ConvertToCPUSpecificOpset(nGraphFunc, conf);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr
@@ -579,6 +601,21 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets);
 
     // Here the OV perf modes are turned into specific settings (as we need the network for better params selection)
+    const auto& tuningBudgetProp = config.find(PluginConfigInternalParams::KEY_CPU_PERFORMANCE_HINT_TUNING_BUDGET);
+    const bool enableTuning = (tuningBudgetProp != config.end()) ? tuningBudgetProp->second != "0"
+                                                                  : engConfig.perfHintTuningBudget > 0;
+    // the configurations to be benchmarked, the first one is chosen by the heuristics
+    std::vector<StreamsTuningCandidate> tuningCandidates;
+    bool tuneThroughput = false;
+    auto addTuningCandidate = [&](int streams, int threads) {
+        if (!enableTuning || streams <= 0)
+            return;
+        for (const auto& candidate : tuningCandidates) {
+            if (candidate.streams == streams && candidate.threads == threads)
+                return;
+        }
+        tuningCandidates.push_back({streams, threads});
+    };
     const auto& mode = config.find(PluginConfigParams::KEY_PERFORMANCE_HINT);
     // the mode may have just arrived to the LoadNetwork, or was set with the plugins' SetConfig
     if (mode != config.end() || !engConfig.perfHintsConfig.ovPerfHint.empty()) {
@@ -589,6 +626,12 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         if (streams == config.end() && !streamsSet) {
             if (mode_name == CONFIG_VALUE(LATENCY)) {
                 config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
+                // a stream per NUMA node (as the heuristics suggest) vs. single stream, all vs. physical cores only
+                const int numaNodes = static_cast<int>(getAvailableNUMANodes().size());
+                const int numCores = getNumberOfCPUCores();
+                addTuningCandidate(numaNodes, 0);
+                addTuningCandidate(1, 0);
+                addTuningCandidate(1, numCores);
             } else if (mode_name == CONFIG_VALUE(THROUGHPUT)) {
                 const auto isa = dnnl::get_effective_cpu_isa();
                 float isaSpecificThreshold = 1.0f;
@@ -636,29 +679,49 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
                     // network is below general threshold
                     num_streams = std::max(default_num_streams, num_streams_less_aggressive);
                 }
+                int max_streams = std::numeric_limits<int>::max();
                 auto num_requests = config.find(PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS);
                 if (num_requests != config.end()) {  // arrived with config to the LoadNetwork (and thus higher pri)
                     auto val = PerfHintsConfig::CheckPerformanceHintRequestValue(num_requests->second);
                     if (val > 0)
-                        num_streams = std::min(num_streams, val);
+                        max_streams = val;
                 } else if (engConfig.perfHintsConfig.ovPerfHintNumRequests) {  //set thru SetConfig to the plugin, 2nd priority
-                    num_streams = std::min(num_streams,
-                                           engConfig.perfHintsConfig.ovPerfHintNumRequests);
+                    max_streams = engConfig.perfHintsConfig.ovPerfHintNumRequests;
                 }
+                num_streams = std::min(num_streams, max_streams);
                 config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(num_streams);
+                // the heuristics may be wrong (e.g. for the networks with unknown memory pressure),
+                // so all the levels of aggressiveness are benchmarked
+                tuneThroughput = true;
+                addTuningCandidate(num_streams, 0);
+                for (auto streams : {num_cores, num_streams_less_aggressive, default_num_streams})
+                    addTuningCandidate(std::min(streams, max_streams), 0);
            }
         }
     }
-    ConvertToCPUSpecificOpset(nGraphFunc);
 
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
     Config conf = engConfig;
     conf.readProperties(config);
+
+    if (conf.depthFirstTiling) {
+        const size_t cacheSize = conf.depthFirstTilingCacheSize != 0 ? conf.depthFirstTilingCacheSize
+                                                                     : mkldnn::utils::get_cache_size(2 /*level*/, true /*per core */);
+        ngraph::pass::Manager tilingManager;
+        tilingManager.register_pass<DepthFirstTiling>(cacheSize);
+        tilingManager.run_passes(nGraphFunc);
+    }
+    ConvertToCPUSpecificOpset(nGraphFunc, conf);
+
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    if (tuningCandidates.size() > 1) {
+        return tuneStreams(clonedNetwork, conf, tuningCandidates, tuneThroughput, extensionManager, weightsSharing);
+    }
+
     return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
 }
 
@@ -786,7 +849,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
         const bool enableLPT = (lptProp != config.end() && lptProp->second == PluginConfigParams::YES) /* enabled in the orig_config*/
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
         const bool enableSnippets = !(conf.cache_dir.empty() || conf.enableDynamicBatch || (conf.enforceBF16 && with_cpu_x86_avx512_core()));
-        Transformation(clonedNetwork, enableLPT, enableSnippets);
+        Transformation(clonedNetwork, enableLPT, enableSnippets, conf);
         auto ops = clonedNetwork.getFunction()->get_ordered_ops();
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
@@ -869,7 +932,18 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
+    // the configuration tuned for the performance hint is reused, unless the streams are set explicitly
+    const auto& tunedConfig = deserializer.getConfig();
+    const bool applyTunedConfig = !tunedConfig.empty() && conf.perfHintTuningBudget > 0 && !streamsSet
+            && config.find(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) == config.end();
+    if (applyTunedConfig) {
+        conf.readProperties(tunedConfig);
+    }
+
     auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing);
+    if (applyTunedConfig) {
+        execNetwork->setTunedConfig(tunedConfig);
+    }
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
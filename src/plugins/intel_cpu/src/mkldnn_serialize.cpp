@@ -66,9 +66,11 @@ namespace {
     }
 };  // namespace
 
-CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager)
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                                           const std::map<std::string, std::string> & config)
     : _ostream(ostream)
-    , _extensionManager(extensionManager) {
+    , _extensionManager(extensionManager)
+    , _config(config) {
 }
 
 void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
@@ -114,6 +116,15 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
                     .set_value(to_string(out.second->getLayout()).c_str());
         }
 
+        if (!_config.empty()) {
+            pugi::xml_node config = root.append_child("config");
+            for (const auto & item : _config) {
+                auto item_node = config.append_child("item");
+                item_node.append_attribute("key").set_value(item.first.c_str());
+                item_node.append_attribute("value").set_value(item.second.c_str());
+            }
+        }
+
         xml_doc.save(stream);
     };
 
@@ -171,6 +182,17 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     setPrecisionsAndLayouts(inputs.children("in"), network.getInputsInfo());
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
+
+    // the blobs exported without the config are still valid
+    _config.clear();
+    for (auto item : root.child("config").children("item")) {
+        auto key_attr = item.attribute("key");
+        auto value_attr = item.attribute("value");
+        if (!key_attr || !value_attr) {
+            IE_THROW(NetworkNotRead) << "The executable network config is invalid.";
+        }
+        _config[key_attr.value()] = value_attr.value();
+    }
 }
 
 }  // namespace MKLDNNPlugin
@@ -6,18 +6,26 @@
 
 #include <iostream>
 #include <functional>
+#include <map>
+#include <string>
 #include <cpp/ie_cnn_network.h>
 
 namespace MKLDNNPlugin {
 
 class CNNNetworkSerializer {
 public:
-    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager);
+    /**
+     * @param config The properties of the executable network which are stored together with the network
+     *               (e.g. the tuned number of streams), they are restored by CNNNetworkDeserializer
+     */
+    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                         const std::map<std::string, std::string> & config = {});
     void operator << (const InferenceEngine::CNNNetwork & network);
 
 private:
     std::ostream & _ostream;
     MKLDNNExtensionManager::Ptr _extensionManager;
+    std::map<std::string, std::string> _config;
 };
 
 class CNNNetworkDeserializer {
@@ -29,9 +37,14 @@ public:
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
 
+    const std::map<std::string, std::string> & getConfig() const {
+        return _config;
+    }
+
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::map<std::string, std::string> _config;
 };
 
 // const std::string& model, const Blob::CPtr& weights
@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_streams_tuner.h"
+#include "mkldnn_itt.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <ie_plugin_config.hpp>
+#include <cpp/ie_infer_request.hpp>
+#include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+using Time = std::chrono::steady_clock;
+
+std::map<std::string, std::string> toConfig(const StreamsTuningCandidate& candidate) {
+    return {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(candidate.streams)},
+            {PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(candidate.threads)}};
+}
+
+// Runs the requests in a loop during the given time and returns the number of completed inferences per second
+double measure(const MKLDNNExecNetwork::Ptr& execNetwork, size_t numRequests, Time::duration duration) {
+    std::vector<IInferRequestInternal::Ptr> requests;
+    for (size_t i = 0; i < numRequests; i++) {
+        auto request = execNetwork->CreateInferRequest();
+        for (const auto& input : execNetwork->GetInputsInfo()) {
+            // the content doesn't matter, but uninitialized memory may contain denormals which slow down inference
+            auto blob = as<MemoryBlob>(request->GetBlob(input.first));
+            if (blob) {
+                auto lock = blob->wmap();
+                std::memset(lock.as<uint8_t*>(), 0, blob->byteSize());
+            }
+        }
+        requests.push_back(request);
+    }
+
+    // the first inference includes one-time initializations, so it's excluded from the measurement
+    for (auto& request : requests)
+        request->StartAsync();
+    for (auto& request : requests)
+        request->Wait(InferRequest::WaitMode::RESULT_READY);
+
+    const auto start = Time::now();
+    for (auto& request : requests)
+        request->StartAsync();
+
+    size_t inferences = 0;
+    Time::duration elapsed{};
+    for (size_t i = 0;; i = (i + 1) % requests.size()) {
+        requests[i]->Wait(InferRequest::WaitMode::RESULT_READY);
+        inferences++;
+        elapsed = Time::now() - start;
+        if (elapsed >= duration)
+            break;
+        requests[i]->StartAsync();
+    }
+    for (auto& request : requests)
+        request->Wait(InferRequest::WaitMode::RESULT_READY);
+
+    return inferences / std::chrono::duration<double>(elapsed).count();
+}
+
+}  // namespace
+
+MKLDNNExecNetwork::Ptr tuneStreams(const CNNNetwork& network,
+                                   const Config& config,
+                                   const std::vector<StreamsTuningCandidate>& candidates,
+                                   bool throughput,
+                                   const MKLDNNExtensionManager::Ptr& extMgr,
+                                   NumaNodesWeights& weightsSharing) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "tuneStreams");
+    if (candidates.empty())
+        IE_THROW() << "There are no candidate configurations for tuning of the streams";
+
+    const auto budget = std::chrono::milliseconds(config.perfHintTuningBudget);
+    const auto measurementDuration = budget / static_cast<int>(candidates.size());
+    const auto start = Time::now();
+
+    MKLDNNExecNetwork::Ptr bestNetwork;
+    StreamsTuningCandidate bestCandidate = candidates.front();
+    double bestPerformance = 0;
+    for (const auto& candidate : candidates) {
+        if (bestNetwork && Time::now() - start >= budget)
+            break;
+
+        Config candidateConfig = config;
+        candidateConfig.readProperties(toConfig(candidate));
+        auto execNetwork = std::make_shared<MKLDNNExecNetwork>(network, candidateConfig, extMgr, weightsSharing);
+        execNetwork->setNetworkInputs(copyInfo(network.getInputsInfo()));
+        execNetwork->setNetworkOutputs(copyInfo(network.getOutputsInfo()));
+
+        double performance = 0;
+        try {
+            const size_t numRequests = throughput ? std::max(1, candidateConfig.streamExecutorConfig._streams) : 1;
+            performance = measure(execNetwork, numRequests, measurementDuration);
+        } catch (...) {
+            // the network can't be measured (e.g. dynamic shapes), so the candidate is used only as a fallback
+        }
+
+        if (!bestNetwork || performance > bestPerformance) {
+            bestNetwork = execNetwork;
+            bestCandidate = candidate;
+            bestPerformance = performance;
+        }
+    }
+
+    bestNetwork->setTunedConfig(toConfig(bestCandidate));
+    return bestNetwork;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_exec_network.h"
+
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct StreamsTuningCandidate {
+    int streams;
+    int threads;  // 0 means the default number of threads
+};
+
+/**
+ * @brief Compiles the network for each candidate configuration, benchmarks it for its share of the time budget
+ * (config.perfHintTuningBudget) and returns the fastest network. The candidates are tried in the given order and
+ * the rest of them are skipped once the budget is exhausted, so the configuration chosen by the heuristics should
+ * go first. The chosen configuration is set to the network as tuned config.
+ * @param throughput Whether the candidates are compared by throughput of the optimal number of requests or by latency
+ *                   of the single request
+ */
+MKLDNNExecNetwork::Ptr tuneStreams(const InferenceEngine::CNNNetwork& network,
+                                   const Config& config,
+                                   const std::vector<StreamsTuningCandidate>& candidates,
+                                   bool throughput,
+                                   const MKLDNNExtensionManager::Ptr& extMgr,
+                                   NumaNodesWeights& weightsSharing);
+
+}  // namespace MKLDNNPlugin
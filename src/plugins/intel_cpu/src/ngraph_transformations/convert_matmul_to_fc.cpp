@@ -3,17 +3,19 @@
 //
 
 #include "convert_matmul_to_fc.hpp"
+#include "mark_fc_weights_decompression.hpp"
 #include "op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 
 NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ConvertMatMulToFC, "ConvertMatMulToFC", 0);
 
 MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant, ngraph::opset1::Multiply, ngraph::opset1::Reshape>();
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -28,6 +30,7 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
         // So in case of adding new operations that takes matmul inputs we need keep update fc_input_a and fc_input_b.
         auto fc_input_a = pattern_map.at(activations_m);
         auto fc_input_b = pattern_map.at(weights_m);
+        const bool weightsDecompression = isFCWeightsDecompression(fc_input_b.get_node_shared_ptr());
 
         auto shape_a = fc_input_a.get_partial_shape();
         auto shape_b = fc_input_b.get_partial_shape();
@@ -44,7 +47,7 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
+        if ((!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) && !weightsDecompression) ||
             std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
@@ -117,6 +120,46 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
             return transpose;
         };
 
+        /*
+         *  transpose_decompression function transposes weights decompression subgraph (see MarkFCWeightsDecompression):
+         *  compressed weights, zero points and scales constants are transposed separately, so the decompression operations
+         *  are kept on the constant path in front of FullyConnected and can be fused into it by the graph optimizer.
+         */
+
+        auto transpose_decompression = [&create_transpose](const ngraph::Output<ngraph::Node>& multiply, ngraph::NodeVector& new_ops) {
+            auto transpose_const_input = [&](const ngraph::Output<ngraph::Node>& input) {
+                auto const_input = input;
+                // per-tensor and per-channel values are aligned to the weights rank before transposition
+                if (const_input.get_shape().size() < 2) {
+                    ngraph::Shape aligned_shape(2, 1);
+                    std::copy(const_input.get_shape().rbegin(), const_input.get_shape().rend(), aligned_shape.rbegin());
+                    auto aligned_shape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, aligned_shape);
+                    const_input = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(const_input, aligned_shape_const, false);
+                }
+                return create_transpose(const_input, input.get_node()->get_friendly_name() + "/transpose_b")->output(0);
+            };
+
+            const auto multiply_node = multiply.get_node_shared_ptr();
+            const size_t scale_port = ngraph::is_type<ngraph::opset1::Constant>(multiply_node->get_input_node_ptr(1)) ? 1 : 0;
+            auto decompression = multiply_node->input_value(1 - scale_port).get_node_shared_ptr();
+            auto subtract = std::dynamic_pointer_cast<ngraph::opset1::Subtract>(decompression);
+            auto convert = subtract ? subtract->get_input_node_shared_ptr(0) : decompression;
+
+            auto new_convert = convert->clone_with_new_inputs({ transpose_const_input(convert->input_value(0)) });
+            ov::disable_constant_folding(new_convert);
+            new_ops.push_back(new_convert);
+
+            std::shared_ptr<ngraph::Node> new_decompression = new_convert;
+            if (subtract) {
+                new_decompression = subtract->clone_with_new_inputs({ new_convert, transpose_const_input(subtract->input_value(1)) });
+                new_ops.push_back(new_decompression);
+            }
+            auto new_multiply = multiply_node->clone_with_new_inputs({ new_decompression, transpose_const_input(multiply_node->input_value(scale_port)) });
+            new_multiply->set_friendly_name(multiply_node->get_friendly_name() + "/transpose_b");
+            new_ops.push_back(new_multiply);
+            return new_multiply->output(0);
+        };
+
         ngraph::NodeVector new_ops;
         bool success = true;
         ngraph::PartialShape shape_a_aligned, shape_b_aligned;
@@ -135,8 +178,16 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Weights normalization
         if (!matmul->get_transpose_b()) {
-            fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
-            new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            if (weightsDecompression) {
+                // MarkFCWeightsDecompression doesn't mark group-wise decompression for non-transposed weights
+                if (!ngraph::is_type<ngraph::opset1::Multiply>(fc_input_b.get_node_shared_ptr())) {
+                    return false;
+                }
+                fc_input_b = transpose_decompression(fc_input_b, new_ops);
+            } else {
+                fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
+                new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            }
         }
 
         if (rank_b != 2) {
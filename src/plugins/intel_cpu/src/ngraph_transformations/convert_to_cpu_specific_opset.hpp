@@ -18,11 +18,20 @@
 #include "transformations/convert_precision.hpp"
 #include "transformations/utils/utils.hpp"
 #include "rnn_sequences_optimization.hpp"
+#include "scaled_dot_product_attention_fusion.hpp"
+#include "preprocessing_fusion.hpp"
+#include "config.h"
 
 namespace MKLDNNPlugin {
 
-inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphFunc) {
+inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphFunc, const Config& config) {
     ngraph::pass::Manager manager;
+    if (config.preprocessingFusion) {
+        manager.register_pass<PreprocessingFusion>();
+    }
+    if (config.sdpaFusion) {
+        manager.register_pass<ScaledDotProductAttentionFusion>();
+    }
     manager.register_pass<ConvertMatMulToFC>();
     manager.register_pass<AlignMatMulInputRanks>();
     manager.register_pass<ConvertTileToSeqTiles>();
@@ -0,0 +1,330 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "depth_first_tiling.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::DepthFirstTiling, "DepthFirstTiling", 0);
+
+namespace {
+
+constexpr size_t heightAxis = 2;
+// thinner bands aren't worth it: the halo recomputation and the per node overheads outweigh the cache savings
+constexpr size_t minBandRows = 8;
+// the maximal share of the rows computed more than once because of the overlapping halo regions
+constexpr float maxRecomputation = 0.25f;
+
+// describes which input rows are required to compute an output row along the height
+struct Window {
+    size_t kernel = 1;  // including dilation
+    size_t stride = 1;
+    size_t padBegin = 0;
+};
+
+struct Link {
+    std::shared_ptr<ngraph::Node> node;
+    size_t dataInput = 0;  // the input which is produced by the previous link of the chain
+    bool spatial = false;
+    Window window;
+};
+
+struct Rows {
+    size_t begin;
+    size_t end;
+    // the padding of the band, it's non-zero only at the borders of the image
+    size_t padBegin;
+    size_t padEnd;
+};
+
+struct Band {
+    size_t inputBegin;
+    size_t inputEnd;
+    std::vector<Rows> outputs;  // per link
+};
+
+bool isTileableTensor(const std::shared_ptr<ngraph::Node>& node, size_t dataInput) {
+    if (node->get_output_size() != 1 || node->get_output_partial_shape(0).is_dynamic() ||
+        node->get_output_partial_shape(0).rank().get_length() != 4 ||
+        node->get_input_partial_shape(dataInput).is_dynamic())
+        return false;
+    // the data precision is kept along the chain, e.g. the low precision operations have another output type
+    const auto& precision = node->get_input_element_type(dataInput);
+    return precision.is_real() && node->get_output_element_type(0) == precision;
+}
+
+bool isConstantAlongHeight(const ngraph::Node* constant) {
+    const auto& shape = constant->get_output_shape(0);
+    return shape.size() < 2 || shape[shape.size() - 2] == 1;
+}
+
+template <typename T>
+bool getWindow(const std::shared_ptr<T>& op, size_t kernel, Window& window) {
+    const auto& strides = op->get_strides();
+    const auto& padsBegin = op->get_pads_begin();
+    const auto& padsEnd = op->get_pads_end();
+    if (strides.size() != 2 || padsBegin.size() != 2 || padsEnd.size() != 2 ||
+        static_cast<int64_t>(padsBegin[0]) < 0 || static_cast<int64_t>(padsEnd[0]) < 0)
+        return false;
+    window.kernel = kernel;
+    window.stride = strides[0];
+    window.padBegin = static_cast<size_t>(padsBegin[0]);
+    return true;
+}
+
+bool getLink(const std::shared_ptr<ngraph::Node>& node, Link& link) {
+    link.node = node;
+    link.dataInput = 0;
+    link.spatial = false;
+
+    if (ov::is_type<ngraph::opset1::Convolution>(node) || ov::is_type<ngraph::opset1::GroupConvolution>(node)) {
+        if (!isTileableTensor(node, 0) || node->get_input_partial_shape(1).is_dynamic())
+            return false;
+        const auto& weightsShape = node->get_input_shape(1);
+        const auto kernel = weightsShape[weightsShape.size() - 2];
+        link.spatial = true;
+        if (const auto conv = ov::as_type_ptr<ngraph::opset1::Convolution>(node))
+            return getWindow(conv, (kernel - 1) * conv->get_dilations()[0] + 1, link.window);
+        const auto groupConv = ov::as_type_ptr<ngraph::opset1::GroupConvolution>(node);
+        return getWindow(groupConv, (kernel - 1) * groupConv->get_dilations()[0] + 1, link.window);
+    }
+
+    if (const auto maxPool = ov::as_type_ptr<ngraph::opset1::MaxPool>(node)) {
+        if (!isTileableTensor(node, 0) || maxPool->get_rounding_type() != ngraph::op::RoundingType::FLOOR)
+            return false;
+        link.spatial = true;
+        return getWindow(maxPool, maxPool->get_kernel()[0], link.window);
+    }
+
+    if (const auto avgPool = ov::as_type_ptr<ngraph::opset1::AvgPool>(node)) {
+        if (!isTileableTensor(node, 0) || avgPool->get_rounding_type() != ngraph::op::RoundingType::FLOOR)
+            return false;
+        link.spatial = true;
+        return getWindow(avgPool, avgPool->get_kernel()[0], link.window);
+    }
+
+    if (ov::is_type<ngraph::op::util::UnaryElementwiseArithmetic>(node) || ov::is_type<ngraph::opset1::Clamp>(node)) {
+        return isTileableTensor(node, 0) && node->get_input_shape(0) == node->get_output_shape(0);
+    }
+
+    // per-tensor or per-channel constants (biases, scales, slopes) don't depend on the row
+    if (ov::is_type<ngraph::op::util::BinaryElementwiseArithmetic>(node) || ov::is_type<ngraph::opset1::PRelu>(node)) {
+        if (ngraph::op::is_constant(node->get_input_node_ptr(1))) {
+            link.dataInput = 0;
+        } else if (ngraph::op::is_constant(node->get_input_node_ptr(0)) && !ov::is_type<ngraph::opset1::PRelu>(node)) {
+            link.dataInput = 1;
+        } else {
+            return false;
+        }
+        return isTileableTensor(node, link.dataInput) &&
+               node->get_input_shape(link.dataInput) == node->get_output_shape(0) &&
+               isConstantAlongHeight(node->get_input_node_ptr(1 - link.dataInput));
+    }
+
+    return false;
+}
+
+// follows the single consumers of the spatial operation while they can be computed band by band
+std::vector<Link> buildChain(const std::shared_ptr<ngraph::Node>& node) {
+    std::vector<Link> chain;
+    Link link;
+    if (!getLink(node, link) || !link.spatial)
+        return chain;
+    chain.push_back(link);
+
+    while (true) {
+        const auto consumers = chain.back().node->get_output_target_inputs(0);
+        if (consumers.size() != 1)
+            break;
+        const auto& consumer = *consumers.begin();
+        if (!getLink(consumer.get_node()->shared_from_this(), link) || link.dataInput != consumer.get_index())
+            break;
+        chain.push_back(link);
+    }
+    return chain;
+}
+
+// propagates the output rows of the chain back to its input
+Band getBand(const std::vector<Link>& chain, size_t begin, size_t end) {
+    Band band;
+    band.outputs.resize(chain.size());
+    for (size_t i = chain.size(); i-- > 0;) {
+        const auto& link = chain[i];
+        band.outputs[i] = {begin, end, 0, 0};
+        if (!link.spatial)
+            continue;
+
+        const auto inputHeight = static_cast<int64_t>(link.node->get_input_shape(link.dataInput)[heightAxis]);
+        const auto& window = link.window;
+        const auto first = static_cast<int64_t>(begin * window.stride) - static_cast<int64_t>(window.padBegin);
+        const auto last = static_cast<int64_t>((end - 1) * window.stride + window.kernel) - static_cast<int64_t>(window.padBegin);
+        band.outputs[i].padBegin = static_cast<size_t>(std::max<int64_t>(-first, 0));
+        band.outputs[i].padEnd = static_cast<size_t>(std::max<int64_t>(last - inputHeight, 0));
+        begin = static_cast<size_t>(std::max<int64_t>(first, 0));
+        end = static_cast<size_t>(std::min(last, inputHeight));
+    }
+    band.inputBegin = begin;
+    band.inputEnd = end;
+    return band;
+}
+
+std::vector<Band> splitIntoBands(const std::vector<Link>& chain, size_t bandsNum) {
+    const auto height = chain.back().node->get_output_shape(0)[heightAxis];
+    std::vector<Band> bands;
+    for (size_t i = 0; i < bandsNum; i++)
+        bands.push_back(getBand(chain, height * i / bandsNum, height * (i + 1) / bandsNum));
+    return bands;
+}
+
+float getRecomputation(const std::vector<Link>& chain, const std::vector<Band>& bands) {
+    size_t rows = 0;
+    size_t bandRows = 0;
+    for (size_t i = 0; i < chain.size(); i++) {
+        if (!chain[i].spatial)
+            continue;
+        rows += chain[i].node->get_output_shape(0)[heightAxis];
+        for (const auto& band : bands)
+            bandRows += band.outputs[i].end - band.outputs[i].begin;
+    }
+    return static_cast<float>(bandRows) / rows - 1.f;
+}
+
+size_t getBytes(const ngraph::Output<ngraph::Node>& output) {
+    return ngraph::shape_size(output.get_shape()) * output.get_element_type().size();
+}
+
+std::vector<Band> getBands(const std::vector<Link>& chain, size_t cacheSize) {
+    // the eltwise operations are fused into the convolutions by the plugin, so only the spatial ones are accounted
+    size_t footprint = getBytes(chain.front().node->input_value(chain.front().dataInput));
+    for (const auto& link : chain) {
+        if (link.spatial)
+            footprint += getBytes(link.node->output(0));
+    }
+
+    const auto height = chain.back().node->get_output_shape(0)[heightAxis];
+    size_t bandsNum = std::min((footprint + cacheSize - 1) / cacheSize, height / minBandRows);
+    for (; bandsNum > 1; bandsNum--) {
+        auto bands = splitIntoBands(chain, bandsNum);
+        if (getRecomputation(chain, bands) <= maxRecomputation)
+            return bands;
+    }
+    return {};
+}
+
+template <typename T>
+T withHeightPad(T pads, size_t pad) {
+    pads[0] = static_cast<typename T::value_type>(pad);
+    return pads;
+}
+
+std::shared_ptr<ngraph::Node> cloneForBand(const Link& link, const ngraph::Output<ngraph::Node>& data, const Rows& rows) {
+    const auto& node = link.node;
+    if (const auto conv = ov::as_type_ptr<ngraph::opset1::Convolution>(node)) {
+        return std::make_shared<ngraph::opset1::Convolution>(data, conv->input_value(1), conv->get_strides(),
+                                                             withHeightPad(conv->get_pads_begin(), rows.padBegin),
+                                                             withHeightPad(conv->get_pads_end(), rows.padEnd),
+                                                             conv->get_dilations(), ngraph::op::PadType::EXPLICIT);
+    }
+    if (const auto groupConv = ov::as_type_ptr<ngraph::opset1::GroupConvolution>(node)) {
+        return std::make_shared<ngraph::opset1::GroupConvolution>(data, groupConv->input_value(1), groupConv->get_strides(),
+                                                                  withHeightPad(groupConv->get_pads_begin(), rows.padBegin),
+                                                                  withHeightPad(groupConv->get_pads_end(), rows.padEnd),
+                                                                  groupConv->get_dilations(), ngraph::op::PadType::EXPLICIT);
+    }
+    if (const auto maxPool = ov::as_type_ptr<ngraph::opset1::MaxPool>(node)) {
+        return std::make_shared<ngraph::opset1::MaxPool>(data, maxPool->get_strides(),
+                                                         withHeightPad(maxPool->get_pads_begin(), rows.padBegin),
+                                                         withHeightPad(maxPool->get_pads_end(), rows.padEnd),
+                                                         maxPool->get_kernel(), maxPool->get_rounding_type(),
+                                                         ngraph::op::PadType::EXPLICIT);
+    }
+    if (const auto avgPool = ov::as_type_ptr<ngraph::opset1::AvgPool>(node)) {
+        return std::make_shared<ngraph::opset1::AvgPool>(data, avgPool->get_strides(),
+                                                         withHeightPad(avgPool->get_pads_begin(), rows.padBegin),
+                                                         withHeightPad(avgPool->get_pads_end(), rows.padEnd),
+                                                         avgPool->get_kernel(), avgPool->get_exclude_pad(),
+                                                         avgPool->get_rounding_type(), ngraph::op::PadType::EXPLICIT);
+    }
+    auto inputs = node->input_values();
+    inputs[link.dataInput] = data;
+    return node->clone_with_new_inputs(inputs);
+}
+
+void tile(const std::vector<Link>& chain, const std::vector<Band>& bands) {
+    const auto& first = chain.front();
+    const auto& last = chain.back().node;
+    const auto source = first.node->input_value(first.dataInput);
+    const auto inputHeight = source.get_shape()[heightAxis];
+
+    ngraph::NodeVector originalNodes;
+    for (const auto& link : chain)
+        originalNodes.push_back(link.node);
+
+    ngraph::NodeVector newNodes;
+    ngraph::OutputVector bandOutputs;
+    for (size_t b = 0; b < bands.size(); b++) {
+        const auto& band = bands[b];
+        auto data = source;
+        if (band.inputBegin != 0 || band.inputEnd != inputHeight) {
+            const auto begin = ngraph::opset1::Constant::create<int64_t>(ngraph::element::i64, ngraph::Shape{4},
+                                                                         {0, 0, static_cast<int64_t>(band.inputBegin), 0});
+            const auto end = ngraph::opset1::Constant::create<int64_t>(ngraph::element::i64, ngraph::Shape{4},
+                                                                       {0, 0, static_cast<int64_t>(band.inputEnd), 0});
+            const std::vector<int64_t> mask = {1, 1, 0, 1};
+            const auto slice = std::make_shared<ngraph::opset1::StridedSlice>(source, begin, end, mask, mask);
+            slice->set_friendly_name(first.node->get_friendly_name() + "/band_" + std::to_string(b) + "/slice");
+            newNodes.push_back(slice);
+            data = slice->output(0);
+        }
+        for (size_t i = 0; i < chain.size(); i++) {
+            const auto clone = cloneForBand(chain[i], data, band.outputs[i]);
+            clone->set_friendly_name(chain[i].node->get_friendly_name() + "/band_" + std::to_string(b));
+            newNodes.push_back(clone);
+            data = clone->output(0);
+        }
+        bandOutputs.push_back(data);
+    }
+
+    const auto concat = std::make_shared<ngraph::opset1::Concat>(bandOutputs, heightAxis);
+    concat->set_friendly_name(last->get_friendly_name());
+    newNodes.push_back(concat);
+    ngraph::copy_runtime_info(originalNodes, newNodes);
+    ngraph::replace_node(last, concat);
+}
+
+}  // namespace
+
+bool MKLDNNPlugin::DepthFirstTiling::run_on_model(const std::shared_ptr<ov::Model> &m) {
+    if (m_cacheSize == 0)
+        return false;
+
+    std::vector<std::vector<Link>> chains;
+    std::unordered_set<ngraph::Node*> visited;
+    for (const auto& node : m->get_ordered_ops()) {
+        if (visited.count(node.get()))
+            continue;
+        auto chain = buildChain(node);
+        for (const auto& link : chain)
+            visited.insert(link.node.get());
+        // a single spatial operation has no intermediates to keep in cache
+        if (std::count_if(chain.begin(), chain.end(), [](const Link& link) { return link.spatial; }) > 1)
+            chains.push_back(std::move(chain));
+    }
+
+    bool rewritten = false;
+    for (const auto& chain : chains) {
+        const auto bands = getBands(chain, m_cacheSize);
+        if (bands.size() > 1) {
+            tile(chain, bands);
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
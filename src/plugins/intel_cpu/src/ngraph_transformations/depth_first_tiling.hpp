@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+/**
+ * @interface DepthFirstTiling
+ * @brief Splits chains of convolutions, poolings and per-channel eltwise operations into horizontal bands, so that
+ * the intermediate tensors of one band fit the given cache size. Each band takes the rows of the chain input it
+ * depends on (including the halo required by the kernels) and the band results are concatenated along the height.
+ * The CPU graph executes the bands one after another through the whole chain (depth-first) and reuses the memory
+ * of the band intermediates, so they stay in cache instead of being written to and read from the main memory.
+ */
+class DepthFirstTiling : public ov::pass::ModelPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit DepthFirstTiling(size_t cacheSize) : ModelPass(), m_cacheSize(cacheSize) {}
+    bool run_on_model(const std::shared_ptr<ov::Model> &) override;
+
+private:
+    size_t m_cacheSize;
+};
+
+}  // namespace MKLDNNPlugin
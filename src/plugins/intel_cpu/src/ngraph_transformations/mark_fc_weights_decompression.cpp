@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_fc_weights_decompression.hpp"
+
+#include <algorithm>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MarkFCWeightsDecompression, "MarkFCWeightsDecompression", 0);
+
+namespace {
+
+bool hasSingleConsumer(const std::shared_ptr<const ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+// Walks Reshape -> Multiply -> Subtract -> Convert -> Constant chain and returns the Convert operation
+// or nullptr if the node isn't the last operation of the weights decompression subgraph.
+std::shared_ptr<ngraph::Node> getDecompressionConvert(const std::shared_ptr<const ngraph::Node>& node) {
+    auto current = std::const_pointer_cast<ngraph::Node>(node);
+    const size_t weightsRank = ngraph::is_type<ngraph::opset1::Reshape>(current) ? 3 : 2;
+    if (ngraph::is_type<ngraph::opset1::Reshape>(current)) {
+        if (!ngraph::is_type<ngraph::opset1::Constant>(current->get_input_node_ptr(1)) || !hasSingleConsumer(current->get_input_node_shared_ptr(0)))
+            return nullptr;
+        current = current->get_input_node_shared_ptr(0);
+    }
+
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(current))
+        return nullptr;
+    const size_t scalePort = ngraph::is_type<ngraph::opset1::Constant>(current->get_input_node_ptr(1)) ? 1 : 0;
+    if (!ngraph::is_type<ngraph::opset1::Constant>(current->get_input_node_ptr(scalePort)))
+        return nullptr;
+    current = current->get_input_node_shared_ptr(1 - scalePort);
+    if (!hasSingleConsumer(current))
+        return nullptr;
+
+    if (ngraph::is_type<ngraph::opset1::Subtract>(current)) {
+        if (!ngraph::is_type<ngraph::opset1::Constant>(current->get_input_node_ptr(1)))
+            return nullptr;
+        current = current->get_input_node_shared_ptr(0);
+        if (!hasSingleConsumer(current))
+            return nullptr;
+    }
+
+    if (!ngraph::is_type<ngraph::opset1::Convert>(current) || !current->get_output_element_type(0).is_real())
+        return nullptr;
+
+    const auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(current->get_input_node_shared_ptr(0));
+    if (!weights || weights->get_shape().size() != weightsRank)
+        return nullptr;
+
+    static const ngraph::element::TypeVector compressedPrecisions = {
+        ngraph::element::u8, ngraph::element::i8, ngraph::element::u4, ngraph::element::i4
+    };
+    if (std::find(compressedPrecisions.begin(), compressedPrecisions.end(), weights->get_element_type()) == compressedPrecisions.end())
+        return nullptr;
+
+    return current;
+}
+
+} // namespace
+
+bool MKLDNNPlugin::isFCWeightsDecompression(const std::shared_ptr<const ngraph::Node>& node) {
+    const auto convert = getDecompressionConvert(node);
+    return convert && ov::pass::constant_folding_is_disabled(convert);
+}
+
+MKLDNNPlugin::MarkFCWeightsDecompression::MarkFCWeightsDecompression() {
+    auto activations_m = ngraph::pattern::any_input();
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply, ngraph::opset1::Reshape>(ngraph::pattern::consumers_count(1));
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        const auto weights = pattern_map.at(weights_m).get_node_shared_ptr();
+        if (!matmul || transformation_callback(matmul))
+            return false;
+
+        // group-wise scales are applied along K dimension, so only [N, K] weights layout can be fused without transposition
+        if (ngraph::is_type<ngraph::opset1::Reshape>(weights) && !matmul->get_transpose_b())
+            return false;
+
+        const auto convert = getDecompressionConvert(weights);
+        if (!convert || ov::pass::constant_folding_is_disabled(convert))
+            return false;
+
+        ov::disable_constant_folding(convert);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, "MarkFCWeightsDecompression");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     MarkFCWeightsDecompression disables constant folding for the Convert operation of weights-only compressed
+ *     MatMul weights, so the compressed constant is kept in the graph and the decompression subgraph can be fused
+ *     into FullyConnected node later:
+ *
+ *         Constant (u8/i8/u4/i4)
+ *              |
+ *           Convert    Constant (zero point, optional)
+ *               \      /
+ *               Subtract   Constant (scale)
+ *                  \       /
+ *                   Multiply
+ *                      |
+ *                   Reshape (optional, group-wise compression only)
+ *                      |
+ *                    MatMul (input port 1)
+ */
+
+class MarkFCWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkFCWeightsDecompression();
+};
+
+/**
+ * @brief Checks that the node is the last operation of a weights decompression subgraph marked by MarkFCWeightsDecompression
+ */
+bool isFCWeightsDecompression(const std::shared_ptr<const ngraph::Node>& node);
+
+}  // namespace MKLDNNPlugin
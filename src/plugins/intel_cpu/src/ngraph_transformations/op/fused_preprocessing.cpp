@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_preprocessing.hpp"
+
+#include <algorithm>
+
+namespace {
+
+using ColorFormat = MKLDNNPlugin::FusedPreprocessingNode::ColorFormat;
+using ResizeMode = MKLDNNPlugin::FusedPreprocessingNode::ResizeMode;
+
+const std::vector<std::pair<ColorFormat, std::string>> colorFormatNames = {
+    {ColorFormat::NONE, "none"},
+    {ColorFormat::NV12_TO_RGB, "nv12_to_rgb"},
+    {ColorFormat::NV12_TO_BGR, "nv12_to_bgr"},
+    {ColorFormat::I420_TO_RGB, "i420_to_rgb"},
+    {ColorFormat::I420_TO_BGR, "i420_to_bgr"},
+};
+
+const std::vector<std::pair<ResizeMode, std::string>> resizeModeNames = {
+    {ResizeMode::NONE, "none"},
+    {ResizeMode::NEAREST, "nearest"},
+    {ResizeMode::LINEAR, "linear"},
+};
+
+template <typename T>
+std::string toString(const std::vector<std::pair<T, std::string>>& names, T value) {
+    const auto it = std::find_if(names.begin(), names.end(), [&](const std::pair<T, std::string>& item) {
+        return item.first == value;
+    });
+    return it == names.end() ? std::string() : it->second;
+}
+
+template <typename T>
+bool fromString(const std::vector<std::pair<T, std::string>>& names, const std::string& name, T& value) {
+    const auto it = std::find_if(names.begin(), names.end(), [&](const std::pair<T, std::string>& item) {
+        return item.second == name;
+    });
+    if (it == names.end())
+        return false;
+    value = it->first;
+    return true;
+}
+
+}  // namespace
+
+MKLDNNPlugin::FusedPreprocessingNode::FusedPreprocessingNode(const ngraph::OutputVector& planes, const Attributes& attrs)
+    : Op(planes), m_attrs(attrs) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::FusedPreprocessingNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::FusedPreprocessingNode>(new_args, m_attrs);
+}
+
+void MKLDNNPlugin::FusedPreprocessingNode::validate_and_infer_types() {
+    const auto input_size = get_input_size();
+    const bool nv12 = m_attrs.colorFormat == ColorFormat::NV12_TO_RGB || m_attrs.colorFormat == ColorFormat::NV12_TO_BGR;
+    const bool i420 = m_attrs.colorFormat == ColorFormat::I420_TO_RGB || m_attrs.colorFormat == ColorFormat::I420_TO_BGR;
+    NODE_VALIDATION_CHECK(this,
+        input_size == 1 || (nv12 && input_size == 2) || (i420 && input_size == 3),
+        "Number of inputs is incorrect. Current value is: ", input_size, ".");
+    NODE_VALIDATION_CHECK(this,
+        m_attrs.resizeMode == ResizeMode::NONE || (m_attrs.outputHeight > 0 && m_attrs.outputWidth > 0),
+        "Output spatial size of the resize is incorrect.");
+
+    for (size_t i = 0; i < input_size; i++) {
+        const auto& type = get_input_element_type(i);
+        NODE_VALIDATION_CHECK(this,
+            type.is_dynamic() || type == ngraph::element::u8 || type == ngraph::element::f32,
+            "Only u8 and f32 inputs are supported. Current type is: ", type, ".");
+    }
+
+    const auto& input_pshape = get_input_partial_shape(0);
+    if (input_pshape.rank().is_dynamic()) {
+        set_output_type(0, ngraph::element::f32, ngraph::PartialShape::dynamic(4));
+        return;
+    }
+    NODE_VALIDATION_CHECK(this,
+        input_pshape.rank().get_length() == 4,
+        "Input rank must be 4. Current value is: ", input_pshape.rank(), ".");
+
+    ngraph::Dimension batch = input_pshape[0];
+    ngraph::Dimension height, width, channels;
+    if (nv12 || i420) {
+        height = input_pshape[1];
+        if (input_size == 1 && height.is_static())
+            height = height.get_length() * 2 / 3;
+        else if (input_size == 1)
+            height = ngraph::Dimension::dynamic();
+        width = input_pshape[2];
+        channels = 3;
+    } else if (m_attrs.inputChannelsLast) {
+        height = input_pshape[1];
+        width = input_pshape[2];
+        channels = input_pshape[3];
+    } else {
+        channels = input_pshape[1];
+        height = input_pshape[2];
+        width = input_pshape[3];
+    }
+
+    if (m_attrs.resizeMode != ResizeMode::NONE) {
+        height = m_attrs.outputHeight;
+        width = m_attrs.outputWidth;
+    }
+
+    const auto channel_values_compatible = [&](const std::vector<float>& values) {
+        return values.size() == 1 || channels.compatible(static_cast<int64_t>(values.size()));
+    };
+    NODE_VALIDATION_CHECK(this,
+        channel_values_compatible(m_attrs.scale) && channel_values_compatible(m_attrs.shift),
+        "Scale and shift must be scalars or per-channel values.");
+
+    const auto output_pshape = m_attrs.outputChannelsLast ? ngraph::PartialShape{batch, height, width, channels}
+                                                          : ngraph::PartialShape{batch, channels, height, width};
+    set_output_type(0, ngraph::element::f32, output_pshape);
+}
+
+bool MKLDNNPlugin::FusedPreprocessingNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    auto color_format = toString(colorFormatNames, m_attrs.colorFormat);
+    auto resize_mode = toString(resizeModeNames, m_attrs.resizeMode);
+    visitor.on_attribute("color_format", color_format);
+    visitor.on_attribute("round_color", m_attrs.roundColor);
+    visitor.on_attribute("input_channels_last", m_attrs.inputChannelsLast);
+    visitor.on_attribute("resize_mode", resize_mode);
+    visitor.on_attribute("output_height", m_attrs.outputHeight);
+    visitor.on_attribute("output_width", m_attrs.outputWidth);
+    visitor.on_attribute("scale", m_attrs.scale);
+    visitor.on_attribute("shift", m_attrs.shift);
+    visitor.on_attribute("output_channels_last", m_attrs.outputChannelsLast);
+    NODE_VALIDATION_CHECK(this,
+        fromString(colorFormatNames, color_format, m_attrs.colorFormat) &&
+        fromString(resizeModeNames, resize_mode, m_attrs.resizeMode),
+        "Unknown color format or resize mode: ", color_format, ", ", resize_mode, ".");
+    return true;
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Performs the typical image preprocessing of a model input in one operation:
+ * optional NV12/I420 to RGB/BGR conversion, conversion to f32, optional resize of the height and width,
+ * per-channel affine transformation x * scale + shift and optional change of the layout.
+ * The inputs are the image planes: [N, H, W, C] or [N, C, H, W] image, or NV12/I420 planes as ConvertColor operations
+ * take them. The output is the f32 image in NHWC or NCHW layout.
+ */
+class FusedPreprocessingNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("FusedPreprocessing", "cpu_plugin_opset");
+
+    enum class ColorFormat {
+        NONE,
+        NV12_TO_RGB,
+        NV12_TO_BGR,
+        I420_TO_RGB,
+        I420_TO_BGR
+    };
+
+    enum class ResizeMode {
+        NONE,
+        NEAREST,
+        LINEAR
+    };
+
+    struct Attributes {
+        ColorFormat colorFormat = ColorFormat::NONE;
+        // the color conversion is performed in the integer input precision, so the converted values are rounded
+        bool roundColor = false;
+        bool inputChannelsLast = false;
+        // the resize uses half_pixel coordinates, NEAREST mode rounds them with round_prefer_floor rule
+        ResizeMode resizeMode = ResizeMode::NONE;
+        int64_t outputHeight = 0;
+        int64_t outputWidth = 0;
+        // per-channel or scalar values
+        std::vector<float> scale = {1.f};
+        std::vector<float> shift = {0.f};
+        bool outputChannelsLast = false;
+    };
+
+    FusedPreprocessingNode() = default;
+
+    FusedPreprocessingNode(const ngraph::OutputVector& planes, const Attributes& attrs);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    const Attributes& get_attrs() const { return m_attrs; }
+
+private:
+    Attributes m_attrs;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention.hpp"
+
+MKLDNNPlugin::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::OutputVector& args,
+                                                                           float scale,
+                                                                           bool transpose_key)
+    : Op(args), m_scale(scale), m_transpose_key(transpose_key) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::ScaledDotProductAttentionNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(new_args, m_scale, m_transpose_key);
+}
+
+void MKLDNNPlugin::ScaledDotProductAttentionNode::validate_and_infer_types() {
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        input_size == 3 || input_size == 4,
+        "Number of inputs is incorrect. Current value is: ",
+        input_size,
+        ", expected: 3 or 4.");
+
+    const auto& query_pshape = get_input_partial_shape(0);
+    const auto& key_pshape = get_input_partial_shape(1);
+    const auto& value_pshape = get_input_partial_shape(2);
+    if (query_pshape.rank().is_dynamic() || key_pshape.rank().is_dynamic() || value_pshape.rank().is_dynamic()) {
+        set_output_type(0, get_input_element_type(0), ngraph::PartialShape::dynamic());
+        return;
+    }
+
+    const auto rank = query_pshape.rank().get_length();
+    NODE_VALIDATION_CHECK(this,
+        rank >= 2 && key_pshape.rank().get_length() == rank && value_pshape.rank().get_length() == rank,
+        "Query, key and value must have the same rank not less than 2. Current ranks are: ",
+        query_pshape.rank(), ", ", key_pshape.rank(), ", ", value_pshape.rank(), ".");
+
+    const auto head_size = query_pshape[rank - 1];
+    const auto key_head_size = m_transpose_key ? key_pshape[rank - 1] : key_pshape[rank - 2];
+    const auto key_length = m_transpose_key ? key_pshape[rank - 2] : key_pshape[rank - 1];
+    NODE_VALIDATION_CHECK(this,
+        head_size.compatible(key_head_size) && key_length.compatible(value_pshape[rank - 2]),
+        "Shapes of query, key and value are incompatible: ",
+        query_pshape, ", ", key_pshape, ", ", value_pshape, ".");
+
+    // the batch dimensions of all the inputs are broadcasted
+    auto batch_pshape = ngraph::PartialShape(std::vector<ngraph::Dimension>(query_pshape.begin(), query_pshape.end() - 2));
+    auto merge_batch = [&](const ngraph::PartialShape& pshape) {
+        if (pshape.rank().is_dynamic() || pshape.rank().get_length() <= 2)
+            return;
+        const auto input_batch = ngraph::PartialShape(std::vector<ngraph::Dimension>(pshape.begin(), pshape.end() - 2));
+        NODE_VALIDATION_CHECK(this,
+            ngraph::PartialShape::broadcast_merge_into(batch_pshape, input_batch, ngraph::op::AutoBroadcastType::NUMPY),
+            "Batch dimensions of the inputs can't be broadcasted: ", pshape, ".");
+    };
+    merge_batch(key_pshape);
+    merge_batch(value_pshape);
+    if (input_size == 4)
+        merge_batch(get_input_partial_shape(3));
+
+    auto output_pshape = batch_pshape;
+    output_pshape.push_back(query_pshape[rank - 2]);
+    output_pshape.push_back(value_pshape[rank - 1]);
+    set_output_type(0, get_input_element_type(0), output_pshape);
+}
+
+bool MKLDNNPlugin::ScaledDotProductAttentionNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("transpose_key", m_transpose_key);
+    return true;
+}
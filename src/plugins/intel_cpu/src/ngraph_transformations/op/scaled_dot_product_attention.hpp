@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Computes Softmax(Q * K^T * scale + mask) * V over the last two dimensions of the inputs:
+ * Q [B1, ..., Bn, Lq, D], K [B1, ..., Bn, Lk, D] ([B1, ..., Bn, D, Lk] if transpose_key is false),
+ * V [B1, ..., Bn, Lk, Dv] and the optional mask, which is broadcasted to [B1, ..., Bn, Lq, Lk].
+ * The batch dimensions are broadcasted by numpy rules, the output is [B1, ..., Bn, Lq, Dv].
+ */
+class ScaledDotProductAttentionNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ScaledDotProductAttention", "cpu_plugin_opset");
+
+    ScaledDotProductAttentionNode() = default;
+
+    ScaledDotProductAttentionNode(const ngraph::OutputVector& args, float scale, bool transpose_key);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_key() const { return m_transpose_key; }
+
+private:
+    float m_scale = 1.f;
+    bool m_transpose_key = true;
+};
+
+}  // namespace MKLDNNPlugin
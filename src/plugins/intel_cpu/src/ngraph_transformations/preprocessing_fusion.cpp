@@ -0,0 +1,281 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocessing_fusion.hpp"
+#include "op/fused_preprocessing.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::PreprocessingFusion, "PreprocessingFusion", 0);
+
+namespace {
+
+using ColorFormat = MKLDNNPlugin::FusedPreprocessingNode::ColorFormat;
+using ResizeMode = MKLDNNPlugin::FusedPreprocessingNode::ResizeMode;
+
+enum class Layout {
+    UNKNOWN,
+    CHANNELS_FIRST,
+    CHANNELS_LAST
+};
+
+struct Chain {
+    MKLDNNPlugin::FusedPreprocessingNode::Attributes attrs;
+    ngraph::OutputVector planes;
+    ngraph::NodeVector nodes;
+    ngraph::element::Type type;
+    // the layout of the tensor at the end of the chain, it's determined by the first layout dependent operation
+    Layout layout = Layout::UNKNOWN;
+    bool transposed = false;
+};
+
+bool isSupportedType(const ngraph::element::Type& type) {
+    return type == ngraph::element::u8 || type == ngraph::element::f32;
+}
+
+bool setLayout(Chain& chain, Layout layout) {
+    if (chain.layout == Layout::UNKNOWN)
+        chain.layout = layout;
+    return chain.layout == layout;
+}
+
+bool matchColorConversion(const std::shared_ptr<ngraph::Node>& node, Chain& chain) {
+    if (ov::is_type<ngraph::opset8::NV12toRGB>(node)) {
+        chain.attrs.colorFormat = ColorFormat::NV12_TO_RGB;
+    } else if (ov::is_type<ngraph::opset8::NV12toBGR>(node)) {
+        chain.attrs.colorFormat = ColorFormat::NV12_TO_BGR;
+    } else if (ov::is_type<ngraph::opset8::I420toRGB>(node)) {
+        chain.attrs.colorFormat = ColorFormat::I420_TO_RGB;
+    } else if (ov::is_type<ngraph::opset8::I420toBGR>(node)) {
+        chain.attrs.colorFormat = ColorFormat::I420_TO_BGR;
+    } else {
+        return false;
+    }
+
+    for (const auto& plane : node->input_values()) {
+        if (!ov::is_type<ngraph::opset1::Parameter>(plane.get_node()) || plane.get_target_inputs().size() != 1)
+            return false;
+    }
+    chain.type = node->get_output_element_type(0);
+    if (!isSupportedType(chain.type) || node->get_output_partial_shape(0).rank().is_dynamic())
+        return false;
+
+    chain.attrs.roundColor = chain.type.is_integral();
+    chain.planes = node->input_values();
+    chain.layout = Layout::CHANNELS_LAST;
+    chain.nodes.push_back(node);
+    return true;
+}
+
+bool appendResize(const std::shared_ptr<ngraph::opset4::Interpolate>& interpolate, Chain& chain) {
+    using Interpolate = ngraph::opset4::Interpolate;
+    const auto& attrs = interpolate->get_attrs();
+    const auto isZero = [](size_t pad) { return pad == 0; };
+    if (chain.type != ngraph::element::f32 || chain.attrs.resizeMode != ResizeMode::NONE ||
+        attrs.shape_calculation_mode != Interpolate::ShapeCalcMode::SIZES ||
+        attrs.coordinate_transformation_mode != Interpolate::CoordinateTransformMode::HALF_PIXEL ||
+        attrs.antialias || !std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), isZero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), isZero) || interpolate->get_input_size() != 4)
+        return false;
+
+    if (attrs.mode == Interpolate::InterpolateMode::NEAREST &&
+        attrs.nearest_mode == Interpolate::NearestMode::ROUND_PREFER_FLOOR) {
+        chain.attrs.resizeMode = ResizeMode::NEAREST;
+    } else if (attrs.mode == Interpolate::InterpolateMode::LINEAR ||
+               attrs.mode == Interpolate::InterpolateMode::LINEAR_ONNX) {
+        // without antialiasing both modes are the bilinear interpolation with the clamped coordinates
+        chain.attrs.resizeMode = ResizeMode::LINEAR;
+    } else {
+        return false;
+    }
+
+    const auto axesConst = ov::as_type_ptr<ngraph::opset1::Constant>(interpolate->get_input_node_shared_ptr(3));
+    const auto& outShape = interpolate->get_output_partial_shape(0);
+    if (!axesConst || outShape.rank().is_dynamic() || outShape.rank().get_length() != 4)
+        return false;
+    const auto axes = axesConst->cast_vector<int64_t>();
+    if (axes == std::vector<int64_t>{1, 2}) {
+        if (!setLayout(chain, Layout::CHANNELS_LAST))
+            return false;
+    } else if (axes == std::vector<int64_t>{2, 3}) {
+        if (!setLayout(chain, Layout::CHANNELS_FIRST))
+            return false;
+    } else {
+        return false;
+    }
+    if (outShape[axes[0]].is_dynamic() || outShape[axes[1]].is_dynamic())
+        return false;
+
+    chain.attrs.outputHeight = outShape[axes[0]].get_length();
+    chain.attrs.outputWidth = outShape[axes[1]].get_length();
+    return true;
+}
+
+// accumulates x * scale + shift transformation: the interpolation weights sum up to 1, so the per-channel affine
+// operations before and after the resize are merged
+bool appendEltwise(const std::shared_ptr<ngraph::Node>& eltwise, const ngraph::Output<ngraph::Node>& data, Chain& chain) {
+    if (chain.type != ngraph::element::f32 || eltwise->get_autob() != ngraph::op::AutoBroadcastType::NUMPY)
+        return false;
+
+    const bool commutative = ov::is_type<ngraph::opset1::Add>(eltwise) || ov::is_type<ngraph::opset1::Multiply>(eltwise);
+    const size_t dataIdx = eltwise->input_value(0) == data ? 0 : 1;
+    if (dataIdx == 1 && !commutative)
+        return false;
+    const auto constant = ov::as_type_ptr<ngraph::opset1::Constant>(eltwise->get_input_node_shared_ptr(1 - dataIdx));
+    const auto& dataShape = data.get_partial_shape();
+    if (!constant || dataShape.rank().is_dynamic() || dataShape.rank().get_length() != 4 || constant->get_shape().size() > 4)
+        return false;
+
+    // the constant may only vary along the channels
+    auto constShape = constant->get_shape();
+    constShape.insert(constShape.begin(), 4 - constShape.size(), 1);
+    std::vector<size_t> varyingAxes;
+    for (size_t i = 0; i < constShape.size(); i++) {
+        if (constShape[i] != 1)
+            varyingAxes.push_back(i);
+    }
+    auto values = constant->cast_vector<float>();
+    if (!varyingAxes.empty()) {
+        const auto axis = varyingAxes.front();
+        if (varyingAxes.size() != 1 || (axis != 1 && axis != 3) ||
+            !setLayout(chain, axis == 1 ? Layout::CHANNELS_FIRST : Layout::CHANNELS_LAST) ||
+            dataShape[axis].is_dynamic() || dataShape[axis].get_length() != static_cast<int64_t>(values.size()))
+            return false;
+    }
+
+    auto& scale = chain.attrs.scale;
+    auto& shift = chain.attrs.shift;
+    if (values.size() > 1 && scale.size() == 1) {
+        scale.resize(values.size(), scale.front());
+        shift.resize(values.size(), shift.front());
+    }
+    if (scale.size() > 1 && values.size() == 1)
+        values.resize(scale.size(), values.front());
+    if (values.size() != scale.size())
+        return false;
+
+    for (size_t c = 0; c < values.size(); c++) {
+        if (ov::is_type<ngraph::opset1::Add>(eltwise)) {
+            shift[c] += values[c];
+        } else if (ov::is_type<ngraph::opset1::Subtract>(eltwise)) {
+            shift[c] -= values[c];
+        } else if (ov::is_type<ngraph::opset1::Multiply>(eltwise)) {
+            scale[c] *= values[c];
+            shift[c] *= values[c];
+        } else {
+            if (values[c] == 0.f)
+                return false;
+            scale[c] /= values[c];
+            shift[c] /= values[c];
+        }
+    }
+    return true;
+}
+
+bool appendTranspose(const std::shared_ptr<ngraph::opset1::Transpose>& transpose, Chain& chain) {
+    const auto orderConst = ov::as_type_ptr<ngraph::opset1::Constant>(transpose->get_input_node_shared_ptr(1));
+    if (!orderConst || chain.transposed)
+        return false;
+
+    const auto order = orderConst->cast_vector<int64_t>();
+    if (order == std::vector<int64_t>{0, 3, 1, 2}) {
+        if (!setLayout(chain, Layout::CHANNELS_LAST))
+            return false;
+        chain.layout = Layout::CHANNELS_FIRST;
+    } else if (order == std::vector<int64_t>{0, 2, 3, 1}) {
+        if (!setLayout(chain, Layout::CHANNELS_FIRST))
+            return false;
+        chain.layout = Layout::CHANNELS_LAST;
+    } else {
+        return false;
+    }
+    chain.transposed = true;
+    return true;
+}
+
+bool append(const std::shared_ptr<ngraph::Node>& node, const ngraph::Output<ngraph::Node>& data, Chain& chain) {
+    if (const auto convert = ov::as_type_ptr<ngraph::opset1::Convert>(node)) {
+        if (convert->get_destination_type() != ngraph::element::f32)
+            return false;
+        chain.type = ngraph::element::f32;
+        return true;
+    }
+    if (const auto interpolate = ov::as_type_ptr<ngraph::opset4::Interpolate>(node))
+        return appendResize(interpolate, chain);
+    if (const auto transpose = ov::as_type_ptr<ngraph::opset1::Transpose>(node))
+        return appendTranspose(transpose, chain);
+    if (ov::is_type<ngraph::opset1::Add>(node) || ov::is_type<ngraph::opset1::Subtract>(node) ||
+        ov::is_type<ngraph::opset1::Multiply>(node) || ov::is_type<ngraph::opset1::Divide>(node))
+        return appendEltwise(node, data, chain);
+    return false;
+}
+
+Chain buildChain(const std::shared_ptr<ngraph::opset1::Parameter>& parameter) {
+    Chain chain;
+    const auto& targets = parameter->output(0).get_target_inputs();
+    if (targets.size() != 1)
+        return chain;
+
+    ngraph::Output<ngraph::Node> current = parameter->output(0);
+    const auto consumer = targets.begin()->get_node()->shared_from_this();
+    if (matchColorConversion(consumer, chain)) {
+        // the chain is built once from the parameter of the first plane
+        if (consumer->input_value(0) != current)
+            return Chain{};
+        current = consumer->output(0);
+    } else {
+        chain.type = parameter->get_element_type();
+        chain.planes = {current};
+        if (!isSupportedType(chain.type))
+            return chain;
+    }
+
+    while (current.get_target_inputs().size() == 1) {
+        const auto next = current.get_target_inputs().begin()->get_node()->shared_from_this();
+        // the copy of the chain keeps the state consistent if the node can't be appended
+        Chain extended = chain;
+        if (next->get_output_size() != 1 || !append(next, current, extended))
+            break;
+        chain = std::move(extended);
+        chain.nodes.push_back(next);
+        current = next->output(0);
+    }
+    return chain;
+}
+
+}  // namespace
+
+bool MKLDNNPlugin::PreprocessingFusion::run_on_model(const std::shared_ptr<ov::Model> &m) {
+    bool rewritten = false;
+    for (const auto& parameter : m->get_parameters()) {
+        auto chain = buildChain(parameter);
+        if (chain.nodes.size() < 2 || chain.type != ngraph::element::f32 ||
+            (chain.attrs.colorFormat == ColorFormat::NONE && chain.attrs.resizeMode == ResizeMode::NONE))
+            continue;
+
+        // only scalar operations don't determine the layout, so any layout is fine
+        if (chain.layout == Layout::UNKNOWN)
+            chain.layout = Layout::CHANNELS_FIRST;
+        chain.attrs.outputChannelsLast = chain.layout == Layout::CHANNELS_LAST;
+        chain.attrs.inputChannelsLast = chain.transposed ? !chain.attrs.outputChannelsLast : chain.attrs.outputChannelsLast;
+
+        const auto last = chain.nodes.back();
+        const auto fused = std::make_shared<FusedPreprocessingNode>(chain.planes, chain.attrs);
+        if (!fused->get_output_partial_shape(0).compatible(last->get_output_partial_shape(0)))
+            continue;
+
+        fused->set_friendly_name(last->get_friendly_name());
+        ngraph::copy_runtime_info(chain.nodes, fused);
+        ngraph::replace_node(last, fused);
+        rewritten = true;
+    }
+    return rewritten;
+}
@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @interface PreprocessingFusion
+ * @brief Fuses the preprocessing of the model inputs, as PrePostProcessor inserts it, into FusedPreprocessingNode.
+ * The fused chain starts at the Parameter(s) and consists of the optional NV12/I420 color conversion, conversion
+ * to f32, resize of the height and width, per-channel Add/Subtract/Multiply/Divide by constants and Transpose
+ * between NHWC and NCHW layouts. The chain is fused only if it contains the color conversion or the resize,
+ * so the intermediate full-size tensors aren't written to and read from the memory.
+ */
+class PreprocessingFusion : public ov::pass::ModelPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_model(const std::shared_ptr<ov::Model> &) override;
+};
+
+}  // namespace MKLDNNPlugin
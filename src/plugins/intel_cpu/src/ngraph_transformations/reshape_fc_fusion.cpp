@@ -3,6 +3,7 @@
 //
 
 #include "reshape_fc_fusion.hpp"
+#include "mark_fc_weights_decompression.hpp"
 #include "op/fully_connected.hpp"
 #include <numeric>
 #include <ngraph/opsets/opset1.hpp>
@@ -43,6 +44,11 @@ MKLDNNPlugin::ReshapeFullyConnectedFusion::ReshapeFullyConnectedFusion() {
             return false;
         }
 
+        // weights decompression can be fused into FullyConnected only for 2D weights
+        if (isFCWeightsDecompression(fc->get_input_node_shared_ptr(1))) {
+            return false;
+        }
+
         ngraph::NodeVector new_ops;
         auto weightInput = fc->input(1).get_source_output();
         ngraph::Shape newWeightsShape;
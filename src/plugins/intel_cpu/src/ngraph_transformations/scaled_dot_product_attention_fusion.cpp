@@ -0,0 +1,145 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_fusion.hpp"
+#include "op/scaled_dot_product_attention.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ScaledDotProductAttentionFusion, "ScaledDotProductAttentionFusion", 0);
+
+namespace {
+
+bool hasSingleConsumer(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+bool isSupportedPrecision(const ngraph::element::Type& precision) {
+    return precision == ngraph::element::f32 || precision == ngraph::element::bf16;
+}
+
+// Q * K^T or (Q * K^T) * scale or (Q * K^T) / scale
+std::shared_ptr<ngraph::opset1::MatMul> getScores(const ngraph::Output<ngraph::Node>& output, float& scale,
+                                                  ngraph::NodeVector& fusedNodes) {
+    auto node = output.get_node_shared_ptr();
+    scale = 1.f;
+    if (ov::is_type<ngraph::opset1::Multiply>(node) || ov::is_type<ngraph::opset1::Divide>(node)) {
+        const auto scaleConst = ov::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+        if (!scaleConst || ngraph::shape_size(scaleConst->get_shape()) != 1 || !hasSingleConsumer(node->input_value(0)))
+            return nullptr;
+        scale = scaleConst->cast_vector<float>()[0];
+        if (ov::is_type<ngraph::opset1::Divide>(node)) {
+            if (scale == 0.f)
+                return nullptr;
+            scale = 1.f / scale;
+        }
+        fusedNodes.push_back(node);
+        node = node->get_input_node_shared_ptr(0);
+    }
+
+    auto matmul = ov::as_type_ptr<ngraph::opset1::MatMul>(node);
+    if (!matmul || matmul->get_transpose_a())
+        return nullptr;
+    fusedNodes.push_back(matmul);
+    return matmul;
+}
+
+}  // namespace
+
+MKLDNNPlugin::ScaledDotProductAttentionFusion::ScaledDotProductAttentionFusion() {
+    auto softmax_m = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>(ngraph::pattern::consumers_count(1));
+    auto value_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ softmax_m, value_m }, ngraph::pattern::has_static_rank());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+
+        auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        if (!matmul || transformation_callback(matmul) || matmul->get_transpose_a() || matmul->get_transpose_b()) {
+            return false;
+        }
+
+        const auto softmax = pattern_map.at(softmax_m).get_node_shared_ptr();
+        const auto rank = softmax->get_input_partial_shape(0).rank();
+        if (rank.is_dynamic() || rank.get_length() < 2)
+            return false;
+        int64_t axis = 0;
+        if (const auto softmax1 = ov::as_type_ptr<ngraph::opset1::Softmax>(softmax)) {
+            axis = static_cast<int64_t>(softmax1->get_axis());
+        } else {
+            axis = ov::as_type_ptr<ngraph::opset8::Softmax>(softmax)->get_axis();
+            if (axis < 0)
+                axis += rank.get_length();
+        }
+        if (axis != rank.get_length() - 1)
+            return false;
+
+        ngraph::NodeVector fusedNodes{matmul, softmax};
+        float scale = 1.f;
+        std::shared_ptr<ngraph::opset1::MatMul> scores;
+        ngraph::Output<ngraph::Node> mask;
+        const auto softmaxInput = softmax->input_value(0);
+        if (ov::is_type<ngraph::opset1::Add>(softmaxInput.get_node())) {
+            const auto add = softmaxInput.get_node_shared_ptr();
+            // the mask may be added from either side
+            for (size_t i = 0; i < 2 && !scores; i++) {
+                ngraph::NodeVector scoresNodes;
+                if (!hasSingleConsumer(add->input_value(i)))
+                    continue;
+                scores = getScores(add->input_value(i), scale, scoresNodes);
+                if (scores) {
+                    mask = add->input_value(1 - i);
+                    fusedNodes.insert(fusedNodes.end(), scoresNodes.begin(), scoresNodes.end());
+                }
+            }
+            fusedNodes.push_back(add);
+        } else {
+            scores = getScores(softmaxInput, scale, fusedNodes);
+        }
+        if (!scores || !hasSingleConsumer(scores->output(0)))
+            return false;
+
+        const auto query = scores->input_value(0);
+        const auto key = scores->input_value(1);
+        const auto value = pattern_map.at(value_m);
+        const auto precision = query.get_element_type();
+        if (!isSupportedPrecision(precision) || key.get_element_type() != precision || value.get_element_type() != precision ||
+            matmul->get_output_element_type(0) != precision)
+            return false;
+        for (const auto& input : {query, key, value}) {
+            if (input.get_partial_shape().rank() != rank)
+                return false;
+        }
+
+        ngraph::OutputVector inputs{query, key, value};
+        if (mask.get_node()) {
+            // the mask must not broadcast the scores matrix itself
+            const auto& maskShape = mask.get_partial_shape();
+            const auto& scoresShape = scores->get_output_partial_shape(0);
+            if (!mask.get_element_type().is_real() || maskShape.rank().is_dynamic() || maskShape.rank().get_length() > rank.get_length())
+                return false;
+            const auto maskRank = maskShape.rank().get_length();
+            for (int64_t i = 1; i <= std::min<int64_t>(maskRank, 2); i++) {
+                const auto& maskDim = maskShape[maskRank - i];
+                if (!(maskDim.compatible(1) || maskDim.compatible(scoresShape[rank.get_length() - i])))
+                    return false;
+            }
+            inputs.push_back(mask);
+        }
+
+        auto attention = std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(inputs, scale, scores->get_transpose_b());
+        if (!attention->get_output_partial_shape(0).compatible(matmul->get_output_partial_shape(0)))
+            return false;
+
+        attention->set_friendly_name(matmul->get_friendly_name());
+        ngraph::copy_runtime_info(fusedNodes, attention);
+        ngraph::replace_node(matmul, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, "ScaledDotProductAttentionFusion");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Fuses the attention pattern MatMul(Q, K^T) -> [Multiply/Divide by scalar] -> [Add mask] -> Softmax -> MatMul(V)
+ * into ScaledDotProductAttentionNode, which doesn't materialize the full attention scores matrix.
+ */
+class ScaledDotProductAttentionFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ScaledDotProductAttentionFusion();
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,365 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "cpu_memcpy.h"
+#include "ie_parallel.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// Prime radices above this value are not worth the O(radix^2) butterfly, Bluestein is used for them
+constexpr size_t maxGenericRadix = 31;
+// Shorter sequences are transformed by one thread even if parallelization is requested
+constexpr size_t minParallelLength = 1 << 14;
+constexpr double pi = 3.141592653589793238462643;
+
+struct Complex {
+    float re;
+    float im;
+};
+
+inline Complex operator+(const Complex& lhs, const Complex& rhs) {
+    return {lhs.re + rhs.re, lhs.im + rhs.im};
+}
+
+inline Complex operator-(const Complex& lhs, const Complex& rhs) {
+    return {lhs.re - rhs.re, lhs.im - rhs.im};
+}
+
+inline Complex operator*(const Complex& lhs, const Complex& rhs) {
+    return {lhs.re * rhs.re - lhs.im * rhs.im, lhs.re * rhs.im + lhs.im * rhs.re};
+}
+
+inline Complex operator*(const Complex& lhs, float rhs) {
+    return {lhs.re * rhs, lhs.im * rhs};
+}
+
+// Multiplication by -i
+inline Complex rotate(const Complex& value) {
+    return {value.im, -value.re};
+}
+
+inline Complex load(const float* data, size_t index) {
+    return {data[2 * index], data[2 * index + 1]};
+}
+
+inline void store(float* data, size_t index, const Complex& value) {
+    data[2 * index] = value.re;
+    data[2 * index + 1] = value.im;
+}
+
+/*
+ * Forward butterflies: in-place DFT of 'radix' values
+ */
+template <size_t radix>
+struct Butterfly;
+
+template <>
+struct Butterfly<2> {
+    static inline void apply(Complex* a, const float*) {
+        const Complex t = a[0] - a[1];
+        a[0] = a[0] + a[1];
+        a[1] = t;
+    }
+};
+
+template <>
+struct Butterfly<3> {
+    static inline void apply(Complex* a, const float*) {
+        constexpr float sin60 = 0.866025403784438646764f;
+        const Complex sum = a[1] + a[2];
+        const Complex mid = a[0] - sum * 0.5f;
+        const Complex diff = rotate(a[1] - a[2]) * sin60;
+        a[0] = a[0] + sum;
+        a[1] = mid + diff;
+        a[2] = mid - diff;
+    }
+};
+
+template <>
+struct Butterfly<4> {
+    static inline void apply(Complex* a, const float*) {
+        const Complex t0 = a[0] + a[2];
+        const Complex t1 = a[0] - a[2];
+        const Complex t2 = a[1] + a[3];
+        const Complex t3 = rotate(a[1] - a[3]);
+        a[0] = t0 + t2;
+        a[1] = t1 + t3;
+        a[2] = t0 - t2;
+        a[3] = t1 - t3;
+    }
+};
+
+template <>
+struct Butterfly<5> {
+    static inline void apply(Complex* a, const float*) {
+        constexpr float cos72 = 0.309016994374947424102f;
+        constexpr float cos144 = -0.809016994374947424102f;
+        constexpr float sin72 = 0.951056516295153572116f;
+        constexpr float sin144 = 0.587785252292473129169f;
+        const Complex t1 = a[1] + a[4];
+        const Complex t2 = a[2] + a[3];
+        const Complex t3 = a[1] - a[4];
+        const Complex t4 = a[2] - a[3];
+        const Complex m1 = a[0] + t1 * cos72 + t2 * cos144;
+        const Complex m2 = a[0] + t1 * cos144 + t2 * cos72;
+        const Complex n1 = rotate(t3 * sin72 + t4 * sin144);
+        const Complex n2 = rotate(t3 * sin144 - t4 * sin72);
+        a[0] = a[0] + t1 + t2;
+        a[1] = m1 + n1;
+        a[4] = m1 - n1;
+        a[2] = m2 + n2;
+        a[3] = m2 - n2;
+    }
+};
+
+/*
+ * One Stockham autosort stage: every butterfly takes 'radix' values with the distance 'count' * 'stride' and writes
+ * them twiddled with the distance 'stride'. Butterflies are enumerated as (butterfly, sequence) pairs and the range
+ * [start, end) of them is processed, sequences are the inner loop, so the memory is accessed sequentially.
+ */
+template <size_t radix>
+void stageRange(const float* src, float* dst, size_t count, size_t stride, const float* twiddles, const float* roots,
+                size_t start, size_t end) {
+    size_t butterfly = start / stride;
+    size_t sequence = start % stride;
+    Complex values[radix];
+    for (size_t index = start; index < end; ++index) {
+        const float* w = twiddles + 2 * butterfly * (radix - 1);
+        for (size_t r = 0; r < radix; ++r)
+            values[r] = load(src, sequence + stride * (butterfly + r * count));
+
+        Butterfly<radix>::apply(values, roots);
+
+        const size_t dstOffset = sequence + stride * radix * butterfly;
+        store(dst, dstOffset, values[0]);
+        for (size_t k = 1; k < radix; ++k)
+            store(dst, dstOffset + stride * k, values[k] * Complex{w[2 * (k - 1)], w[2 * (k - 1) + 1]});
+
+        if (++sequence == stride) {
+            sequence = 0;
+            ++butterfly;
+        }
+    }
+}
+
+void genericStageRange(const float* src, float* dst, size_t radix, size_t count, size_t stride, const float* twiddles,
+                       const float* roots, size_t start, size_t end) {
+    size_t butterfly = start / stride;
+    size_t sequence = start % stride;
+    Complex values[maxGenericRadix];
+    for (size_t index = start; index < end; ++index) {
+        const float* w = twiddles + 2 * butterfly * (radix - 1);
+        for (size_t r = 0; r < radix; ++r)
+            values[r] = load(src, sequence + stride * (butterfly + r * count));
+
+        const size_t dstOffset = sequence + stride * radix * butterfly;
+        for (size_t k = 0; k < radix; ++k) {
+            Complex sum = values[0];
+            size_t rootIndex = 0;
+            for (size_t r = 1; r < radix; ++r) {
+                rootIndex += k;
+                if (rootIndex >= radix)
+                    rootIndex -= radix;
+                sum = sum + values[r] * load(roots, rootIndex);
+            }
+            if (k > 0)
+                sum = sum * Complex{w[2 * (k - 1)], w[2 * (k - 1) + 1]};
+            store(dst, dstOffset + stride * k, sum);
+        }
+
+        if (++sequence == stride) {
+            sequence = 0;
+            ++butterfly;
+        }
+    }
+}
+
+std::vector<size_t> factorize(size_t length) {
+    std::vector<size_t> factors;
+    while (length % 4 == 0) {
+        factors.push_back(4);
+        length /= 4;
+    }
+    for (size_t factor = 2; length > 1 && factor * factor <= length; ++factor) {
+        while (length % factor == 0) {
+            factors.push_back(factor);
+            length /= factor;
+        }
+    }
+    if (length > 1)
+        factors.push_back(length);
+    return factors;
+}
+
+inline void conjugate(float* data, size_t length) {
+    for (size_t i = 0; i < length; ++i)
+        data[2 * i + 1] = -data[2 * i + 1];
+}
+
+}  // namespace
+
+FFTPlan::FFTPlan(size_t length) : length(length) {
+    const auto factors = factorize(length);
+    const bool hasBigFactor = std::any_of(factors.begin(), factors.end(), [](size_t factor) {
+        return factor > maxGenericRadix;
+    });
+
+    if (hasBigFactor) {
+        // Bluestein: X[k] = chirp[k] * sum(x[n] * chirp[n] * conj(chirp[k - n])), chirp[n] = exp(-i * pi * n^2 / N),
+        // the sum is the cyclic convolution of the power of two length
+        size_t convolutionLength = 1;
+        while (convolutionLength < 2 * length - 1)
+            convolutionLength *= 2;
+        convolutionPlan = std::make_shared<FFTPlan>(convolutionLength);
+
+        chirp.resize(2 * length);
+        for (size_t n = 0; n < length; ++n) {
+            // n^2 is reduced modulo 2N to keep the angle precise for long sequences
+            const auto phase = static_cast<double>((static_cast<uint64_t>(n) * n) % (2 * length));
+            const double angle = pi * phase / static_cast<double>(length);
+            chirp[2 * n] = static_cast<float>(std::cos(angle));
+            chirp[2 * n + 1] = static_cast<float>(-std::sin(angle));
+        }
+
+        kernelSpectrum.assign(2 * convolutionLength, 0.f);
+        for (size_t n = 0; n < length; ++n) {
+            kernelSpectrum[2 * n] = chirp[2 * n];
+            kernelSpectrum[2 * n + 1] = -chirp[2 * n + 1];
+            if (n > 0) {
+                kernelSpectrum[2 * (convolutionLength - n)] = chirp[2 * n];
+                kernelSpectrum[2 * (convolutionLength - n) + 1] = -chirp[2 * n + 1];
+            }
+        }
+        std::vector<float> scratch(convolutionPlan->getScratchSize());
+        convolutionPlan->execute(kernelSpectrum.data(), scratch.data(), false);
+        return;
+    }
+
+    size_t stageLength = length;
+    size_t stride = 1;
+    for (const auto radix : factors) {
+        Stage stage;
+        stage.radix = radix;
+        stage.count = stageLength / radix;
+        stage.stride = stride;
+        stage.twiddlesOffset = twiddles.size();
+        stage.rootsOffset = roots.size();
+
+        // Twiddles w^(j * k), w = exp(-2 * pi * i / stageLength), for every butterfly j and output k > 0
+        for (size_t j = 0; j < stage.count; ++j) {
+            for (size_t k = 1; k < radix; ++k) {
+                const double angle = 2.0 * pi * static_cast<double>(j * k) / static_cast<double>(stageLength);
+                twiddles.push_back(static_cast<float>(std::cos(angle)));
+                twiddles.push_back(static_cast<float>(-std::sin(angle)));
+            }
+        }
+        if (radix > 5) {
+            for (size_t k = 0; k < radix; ++k) {
+                const double angle = 2.0 * pi * static_cast<double>(k) / static_cast<double>(radix);
+                roots.push_back(static_cast<float>(std::cos(angle)));
+                roots.push_back(static_cast<float>(-std::sin(angle)));
+            }
+        }
+        stages.push_back(stage);
+
+        stageLength /= radix;
+        stride *= radix;
+    }
+}
+
+size_t FFTPlan::getScratchSize() const {
+    if (convolutionPlan) {
+        return 2 * convolutionPlan->getLength() + convolutionPlan->getScratchSize();
+    }
+    return 2 * length;
+}
+
+void FFTPlan::execute(float* data, float* scratch, bool inverse, bool parallelize) const {
+    // Inverse transform is the forward one of the conjugated sequence: IDFT(x) = conj(DFT(conj(x))) / N
+    if (inverse)
+        conjugate(data, length);
+
+    if (convolutionPlan) {
+        bluestein(data, scratch, parallelize);
+    } else {
+        stockham(data, scratch, parallelize);
+    }
+
+    if (inverse) {
+        const float scale = 1.f / static_cast<float>(length);
+        for (size_t i = 0; i < length; ++i) {
+            data[2 * i] *= scale;
+            data[2 * i + 1] *= -scale;
+        }
+    }
+}
+
+void FFTPlan::stockham(float* data, float* scratch, bool parallelize) const {
+    const float* src = data;
+    float* dst = scratch;
+    for (const auto& stage : stages) {
+        const float* stageTwiddles = twiddles.data() + stage.twiddlesOffset;
+        const float* stageRoots = roots.data() + stage.rootsOffset;
+        auto processRange = [&](size_t start, size_t end) {
+            switch (stage.radix) {
+            case 2: stageRange<2>(src, dst, stage.count, stage.stride, stageTwiddles, stageRoots, start, end); break;
+            case 3: stageRange<3>(src, dst, stage.count, stage.stride, stageTwiddles, stageRoots, start, end); break;
+            case 4: stageRange<4>(src, dst, stage.count, stage.stride, stageTwiddles, stageRoots, start, end); break;
+            case 5: stageRange<5>(src, dst, stage.count, stage.stride, stageTwiddles, stageRoots, start, end); break;
+            default:
+                genericStageRange(src, dst, stage.radix, stage.count, stage.stride, stageTwiddles, stageRoots, start, end);
+            }
+        };
+
+        const size_t butterflies = stage.count * stage.stride;
+        if (parallelize && length >= minParallelLength) {
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(butterflies, nthr, ithr, start, end);
+                processRange(start, end);
+            });
+        } else {
+            processRange(0, butterflies);
+        }
+
+        src = dst;
+        dst = dst == scratch ? data : scratch;
+    }
+
+    if (src != data)
+        cpu_memcpy(data, src, 2 * length * sizeof(float));
+}
+
+void FFTPlan::bluestein(float* data, float* scratch, bool parallelize) const {
+    const size_t convolutionLength = convolutionPlan->getLength();
+    float* convolution = scratch;
+    float* convolutionScratch = scratch + 2 * convolutionLength;
+
+    for (size_t n = 0; n < length; ++n)
+        store(convolution, n, load(data, n) * load(chirp.data(), n));
+    std::fill(convolution + 2 * length, convolution + 2 * convolutionLength, 0.f);
+
+    convolutionPlan->stockham(convolution, convolutionScratch, parallelize);
+    // Inverse transform of the product is done by the forward one of the conjugated values
+    for (size_t n = 0; n < convolutionLength; ++n) {
+        const Complex product = load(convolution, n) * load(kernelSpectrum.data(), n);
+        store(convolution, n, {product.re, -product.im});
+    }
+    convolutionPlan->stockham(convolution, convolutionScratch, parallelize);
+
+    const float scale = 1.f / static_cast<float>(convolutionLength);
+    for (size_t k = 0; k < length; ++k) {
+        const Complex value = load(convolution, k);
+        store(data, k, Complex{value.re, -value.im} * load(chirp.data(), k) * scale);
+    }
+}
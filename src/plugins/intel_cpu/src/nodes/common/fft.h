@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Precomputed plan of the complex FFT of the fixed length. Data is a sequence of interleaved (real, imaginary) values.
+ * Lengths which are products of small primes are computed by the mixed radix (4, 2, 3, 5 and generic small prime
+ * radices) Stockham algorithm, so no bit reversal pass is required. Lengths having a big prime factor are computed by
+ * the Bluestein algorithm as a convolution on top of the power of two FFT.
+ * Twiddle factors are computed once in the constructor, so the plan is expected to be cached per length.
+ */
+class FFTPlan {
+public:
+    explicit FFTPlan(size_t length);
+
+    size_t getLength() const {
+        return length;
+    }
+
+    /// Number of floats in the scratch buffer required by execute()
+    size_t getScratchSize() const;
+
+    /// In-place transform of 'length' complex values. Inverse transform is normalized by the length.
+    /// 'parallelize' splits the butterflies of every stage across threads, it's useful for long single sequences only.
+    void execute(float* data, float* scratch, bool inverse, bool parallelize = false) const;
+
+private:
+    struct Stage {
+        size_t radix;
+        size_t count;           // butterflies in the sequence of the stage (stage length / radix)
+        size_t stride;          // distance between the sequences processed by the stage
+        size_t twiddlesOffset;  // (radix - 1) twiddles per butterfly
+        size_t rootsOffset;     // radix roots of unity for the generic radix
+    };
+
+    void stockham(float* data, float* scratch, bool parallelize) const;
+    void bluestein(float* data, float* scratch, bool parallelize) const;
+
+    size_t length;
+    std::vector<Stage> stages;
+    std::vector<float> twiddles;
+    std::vector<float> roots;
+
+    // Bluestein algorithm: length of the convolution, chirp sequence and the spectrum of the convolution kernel
+    std::shared_ptr<FFTPlan> convolutionPlan;
+    std::vector<float> chirp;
+    std::vector<float> kernelSpectrum;
+};
+
+}  // namespace MKLDNNPlugin
@@ -2012,7 +2012,9 @@ bool MKLDNNEltwiseNode::created() const {
 }
 
 bool MKLDNNEltwiseNode::canBeInPlace() const {
-    if (getParentEdgesAtPort(0)[0]->getParent()->getType() == Input) {
+    // Input 0 may come through the views, so the check is done for the node which owns its memory
+    const auto memoryOwner = getInputMemoryOwner();
+    if (!memoryOwner || memoryOwner->getType() == Input || (memoryOwner->isConstant() && !isConstant())) {
         return false;
     }
 
@@ -9,17 +9,23 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
 #include <vector>
+#include <numeric>
+#include <ie_parallel.hpp>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
 #include "utils/general_utils.h"
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
+#include "common/cpu_memcpy.h"
 #include <common/primitive_hashing_utils.hpp>
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
 
 namespace {
 
@@ -71,6 +77,262 @@ bool FCKey::operator==(const FCKey &rhs) const {
     return retVal;
 }
 
+using EltwisePostOps = std::vector<std::shared_ptr<mkldnn::impl::cpu::ref_eltwise_scalar_fwd_t>>;
+
+void applyEltwisePostOps(const EltwisePostOps& postOps, float* dst, size_t size) {
+    for (const auto& postOp : postOps) {
+        for (size_t i = 0; i < size; i++)
+            dst[i] = postOp->compute_scalar(dst[i]);
+    }
+}
+
+// Weights are decompressed by [decompressionKBlock x decompressionNBlock] fp32 tiles (64KB) into a per-thread scratch
+// buffer, so every tile is read from memory in compressed form once and stays in L2 while it's applied to all the input rows.
+constexpr size_t decompressionNBlock = 64;
+constexpr size_t decompressionKBlock = 256;
+
+template <typename WT>
+void executeFullyConnectedWithDecompression(const float* src, const WT* weights, const float* bias, float* dst,
+                                            size_t M, size_t N, size_t K,
+                                            const float* scales, const float* zeroPoints, size_t groupsNum,
+                                            const EltwisePostOps& postOps, float* scratch) {
+    const size_t groupSize = K / groupsNum;
+    parallel_for(div_up(N, decompressionNBlock), [&](size_t nb) {
+        const size_t n0 = nb * decompressionNBlock;
+        const size_t nSize = std::min(decompressionNBlock, N - n0);
+        float* tile = scratch + parallel_get_thread_num() * decompressionNBlock * decompressionKBlock;
+
+        for (size_t m = 0; m < M; m++) {
+            float* y = dst + m * N + n0;
+            for (size_t n = 0; n < nSize; n++)
+                y[n] = bias ? bias[n0 + n] : 0.f;
+        }
+
+        for (size_t k0 = 0; k0 < K; k0 += decompressionKBlock) {
+            const size_t kSize = std::min(decompressionKBlock, K - k0);
+
+            // the tile is stored transposed, so the accumulation loop below is contiguous along N
+            for (size_t n = 0; n < nSize; n++) {
+                const WT* w = weights + (n0 + n) * K + k0;
+                size_t k = 0;
+                while (k < kSize) {
+                    const size_t g = (k0 + k) / groupSize;
+                    const size_t kEnd = std::min(kSize, (g + 1) * groupSize - k0);
+                    const float scale = scales[(n0 + n) * groupsNum + g];
+                    const float zeroPoint = zeroPoints ? zeroPoints[(n0 + n) * groupsNum + g] : 0.f;
+                    for (; k < kEnd; k++)
+                        tile[k * decompressionNBlock + n] = (static_cast<float>(w[k]) - zeroPoint) * scale;
+                }
+            }
+
+            for (size_t m = 0; m < M; m++) {
+                const float* x = src + m * K + k0;
+                float* y = dst + m * N + n0;
+                for (size_t k = 0; k < kSize; k++) {
+                    const float xv = x[k];
+                    const float* t = tile + k * decompressionNBlock;
+                    for (size_t n = 0; n < nSize; n++)
+                        y[n] += xv * t[n];
+                }
+            }
+        }
+
+        for (size_t m = 0; m < M; m++)
+            applyEltwisePostOps(postOps, dst + m * N + n0, nSize);
+    });
+}
+
+// Packed block-sparse weights layout:
+//     uint32 offsets[nBlocks + 1] - index of the first nonzero block of every N block
+//     uint32 kIndices[nnzBlocks]  - K index of every nonzero block
+//     fp32 values[nnzBlocks][sparseNBlock] (64 bytes aligned) - weights of the nonzero blocks, N tail is padded by zeros
+// where every block is [1 x sparseNBlock] weights column, so the accumulation over N is one AVX-512 or two AVX2 registers.
+constexpr size_t sparseNBlock = 16;
+constexpr size_t sparseMBlock = 4;
+
+size_t getSparseValuesOffset(size_t nBlocks, size_t nnzBlocks) {
+    return rnd_up((nBlocks + 1 + nnzBlocks) * sizeof(uint32_t), 64);
+}
+
+// Accumulates the nonzero blocks of one N block for mBlock input rows: acc[m][0:sparseNBlock] += src[m][k] * values[k].
+// The accumulators stay in registers during the whole loop over the nonzero blocks.
+struct jit_fc_sparse_kernel_base : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_fc_sparse_kernel_base)
+
+    typedef struct {
+        const float* src;
+        const uint32_t* kIndices;
+        const float* values;
+        size_t nnzBlocks;
+        size_t srcStride;   // in bytes
+        float* acc;         // [mBlock][sparseNBlock]
+    } args_t;
+
+    typedef void (*fn_t)(const args_t*);
+
+    explicit jit_fc_sparse_kernel_base(size_t mBlock) : mBlock(mBlock) {
+        jit_ker_ = nullptr;
+    }
+
+    fn_t get() {
+        return jit_ker() || create_kernel() == dnnl::impl::status::success
+                ? (fn_t)jit_ker()
+                : nullptr;
+    }
+
+protected:
+    const size_t mBlock;
+
+    const Reg64 reg_src = r8;
+    const Reg64 reg_k_indices = r9;
+    const Reg64 reg_values = r10;
+    const Reg64 reg_nnz = r11;
+    const Reg64 reg_stride = r12;
+    const Reg64 reg_acc = r13;
+    const Reg64 reg_k = r14;
+    const Reg64 reg_x = r15;
+};
+
+template <cpu_isa_t isa>
+struct jit_fc_sparse_kernel : public jit_fc_sparse_kernel_base {
+    using Vmm = typename dnnl::impl::utils::conditional<isa == cpu_isa_t::avx2, Ymm, Zmm>::type;
+    static constexpr size_t vlen = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr size_t nVectors = sparseNBlock / vlen;
+
+    explicit jit_fc_sparse_kernel(size_t mBlock) : jit_fc_sparse_kernel_base(mBlock) {}
+
+    void generate() override final { // NOLINT
+        // accumulators take mBlock * nVectors registers, followed by the weights block and the broadcasted input
+        auto vmm_acc = [&](size_t m, size_t v) { return Vmm(static_cast<int>(m * nVectors + v)); };
+        auto vmm_w = [&](size_t v) { return Vmm(static_cast<int>(mBlock * nVectors + v)); };
+        const Vmm vmm_x = Vmm(static_cast<int>((mBlock + 1) * nVectors));
+
+        preamble();
+
+        mov(reg_src, ptr[param1 + offsetof(args_t, src)]);
+        mov(reg_k_indices, ptr[param1 + offsetof(args_t, kIndices)]);
+        mov(reg_values, ptr[param1 + offsetof(args_t, values)]);
+        mov(reg_nnz, ptr[param1 + offsetof(args_t, nnzBlocks)]);
+        mov(reg_stride, ptr[param1 + offsetof(args_t, srcStride)]);
+        mov(reg_acc, ptr[param1 + offsetof(args_t, acc)]);
+
+        for (size_t m = 0; m < mBlock; m++) {
+            for (size_t v = 0; v < nVectors; v++)
+                uni_vpxor(vmm_acc(m, v), vmm_acc(m, v), vmm_acc(m, v));
+        }
+
+        Label loop, exit;
+        test(reg_nnz, reg_nnz);
+        jz(exit, T_NEAR);
+
+        L(loop);
+        {
+            // 32-bit mov zero extends the K index to the whole register
+            mov(reg_k.cvt32(), dword[reg_k_indices]);
+            lea(reg_x, ptr[reg_src + reg_k * sizeof(float)]);
+            for (size_t v = 0; v < nVectors; v++)
+                uni_vmovups(vmm_w(v), ptr[reg_values + v * vlen * sizeof(float)]);
+            for (size_t m = 0; m < mBlock; m++) {
+                uni_vbroadcastss(vmm_x, ptr[reg_x]);
+                for (size_t v = 0; v < nVectors; v++)
+                    uni_vfmadd231ps(vmm_acc(m, v), vmm_w(v), vmm_x);
+                if (m + 1 < mBlock)
+                    add(reg_x, reg_stride);
+            }
+            add(reg_k_indices, sizeof(uint32_t));
+            add(reg_values, sparseNBlock * sizeof(float));
+            dec(reg_nnz);
+            jnz(loop, T_NEAR);
+        }
+        L(exit);
+
+        for (size_t m = 0; m < mBlock; m++) {
+            for (size_t v = 0; v < nVectors; v++)
+                uni_vmovups(ptr[reg_acc + (m * sparseNBlock + v * vlen) * sizeof(float)], vmm_acc(m, v));
+        }
+
+        postamble();
+    }
+};
+
+jit_fc_sparse_kernel_base::fn_t jit_fc_sparse_kernel_function(size_t mBlock) {
+    if (mayiuse(cpu_isa_t::avx512_common)) {
+        static jit_fc_sparse_kernel<cpu_isa_t::avx512_common> blockGenerator(sparseMBlock);
+        static jit_fc_sparse_kernel<cpu_isa_t::avx512_common> rowGenerator(1);
+        static auto blockFn = blockGenerator.get();
+        static auto rowFn = rowGenerator.get();
+        return mBlock == sparseMBlock ? blockFn : rowFn;
+    } else if (mayiuse(cpu_isa_t::avx2)) {
+        static jit_fc_sparse_kernel<cpu_isa_t::avx2> blockGenerator(sparseMBlock);
+        static jit_fc_sparse_kernel<cpu_isa_t::avx2> rowGenerator(1);
+        static auto blockFn = blockGenerator.get();
+        static auto rowFn = rowGenerator.get();
+        return mBlock == sparseMBlock ? blockFn : rowFn;
+    }
+    return nullptr;
+}
+
+impl_desc_type getSparseImplType() {
+    if (!jit_fc_sparse_kernel_function(sparseMBlock) || !jit_fc_sparse_kernel_function(1))
+        return impl_desc_type::ref_sparse;
+    return mayiuse(cpu_isa_t::avx512_common) ? impl_desc_type::jit_avx512_sparse : impl_desc_type::jit_avx2_sparse;
+}
+
+void executeFullyConnectedWithSparseWeights(const float* src, const uint8_t* packedWeights, const float* bias, float* dst,
+                                            size_t M, size_t N, size_t K, const EltwisePostOps& postOps) {
+    const size_t nBlocks = div_up(N, sparseNBlock);
+    const auto offsets = reinterpret_cast<const uint32_t*>(packedWeights);
+    const auto kIndices = offsets + nBlocks + 1;
+    const auto values = reinterpret_cast<const float*>(packedWeights + getSparseValuesOffset(nBlocks, offsets[nBlocks]));
+
+    const auto blockKernel = jit_fc_sparse_kernel_function(sparseMBlock);
+    const auto rowKernel = jit_fc_sparse_kernel_function(1);
+
+    parallel_for2d(div_up(M, sparseMBlock), nBlocks, [&](size_t mb, size_t nb) {
+        const size_t m0 = mb * sparseMBlock;
+        const size_t mSize = std::min(sparseMBlock, M - m0);
+        const size_t n0 = nb * sparseNBlock;
+        const size_t nSize = std::min(sparseNBlock, N - n0);
+
+        float acc[sparseMBlock][sparseNBlock] = {};
+        if (blockKernel && rowKernel) {
+            jit_fc_sparse_kernel_base::args_t args;
+            args.src = src + m0 * K;
+            args.kIndices = kIndices + offsets[nb];
+            args.values = values + offsets[nb] * sparseNBlock;
+            args.nnzBlocks = offsets[nb + 1] - offsets[nb];
+            args.srcStride = K * sizeof(float);
+            args.acc = acc[0];
+            if (mSize == sparseMBlock) {
+                blockKernel(&args);
+            } else {
+                for (size_t m = 0; m < mSize; m++) {
+                    args.src = src + (m0 + m) * K;
+                    args.acc = acc[m];
+                    rowKernel(&args);
+                }
+            }
+        } else {
+            for (size_t i = offsets[nb]; i < offsets[nb + 1]; i++) {
+                const float* w = values + i * sparseNBlock;
+                const float* x = src + m0 * K + kIndices[i];
+                for (size_t m = 0; m < mSize; m++) {
+                    const float xv = x[m * K];
+                    for (size_t n = 0; n < sparseNBlock; n++)
+                        acc[m][n] += xv * w[n];
+                }
+            }
+        }
+
+        for (size_t m = 0; m < mSize; m++) {
+            float* y = dst + (m0 + m) * N + n0;
+            for (size_t n = 0; n < nSize; n++)
+                y[n] = acc[m][n] + (bias ? bias[n0 + n] : 0.f);
+            applyEltwisePostOps(postOps, y, nSize);
+        }
+    });
+}
+
 } // namespace
 
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -162,6 +424,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // compressed and sparse weights are handled by the plugin kernels, so oneDNN descriptors aren't needed
+    if (withCustomKernel())
+        return;
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -201,7 +467,57 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withCustomKernel()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // bf16 activations are converted to fp32 by reorders, only weights stay compressed or sparse
+    std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, Precision::FP32},
+                                             {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+    if (withBiases)
+        inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+
+    // the decompression kernel is plain C++ code, so it's reported as reference one, not as a GEMM implementation
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}},
+                         withSparseWeights() ? getSparseImplType() : impl_desc_type::ref_any);
+}
+
+void MKLDNNFullyConnectedNode::setWeightsDecompression(const std::vector<float>& scales, const std::vector<float>& zeroPoints, size_t groupsNum) {
+    decompressionMultiply = scales;
+    decompressionSubtract = zeroPoints;
+    decompressionGroupsNum = groupsNum;
+}
+
+void MKLDNNFullyConnectedNode::initEltwisePostOps() {
+    eltwisePostOps.clear();
+    for (const auto& node : fusedWith) {
+        const auto eltwiseNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(node);
+        if (!eltwiseNode || eltwiseNode->getMKLDNNAlgorithm() == mkldnn::algorithm::undef)
+            IE_THROW() << errorPrefix << " doesn't support fused " << NameFromType(node->getType()) << " with custom kernel";
+        eltwisePostOps.push_back(std::make_shared<mkldnn::impl::cpu::ref_eltwise_scalar_fwd_t>(
+            static_cast<mkldnn_alg_kind_t>(eltwiseNode->getMKLDNNAlgorithm()), eltwiseNode->getAlpha(), eltwiseNode->getBeta(), 1.f));
+    }
+}
+
 void MKLDNNFullyConnectedNode::prepareParams() {
+    if (withWeightsDecompression()) {
+        decompressionScratch.resize(static_cast<size_t>(parallel_get_max_threads()) * decompressionNBlock * decompressionKBlock);
+        initEltwisePostOps();
+        return;
+    }
+
+    if (withSparseWeights()) {
+        if (!sparseWeightsMemory)
+            packSparseWeights();
+        initEltwisePostOps();
+        return;
+    }
+
     auto srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
     auto wghMemPtr = getParentEdgesAtPort(1)[0]->getMemoryPtr();
     auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
@@ -326,7 +642,132 @@ void MKLDNNFullyConnectedNode::prepareParams() {
     reshapeMemory(DNNL_ARG_DST);
 }
 
+void MKLDNNFullyConnectedNode::executeWithWeightsDecompression() {
+    const auto& srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto& wghMemPtr = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const size_t K = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t N = wghMemPtr->getStaticDims()[0];
+
+    const auto src = reinterpret_cast<const float*>(srcMemPtr->GetPtr());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    const auto dst = reinterpret_cast<float*>(dstMemPtr->GetPtr());
+    const auto zeroPoints = decompressionSubtract.empty() ? nullptr : decompressionSubtract.data();
+
+    switch (wghMemPtr->getDesc().getPrecision()) {
+        case Precision::U8:
+            executeFullyConnectedWithDecompression(src, reinterpret_cast<const uint8_t*>(wghMemPtr->GetPtr()), bias, dst, M, N, K,
+                                                   decompressionMultiply.data(), zeroPoints, decompressionGroupsNum,
+                                                   eltwisePostOps, decompressionScratch.data());
+            break;
+        case Precision::I8:
+            executeFullyConnectedWithDecompression(src, reinterpret_cast<const int8_t*>(wghMemPtr->GetPtr()), bias, dst, M, N, K,
+                                                   decompressionMultiply.data(), zeroPoints, decompressionGroupsNum,
+                                                   eltwisePostOps, decompressionScratch.data());
+            break;
+        default:
+            IE_THROW() << errorPrefix << " doesn't support compressed weights precision: " << wghMemPtr->getDesc().getPrecision();
+    }
+}
+
+float MKLDNNFullyConnectedNode::getZeroWeightsBlocksRate(const float* weights, size_t N, size_t K) {
+    const size_t nBlocks = div_up(N, sparseNBlock);
+    if (nBlocks * K == 0)
+        return 0.f;
+
+    size_t zeroBlocks = 0;
+    for (size_t nb = 0; nb < nBlocks; nb++) {
+        const size_t n0 = nb * sparseNBlock;
+        const size_t nSize = std::min(sparseNBlock, N - n0);
+        for (size_t k = 0; k < K; k++) {
+            bool isZeroBlock = true;
+            for (size_t n = 0; n < nSize && isZeroBlock; n++)
+                isZeroBlock = weights[(n0 + n) * K + k] == 0.f;
+            zeroBlocks += isZeroBlock;
+        }
+    }
+    return static_cast<float>(zeroBlocks) / static_cast<float>(nBlocks * K);
+}
+
+void MKLDNNFullyConnectedNode::packSparseWeights() {
+    const auto& wghMemPtr = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    const auto& wghDims = wghMemPtr->getStaticDims();
+    const size_t N = wghDims[0];
+    const size_t K = wghDims[1];
+    const auto weights = reinterpret_cast<const float*>(wghMemPtr->GetPtr());
+
+    auto create = [&] () {
+        const size_t nBlocks = div_up(N, sparseNBlock);
+        std::vector<uint32_t> offsets(nBlocks + 1, 0);
+        std::vector<uint32_t> kIndices;
+        std::vector<float> values;
+        for (size_t nb = 0; nb < nBlocks; nb++) {
+            const size_t n0 = nb * sparseNBlock;
+            const size_t nSize = std::min(sparseNBlock, N - n0);
+            for (size_t k = 0; k < K; k++) {
+                bool isZeroBlock = true;
+                for (size_t n = 0; n < nSize && isZeroBlock; n++)
+                    isZeroBlock = weights[(n0 + n) * K + k] == 0.f;
+                if (isZeroBlock)
+                    continue;
+
+                kIndices.push_back(static_cast<uint32_t>(k));
+                for (size_t n = 0; n < sparseNBlock; n++)
+                    values.push_back(n < nSize ? weights[(n0 + n) * K + k] : 0.f);
+            }
+            offsets[nb + 1] = static_cast<uint32_t>(kIndices.size());
+        }
+
+        const size_t valuesOffset = getSparseValuesOffset(nBlocks, kIndices.size());
+        MKLDNNMemoryPtr memory = std::make_shared<MKLDNNMemory>(getEngine());
+        memory->Create(CpuBlockedMemoryDesc(Precision::U8, Shape(VectorDims{valuesOffset + values.size() * sizeof(float)})));
+
+        auto packed = reinterpret_cast<uint8_t*>(memory->GetPtr());
+        cpu_memcpy(packed, offsets.data(), offsets.size() * sizeof(uint32_t));
+        cpu_memcpy(packed + offsets.size() * sizeof(uint32_t), kIndices.data(), kIndices.size() * sizeof(uint32_t));
+        cpu_memcpy(packed + valuesOffset, values.data(), values.size() * sizeof(float));
+        return memory;
+    };
+
+    if (weightCache != nullptr) {
+        const uint64_t dataHash = weightCache->GetHashFunc().hash(reinterpret_cast<const unsigned char*>(weights),
+                                                                  N * K * sizeof(float));
+        const std::string key = getName() + "_sparse_" + std::to_string(N) + "_" + std::to_string(K) + "_" + std::to_string(dataHash);
+        sparseWeightsMemory = *weightCache->findOrCreate(key, create);
+    } else {
+        sparseWeightsMemory = create();
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeWithSparseWeights() {
+    const auto& srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const size_t K = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t N = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr()->getStaticDims()[0];
+
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    executeFullyConnectedWithSparseWeights(reinterpret_cast<const float*>(srcMemPtr->GetPtr()),
+                                           reinterpret_cast<const uint8_t*>(sparseWeightsMemory->GetPtr()),
+                                           bias, reinterpret_cast<float*>(dstMemPtr->GetPtr()), M, N, K, eltwisePostOps);
+}
+
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (withWeightsDecompression()) {
+        executeWithWeightsDecompression();
+        return;
+    }
+
+    if (withSparseWeights()) {
+        executeWithSparseWeights();
+        return;
+    }
+
     if (prim) {
         // in cases parameter -> FullyConnected or dynamic shapes
         // we keep old pointer to data in primArgs on second iteration with same input shapes
@@ -354,6 +795,12 @@ void MKLDNNFullyConnectedNode::executeDynamicImpl(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    // the weights decompression and sparse kernels apply activations only, scale/shift and FakeQuantize
+    // post operations are executed by the separate nodes
+    if (withCustomKernel()) {
+        const auto eltwiseNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(node);
+        return eltwiseNode && eltwiseNode->getMKLDNNAlgorithm() != mkldnn::algorithm::undef && canFuseSimpleOperation(node);
+    }
     return canFuseSimpleOperation(node);
 }
 
@@ -499,6 +946,9 @@ void MKLDNNFullyConnectedNode::createDescriptorInternal(const mkldnn::memory::de
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (withCustomKernel())
+        return;
+
     MemoryDescPtr inpDesc;
     if (inputDesc[0]->isDefined()) {
         inpDesc = inputDesc[0];
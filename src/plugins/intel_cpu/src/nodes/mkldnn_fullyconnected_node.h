@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <cpu/ref_eltwise.hpp>
 #include <memory>
 #include <string>
 #include <vector>
@@ -18,6 +19,7 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -51,7 +53,40 @@ public:
     void prepareParams() override;
     void executeDynamicImpl(mkldnn::stream strm) override;
 
+    /**
+     * @brief Enables on the fly decompression of u8/i8 weights: W[n][k] = (Wc[n][k] - zeroPoints[n][g]) * scales[n][g],
+     *        where g = k / (K / groupsNum). Empty zeroPoints means no zero point subtraction.
+     */
+    void setWeightsDecompression(const std::vector<float>& scales, const std::vector<float>& zeroPoints, size_t groupsNum);
+    bool withWeightsDecompression() const {
+        return !decompressionMultiply.empty();
+    }
+
+    /**
+     * @brief Enables block-sparse kernel: constant fp32 weights are packed skipping zero [1 x 16] weights blocks
+     *        and the packed weights are shared between streams via weights cache.
+     */
+    void setSparseWeights(bool sparse) {
+        useSparseWeights = sparse;
+    }
+    bool withSparseWeights() const {
+        return useSparseWeights;
+    }
+    /**
+     * @brief Returns the rate of zero weights blocks of [N, K] fp32 weights, which are skipped by the sparse kernel
+     */
+    static float getZeroWeightsBlocksRate(const float* weights, size_t N, size_t K);
+
 private:
+    bool withCustomKernel() const {
+        return withWeightsDecompression() || withSparseWeights();
+    }
+
+    void initEltwisePostOps();
+    void executeWithWeightsDecompression();
+    void packSparseWeights();
+    void executeWithSparseWeights();
+
     void createDescriptorInternal(const mkldnn::memory::desc &inputDesc,
                                   const mkldnn::memory::desc &outputDesc);
 
@@ -65,6 +100,17 @@ private:
 
     bool withBiases = false;
 
+    std::vector<float> decompressionMultiply;
+    std::vector<float> decompressionSubtract;
+    size_t decompressionGroupsNum = 1;
+    std::vector<float> decompressionScratch;
+
+    bool useSparseWeights = false;
+    MKLDNNMemoryPtr sparseWeightsMemory;
+
+    // fused activations of the weights decompression and sparse kernels, they are applied to the output tile in cache
+    std::vector<std::shared_ptr<mkldnn::impl::cpu::ref_eltwise_scalar_fwd_t>> eltwisePostOps;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
@@ -0,0 +1,287 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_fused_preprocessing_node.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNFusedPreprocessingNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op,
+                                                        std::string& errorMessage) noexcept {
+    try {
+        if (!ov::is_type<const FusedPreprocessingNode>(op)) {
+            errorMessage = "Only FusedPreprocessing operation from cpu_plugin_opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNFusedPreprocessingNode::MKLDNNFusedPreprocessingNode(const std::shared_ptr<ngraph::Node>& op,
+                                                           const mkldnn::engine& eng,
+                                                           MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "FusedPreprocessing layer with name '" + op->get_friendly_name() + "'";
+    if (!one_of(getOriginalInputsNumber(), 1u, 2u, 3u) || getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    attrs = ov::as_type_ptr<const FusedPreprocessingNode>(op)->get_attrs();
+}
+
+void MKLDNNFusedPreprocessingNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    precision = getOriginalInputPrecisionAtPort(0);
+    if (!one_of(precision, Precision::U8, Precision::FP32))
+        precision = Precision::FP32;
+
+    std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, precision});
+    addSupportedPrimDesc(inConfs,
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         impl_desc_type::ref_any);
+}
+
+MKLDNNFusedPreprocessingNode::Taps MKLDNNFusedPreprocessingNode::getTaps(size_t srcSize, size_t dstSize) const {
+    Taps taps;
+    taps.first.resize(dstSize);
+    taps.second.resize(dstSize);
+    taps.weight.resize(dstSize, 0.f);
+    if (attrs.resizeMode == ResizeMode::NONE) {
+        for (size_t i = 0; i < dstSize; i++)
+            taps.first[i] = taps.second[i] = i;
+        return taps;
+    }
+
+    // half_pixel coordinate transformation of Interpolate with the scale computed from the sizes
+    const float scale = static_cast<float>(dstSize) / static_cast<float>(srcSize);
+    const float maxCoord = static_cast<float>(srcSize - 1);
+    for (size_t i = 0; i < dstSize; i++) {
+        const float coord = (static_cast<float>(i) + 0.5f) / scale - 0.5f;
+        if (attrs.resizeMode == ResizeMode::NEAREST) {
+            // round_prefer_floor
+            const float rounded = coord == std::floor(coord) + 0.5f ? std::floor(coord) : std::round(coord);
+            taps.first[i] = taps.second[i] = static_cast<size_t>(std::min(std::max(rounded, 0.f), maxCoord));
+        } else {
+            const float clamped = std::min(std::max(coord, 0.f), maxCoord);
+            taps.first[i] = static_cast<size_t>(clamped);
+            taps.second[i] = std::min(taps.first[i] + 1, srcSize - 1);
+            taps.weight[i] = clamped - static_cast<float>(taps.first[i]);
+        }
+    }
+    return taps;
+}
+
+void MKLDNNFusedPreprocessingNode::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const bool singlePlane = getParentEdges().size() == 1;
+    batch = srcDims[0];
+    if (attrs.colorFormat != ColorFormat::NONE) {
+        srcHeight = singlePlane ? srcDims[1] * 2 / 3 : srcDims[1];
+        srcWidth = srcDims[2];
+        channels = 3;
+    } else if (attrs.inputChannelsLast) {
+        srcHeight = srcDims[1];
+        srcWidth = srcDims[2];
+        channels = srcDims[3];
+    } else {
+        channels = srcDims[1];
+        srcHeight = srcDims[2];
+        srcWidth = srcDims[3];
+    }
+    if (srcHeight == 0 || srcWidth == 0)
+        IE_THROW() << errorPrefix << " has empty input image";
+
+    dstHeight = attrs.resizeMode == ResizeMode::NONE ? srcHeight : static_cast<size_t>(attrs.outputHeight);
+    dstWidth = attrs.resizeMode == ResizeMode::NONE ? srcWidth : static_cast<size_t>(attrs.outputWidth);
+
+    if (!one_of(attrs.scale.size(), size_t(1), channels) || !one_of(attrs.shift.size(), size_t(1), channels))
+        IE_THROW() << errorPrefix << " has scale or shift which doesn't match the number of channels";
+    scale = attrs.scale.size() == 1 ? std::vector<float>(channels, attrs.scale.front()) : attrs.scale;
+    shift = attrs.shift.size() == 1 ? std::vector<float>(channels, attrs.shift.front()) : attrs.shift;
+
+    rowTaps = getTaps(srcHeight, dstHeight);
+    colTaps = getTaps(srcWidth, dstWidth);
+
+    // two cached source rows and the row interpolated along the height
+    scratchPerThread = 3 * channels * srcWidth;
+    scratch.resize(scratchPerThread * parallel_get_max_threads());
+}
+
+template <typename T>
+void MKLDNNFusedPreprocessingNode::loadColorRow(const std::vector<const T*>& planes, size_t n, size_t y,
+                                                float* row) const {
+    const size_t imageSize = srcHeight * srcWidth;
+    const bool singlePlane = planes.size() == 1;
+    const T* yRow = nullptr;
+    const T* uRow = nullptr;
+    const T* vRow = nullptr;
+    size_t uvStep = 1;
+    if (one_of(attrs.colorFormat, ColorFormat::NV12_TO_RGB, ColorFormat::NV12_TO_BGR)) {
+        // interleaved UV plane of [H / 2, W / 2, 2]
+        if (singlePlane) {
+            const T* image = planes[0] + n * imageSize * 3 / 2;
+            yRow = image + y * srcWidth;
+            uRow = image + imageSize + (y / 2) * srcWidth;
+        } else {
+            yRow = planes[0] + n * imageSize + y * srcWidth;
+            uRow = planes[1] + n * imageSize / 2 + (y / 2) * srcWidth;
+        }
+        vRow = uRow + 1;
+        uvStep = 2;
+    } else {
+        // separate U and V planes of [H / 2, W / 2]
+        if (singlePlane) {
+            const T* image = planes[0] + n * imageSize * 3 / 2;
+            yRow = image + y * srcWidth;
+            uRow = image + imageSize + (y / 2) * (srcWidth / 2);
+            vRow = uRow + imageSize / 4;
+        } else {
+            yRow = planes[0] + n * imageSize + y * srcWidth;
+            uRow = planes[1] + n * imageSize / 4 + (y / 2) * (srcWidth / 2);
+            vRow = planes[2] + n * imageSize / 4 + (y / 2) * (srcWidth / 2);
+        }
+    }
+
+    const bool bgr = one_of(attrs.colorFormat, ColorFormat::NV12_TO_BGR, ColorFormat::I420_TO_BGR);
+    float* r = row + (bgr ? 2 : 0) * srcWidth;
+    float* g = row + srcWidth;
+    float* b = row + (bgr ? 0 : 2) * srcWidth;
+    const auto clip = [](float value) {
+        return std::min(std::max(value, 0.f), 255.f);
+    };
+    for (size_t x = 0; x < srcWidth; x++) {
+        const size_t uvIdx = (x / 2) * uvStep;
+        const float c = static_cast<float>(yRow[x]) - 16.f;
+        const float d = static_cast<float>(uRow[uvIdx]) - 128.f;
+        const float e = static_cast<float>(vRow[uvIdx]) - 128.f;
+        r[x] = clip(1.164f * c + 1.596f * e);
+        g[x] = clip(1.164f * c - 0.391f * d - 0.813f * e);
+        b[x] = clip(1.164f * c + 2.018f * d);
+    }
+    if (attrs.roundColor) {
+        for (size_t i = 0; i < 3 * srcWidth; i++)
+            row[i] = std::round(row[i]);
+    }
+}
+
+template <typename T>
+void MKLDNNFusedPreprocessingNode::loadRow(const std::vector<const T*>& planes, size_t n, size_t y, float* row) const {
+    if (attrs.colorFormat != ColorFormat::NONE) {
+        loadColorRow(planes, n, y, row);
+    } else if (attrs.inputChannelsLast) {
+        const T* src = planes[0] + (n * srcHeight + y) * srcWidth * channels;
+        for (size_t x = 0; x < srcWidth; x++) {
+            for (size_t c = 0; c < channels; c++)
+                row[c * srcWidth + x] = static_cast<float>(src[x * channels + c]);
+        }
+    } else {
+        for (size_t c = 0; c < channels; c++) {
+            const T* src = planes[0] + ((n * channels + c) * srcHeight + y) * srcWidth;
+            for (size_t x = 0; x < srcWidth; x++)
+                row[c * srcWidth + x] = static_cast<float>(src[x]);
+        }
+    }
+}
+
+void MKLDNNFusedPreprocessingNode::storeRow(const float* row, size_t n, size_t y, float* dst) const {
+    const bool linear = attrs.resizeMode == ResizeMode::LINEAR;
+    const size_t* first = colTaps.first.data();
+    const size_t* second = colTaps.second.data();
+    const float* weight = colTaps.weight.data();
+    for (size_t c = 0; c < channels; c++) {
+        const float* src = row + c * srcWidth;
+        const float s = scale[c];
+        const float t = shift[c];
+        const size_t stride = attrs.outputChannelsLast ? channels : 1;
+        float* out = attrs.outputChannelsLast ? dst + (n * dstHeight + y) * dstWidth * channels + c
+                                              : dst + ((n * channels + c) * dstHeight + y) * dstWidth;
+        if (linear) {
+            for (size_t x = 0; x < dstWidth; x++) {
+                const float value = src[first[x]] * (1.f - weight[x]) + src[second[x]] * weight[x];
+                out[x * stride] = value * s + t;
+            }
+        } else {
+            for (size_t x = 0; x < dstWidth; x++)
+                out[x * stride] = src[first[x]] * s + t;
+        }
+    }
+}
+
+template <typename T>
+void MKLDNNFusedPreprocessingNode::executeImpl() {
+    std::vector<const T*> planes;
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        planes.push_back(reinterpret_cast<const T*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr()));
+    float* dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const size_t rowSize = channels * srcWidth;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(batch * dstHeight, nthr, ithr, start, end);
+
+        float* buffer = scratch.data() + ithr * scratchPerThread;
+        float* slots[2] = {buffer, buffer + rowSize};
+        float* blended = buffer + 2 * rowSize;
+        // the source rows held by the slots, the output rows are processed in order, so the older row is evicted
+        int64_t tags[2] = {-1, -1};
+        auto getRow = [&](size_t n, size_t y, int keep) {
+            const int64_t tag = static_cast<int64_t>(n * srcHeight + y);
+            for (int slot = 0; slot < 2; slot++) {
+                if (tags[slot] == tag)
+                    return slot;
+            }
+            int slot = tags[0] <= tags[1] ? 0 : 1;
+            if (slot == keep)
+                slot = 1 - slot;
+            loadRow(planes, n, y, slots[slot]);
+            tags[slot] = tag;
+            return slot;
+        };
+
+        for (size_t i = start; i < end; i++) {
+            const size_t n = i / dstHeight;
+            const size_t y = i % dstHeight;
+            const float w = rowTaps.weight[y];
+            const int first = getRow(n, rowTaps.first[y], -1);
+            const float* row = slots[first];
+            if (w != 0.f && rowTaps.second[y] != rowTaps.first[y]) {
+                const float* row0 = slots[first];
+                const float* row1 = slots[getRow(n, rowTaps.second[y], first)];
+                for (size_t j = 0; j < rowSize; j++)
+                    blended[j] = row0[j] * (1.f - w) + row1[j] * w;
+                row = blended;
+            }
+            storeRow(row, n, y, dst);
+        }
+    });
+}
+
+void MKLDNNFusedPreprocessingNode::execute(mkldnn::stream strm) {
+    if (precision == Precision::U8)
+        executeImpl<uint8_t>();
+    else
+        executeImpl<float>();
+}
+
+bool MKLDNNFusedPreprocessingNode::created() const {
+    return getType() == FusedPreprocessing;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNFusedPreprocessingNode, FusedPreprocessing)
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include "ngraph_transformations/op/fused_preprocessing.hpp"
+
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Computes the preprocessed image row by row: the source rows required for an output row are converted to planar
+ * fp32 rows (including the color conversion), interpolated and written with the per-channel scale and shift applied.
+ * The threads process contiguous ranges of the output rows and keep the last two source rows, so every source row
+ * is read and converted about once even when the image is upscaled.
+ */
+class MKLDNNFusedPreprocessingNode : public MKLDNNNode {
+public:
+    MKLDNNFusedPreprocessingNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                 MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override {
+        execute(strm);
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    using ColorFormat = FusedPreprocessingNode::ColorFormat;
+    using ResizeMode = FusedPreprocessingNode::ResizeMode;
+
+    // source coordinates and the weight of the second one for every output coordinate
+    struct Taps {
+        std::vector<size_t> first;
+        std::vector<size_t> second;
+        std::vector<float> weight;
+    };
+
+    Taps getTaps(size_t srcSize, size_t dstSize) const;
+    template <typename T>
+    void executeImpl();
+    template <typename T>
+    void loadRow(const std::vector<const T*>& planes, size_t n, size_t y, float* row) const;
+    template <typename T>
+    void loadColorRow(const std::vector<const T*>& planes, size_t n, size_t y, float* row) const;
+    void storeRow(const float* row, size_t n, size_t y, float* dst) const;
+
+    FusedPreprocessingNode::Attributes attrs;
+    InferenceEngine::Precision precision = InferenceEngine::Precision::U8;
+
+    size_t batch = 0;
+    size_t channels = 0;
+    size_t srcHeight = 0;
+    size_t srcWidth = 0;
+    size_t dstHeight = 0;
+    size_t dstWidth = 0;
+    std::vector<float> scale;
+    std::vector<float> shift;
+    Taps rowTaps;
+    Taps colTaps;
+
+    size_t scratchPerThread = 0;
+    std::vector<float> scratch;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
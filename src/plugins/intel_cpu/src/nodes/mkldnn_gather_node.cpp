@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -63,6 +64,12 @@ MKLDNNGatherNode::MKLDNNGatherNode(const std::shared_ptr<ov::Node>& op, const mk
         if (axis < 0 || axis >= dataSrcRank || batchDims > axis)
             IE_THROW() << errorPrefix << "has incorrect input parameter axis value: " << axis;
     }
+    if (const auto indices = ov::as_type<ov::op::v0::Constant>(op->get_input_node_ptr(GATHER_INDEXES))) {
+        if (ov::shape_size(indices->get_shape()) == 1) {
+            isIndexConst = true;
+            constIndex = indices->cast_vector<int64_t>()[0];
+        }
+    }
     dataSize = getOriginalInputPrecisionAtPort(GATHER_DATA).size();
 }
 
@@ -71,6 +78,28 @@ void MKLDNNGatherNode::initSupportedPrimitiveDescriptors() {
         return;
 
     Precision dataPrecision = getOriginalInputPrecisionAtPort(GATHER_DATA);
+
+    // Optimized inplace case
+    if (isAxisInputConst && isIndexConst && canOutputBeView()) {
+        const auto& srcDims = getInputShapeAtPort(GATHER_DATA).getStaticDims();
+        const bool isBlock = std::all_of(srcDims.begin(), srcDims.begin() + axis, [](Dim dim) { return dim == 1; });
+        if (isBlock && constIndex >= 0 && static_cast<size_t>(constIndex) < srcDims[axis]) {
+            viewOffset = constIndex * std::accumulate(srcDims.begin() + axis + 1, srcDims.end(), size_t{1}, std::multiplies<size_t>());
+
+            const auto& creators = BlockedDescCreator::getCommonCreators();
+            NodeConfig config;
+            config.inConfs.resize(3);
+            config.inConfs[GATHER_DATA].desc = makeViewDesc(dataPrecision, getInputShapeAtPort(GATHER_DATA));
+            config.inConfs[GATHER_INDEXES].desc = creators.at(LayoutType::ncsp)->createSharedDesc(Precision::I32, getInputShapeAtPort(GATHER_INDEXES));
+            config.inConfs[GATHER_AXIS].desc = creators.at(LayoutType::ncsp)->createSharedDesc(Precision::I32, getInputShapeAtPort(GATHER_AXIS));
+            config.inConfs[GATHER_AXIS].constant = true;
+            config.outConfs.resize(1);
+            config.outConfs[0].inPlace = GATHER_DATA;
+            config.outConfs[0].desc = makeViewDesc(dataPrecision, getOutputShapeAtPort(0));
+            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+        }
+    }
+
     addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
                           {LayoutType::ncsp, Precision::I32},
                           {LayoutType::ncsp, Precision::I32, isAxisInputConst}},
@@ -78,6 +107,22 @@ void MKLDNNGatherNode::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
+void MKLDNNGatherNode::selectOptimalPrimitiveDescriptor() {
+    selectOptimalViewDescriptor();
+}
+
+void MKLDNNGatherNode::initOptimalPrimitiveDescriptor() {
+    if (isOutputView()) {
+        initOptimalViewDescriptor(viewOffset);
+    } else {
+        MKLDNNNode::initOptimalPrimitiveDescriptor();
+    }
+}
+
+bool MKLDNNGatherNode::isExecutable() const {
+    return MKLDNNNode::isExecutable() && !isOutputView();
+}
+
 void MKLDNNGatherNode::prepareParams() {
     auto& srcMemPtr = getParentEdgeAt(GATHER_DATA)->getMemoryPtr();
     if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
@@ -117,6 +162,9 @@ bool MKLDNNGatherNode::needPrepareParams() const {
 }
 
 void MKLDNNGatherNode::execute(mkldnn::stream strm) {
+    if (isOutputView())
+        return;
+
     const int32_t* srcIndexes = reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_INDEXES)->getMemoryPtr()->GetPtr());
     const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
     uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
@@ -18,8 +18,11 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
+    void initOptimalPrimitiveDescriptor() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool isExecutable() const override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
@@ -44,6 +47,12 @@ private:
     int dataSrcRank = 1;
     bool isAxisInputConst = false;
 
+    // Scalar constant index selects a contiguous block of data when all the dims before the axis are 1,
+    // so the output is a view on the input starting at viewOffset elements
+    bool isIndexConst = false;
+    int64_t constIndex = 0;
+    size_t viewOffset = 0;
+
     static constexpr size_t GATHER_DATA = 0;
     static constexpr size_t GATHER_INDEXES = 1;
     static constexpr size_t GATHER_AXIS = 2;
@@ -0,0 +1,278 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_scaled_dot_product_attention_node.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "ie_parallel.hpp"
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
+#include "common/cpu_convert.h"
+#include "utils/general_utils.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+namespace {
+
+// [queryBlock x keyBlock] fp32 scores tile (32KB) together with the transposed keys tile and the accumulated output
+// rows stay in L2 while the tile is processed
+constexpr size_t queryBlock = 32;
+constexpr size_t maxKeyBlock = 256;
+
+// offsets of the input matrices for every batch index of the output, broadcasted dimensions have zero stride
+std::vector<size_t> getBatchOffsets(const VectorDims& dims, const VectorDims& outBatchDims, size_t matrixSize) {
+    const size_t rank = outBatchDims.size();
+    VectorDims batchDims(rank, 1);
+    const size_t inBatchRank = dims.size() > 2 ? dims.size() - 2 : 0;
+    std::copy(dims.begin(), dims.begin() + inBatchRank, batchDims.end() - inBatchRank);
+
+    VectorDims strides(rank, 0);
+    size_t stride = matrixSize;
+    for (size_t i = rank; i-- > 0;) {
+        strides[i] = batchDims[i] == 1 ? 0 : stride;
+        stride *= batchDims[i];
+    }
+
+    const size_t batch = std::accumulate(outBatchDims.begin(), outBatchDims.end(), size_t(1), std::multiplies<size_t>());
+    std::vector<size_t> offsets(batch, 0);
+    for (size_t b = 0; b < batch; b++) {
+        size_t rem = b;
+        for (size_t i = rank; i-- > 0;) {
+            offsets[b] += (rem % outBatchDims[i]) * strides[i];
+            rem /= outBatchDims[i];
+        }
+    }
+    return offsets;
+}
+
+}  // namespace
+
+bool MKLDNNScaledDotProductAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op,
+                                                               std::string& errorMessage) noexcept {
+    try {
+        if (!ov::is_type<const ScaledDotProductAttentionNode>(op)) {
+            errorMessage = "Only ScaledDotProductAttention operation from cpu_plugin_opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNScaledDotProductAttentionNode::MKLDNNScaledDotProductAttentionNode(const std::shared_ptr<ngraph::Node>& op,
+                                                                         const mkldnn::engine& eng,
+                                                                         MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ScaledDotProductAttention layer with name '" + op->get_friendly_name() + "'";
+    const auto attention = ov::as_type_ptr<const ScaledDotProductAttentionNode>(op);
+    if (!one_of(getOriginalInputsNumber(), 3u, 4u) || getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    scale = attention->get_scale();
+    transposeKey = attention->get_transpose_key();
+    withMask = getOriginalInputsNumber() == 4;
+}
+
+void MKLDNNScaledDotProductAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    precision = getOriginalInputPrecisionAtPort(0);
+    if (!one_of(precision, Precision::FP32, Precision::BF16) || (precision == Precision::BF16 && !mayiuse(avx512_core)))
+        precision = Precision::FP32;
+
+    std::vector<PortConfigurator> inConfs(3, {LayoutType::ncsp, precision});
+    if (withMask)
+        inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+    addSupportedPrimDesc(inConfs,
+                         {{LayoutType::ncsp, precision}},
+                         impl_desc_type::ref_any);
+}
+
+void MKLDNNScaledDotProductAttentionNode::prepareParams() {
+    const auto& queryDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const auto& keyDims = getParentEdgeAt(1)->getMemory().getStaticDims();
+    const auto& valueDims = getParentEdgeAt(2)->getMemory().getStaticDims();
+    const auto& dstDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    const size_t rank = queryDims.size();
+
+    queryLength = queryDims[rank - 2];
+    headSize = queryDims[rank - 1];
+    keyLength = transposeKey ? keyDims[rank - 2] : keyDims[rank - 1];
+    valueHeadSize = valueDims[rank - 1];
+    const size_t keyHeadSize = transposeKey ? keyDims[rank - 1] : keyDims[rank - 2];
+    if (keyHeadSize != headSize || valueDims[rank - 2] != keyLength)
+        IE_THROW() << errorPrefix << " has incompatible shapes of query, key and value";
+
+    const VectorDims outBatchDims(dstDims.begin(), dstDims.end() - 2);
+    queryOffsets = getBatchOffsets(queryDims, outBatchDims, queryLength * headSize);
+    keyOffsets = getBatchOffsets(keyDims, outBatchDims, keyLength * headSize);
+    valueOffsets = getBatchOffsets(valueDims, outBatchDims, keyLength * valueHeadSize);
+
+    if (withMask) {
+        auto maskDims = getParentEdgeAt(3)->getMemory().getStaticDims();
+        while (maskDims.size() < 2)
+            maskDims.insert(maskDims.begin(), 1);
+        const size_t maskRows = maskDims[maskDims.size() - 2];
+        const size_t maskCols = maskDims[maskDims.size() - 1];
+        if (!one_of(maskRows, size_t(1), queryLength) || !one_of(maskCols, size_t(1), keyLength))
+            IE_THROW() << errorPrefix << " has mask which can't be broadcasted to the attention scores";
+        maskRowStride = maskRows == 1 ? 0 : maskCols;
+        maskColStride = maskCols == 1 ? 0 : 1;
+        maskOffsets = getBatchOffsets(maskDims, outBatchDims, maskRows * maskCols);
+    }
+
+    keyBlock = std::max<size_t>(1, std::min(maxKeyBlock, keyLength));
+    scratchPerThread = headSize * keyBlock + queryBlock * keyBlock + queryBlock * valueHeadSize + 2 * queryBlock;
+    scratch.resize(scratchPerThread * parallel_get_max_threads());
+}
+
+const float* MKLDNNScaledDotProductAttentionNode::getInputData(size_t port, std::vector<float>& buffer) const {
+    const auto& memory = getParentEdgeAt(port)->getMemory();
+    if (memory.getDesc().getPrecision() == Precision::FP32)
+        return reinterpret_cast<const float*>(memory.GetPtr());
+
+    buffer.resize(memory.GetShape().getElementsCount());
+    cpu_convert(memory.GetPtr(), buffer.data(), memory.getDesc().getPrecision(), Precision::FP32, buffer.size());
+    return buffer.data();
+}
+
+void MKLDNNScaledDotProductAttentionNode::executeBlock(size_t b, size_t q0, const float* query, const float* key,
+                                                       const float* value, const float* mask, float* dst,
+                                                       float* buffer) const {
+    const size_t rows = std::min(queryBlock, queryLength - q0);
+    float* keyTile = buffer;
+    float* scores = keyTile + headSize * keyBlock;
+    float* acc = scores + queryBlock * keyBlock;
+    float* maxes = acc + queryBlock * valueHeadSize;
+    float* sums = maxes + queryBlock;
+
+    std::fill(acc, acc + rows * valueHeadSize, 0.f);
+    std::fill(maxes, maxes + rows, -std::numeric_limits<float>::infinity());
+    std::fill(sums, sums + rows, 0.f);
+
+    const float* q = query + queryOffsets[b] + q0 * headSize;
+    const float* k = key + keyOffsets[b];
+    const float* v = value + valueOffsets[b];
+
+    for (size_t k0 = 0; k0 < keyLength; k0 += keyBlock) {
+        const size_t cols = std::min(keyBlock, keyLength - k0);
+
+        // the keys are stored as [headSize x cols] tile, so the loops below are contiguous along the keys
+        if (transposeKey) {
+            for (size_t j = 0; j < cols; j++) {
+                const float* kRow = k + (k0 + j) * headSize;
+                for (size_t d = 0; d < headSize; d++)
+                    keyTile[d * keyBlock + j] = kRow[d];
+            }
+        } else {
+            for (size_t d = 0; d < headSize; d++)
+                std::copy(k + d * keyLength + k0, k + d * keyLength + k0 + cols, keyTile + d * keyBlock);
+        }
+
+        for (size_t i = 0; i < rows; i++) {
+            float* s = scores + i * keyBlock;
+            const float* qRow = q + i * headSize;
+            std::fill(s, s + cols, 0.f);
+            for (size_t d = 0; d < headSize; d++) {
+                const float qv = qRow[d];
+                const float* t = keyTile + d * keyBlock;
+                for (size_t j = 0; j < cols; j++)
+                    s[j] += qv * t[j];
+            }
+            for (size_t j = 0; j < cols; j++)
+                s[j] *= scale;
+            if (mask) {
+                const float* m = mask + maskOffsets[b] + (q0 + i) * maskRowStride + k0 * maskColStride;
+                for (size_t j = 0; j < cols; j++)
+                    s[j] += m[j * maskColStride];
+            }
+
+            // online softmax: the row is rescaled when the running maximum grows
+            const float newMax = std::max(maxes[i], *std::max_element(s, s + cols));
+            if (newMax == -std::numeric_limits<float>::infinity()) {
+                // the row is fully masked so far
+                std::fill(s, s + cols, 0.f);
+                continue;
+            }
+            float sum = 0.f;
+            for (size_t j = 0; j < cols; j++) {
+                s[j] = std::exp(s[j] - newMax);
+                sum += s[j];
+            }
+            const float correction = std::exp(maxes[i] - newMax);
+            if (correction != 1.f) {
+                float* a = acc + i * valueHeadSize;
+                for (size_t c = 0; c < valueHeadSize; c++)
+                    a[c] *= correction;
+            }
+            sums[i] = sums[i] * correction + sum;
+            maxes[i] = newMax;
+        }
+
+        for (size_t i = 0; i < rows; i++) {
+            const float* p = scores + i * keyBlock;
+            float* a = acc + i * valueHeadSize;
+            for (size_t j = 0; j < cols; j++) {
+                const float pv = p[j];
+                const float* vRow = v + (k0 + j) * valueHeadSize;
+                for (size_t c = 0; c < valueHeadSize; c++)
+                    a[c] += pv * vRow[c];
+            }
+        }
+    }
+
+    float* out = dst + (b * queryLength + q0) * valueHeadSize;
+    for (size_t i = 0; i < rows; i++) {
+        const float norm = sums[i] > 0.f ? 1.f / sums[i] : 0.f;
+        for (size_t c = 0; c < valueHeadSize; c++)
+            out[i * valueHeadSize + c] = acc[i * valueHeadSize + c] * norm;
+    }
+}
+
+void MKLDNNScaledDotProductAttentionNode::execute(mkldnn::stream strm) {
+    const float* query = getInputData(0, queryBuffer);
+    const float* key = getInputData(1, keyBuffer);
+    const float* value = getInputData(2, valueBuffer);
+    const float* mask = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(3)->getMemory().GetPtr()) : nullptr;
+
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const size_t dstSize = dstMemory.GetShape().getElementsCount();
+    float* dst = nullptr;
+    if (precision == Precision::FP32) {
+        dst = reinterpret_cast<float*>(dstMemory.GetPtr());
+    } else {
+        dstBuffer.resize(dstSize);
+        dst = dstBuffer.data();
+    }
+
+    const size_t batch = queryOffsets.size();
+    parallel_for2d(batch, div_up(queryLength, queryBlock), [&](size_t b, size_t qb) {
+        executeBlock(b, qb * queryBlock, query, key, value, mask, dst,
+                     scratch.data() + parallel_get_thread_num() * scratchPerThread);
+    });
+
+    if (precision != Precision::FP32)
+        cpu_convert(dst, dstMemory.GetPtr(), Precision::FP32, precision, dstSize);
+}
+
+bool MKLDNNScaledDotProductAttentionNode::created() const {
+    return getType() == ScaledDotProductAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNScaledDotProductAttentionNode, ScaledDotProductAttention)
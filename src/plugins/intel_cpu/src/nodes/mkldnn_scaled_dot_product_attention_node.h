@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Computes Softmax(Q * K^T * scale + mask) * V by [blockQ x blockK] tiles of the scores matrix. The softmax is computed
+ * online: every row keeps the running maximum and sum of exponents, and the accumulated output row is rescaled when
+ * the maximum grows. So only a tile of the scores matrix per thread is kept in memory instead of the whole
+ * [Lq x Lk] matrix per head.
+ */
+class MKLDNNScaledDotProductAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNScaledDotProductAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                        MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override {
+        execute(strm);
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    const float* getInputData(size_t port, std::vector<float>& buffer) const;
+    void executeBlock(size_t b, size_t q0, const float* query, const float* key, const float* value, const float* mask,
+                      float* dst, float* buffer) const;
+
+    float scale = 1.f;
+    bool transposeKey = true;
+    bool withMask = false;
+    InferenceEngine::Precision precision = InferenceEngine::Precision::FP32;
+
+    size_t queryLength = 0;
+    size_t keyLength = 0;
+    size_t headSize = 0;
+    size_t valueHeadSize = 0;
+    size_t maskRowStride = 0;
+    size_t maskColStride = 0;
+    size_t keyBlock = 0;
+    // offsets of the matrices for every batch index of the output, the broadcasted inputs repeat the offsets
+    std::vector<size_t> queryOffsets;
+    std::vector<size_t> keyOffsets;
+    std::vector<size_t> valueOffsets;
+    std::vector<size_t> maskOffsets;
+
+    size_t scratchPerThread = 0;
+    std::vector<float> scratch;
+    // fp32 copies of the bf16 tensors
+    std::vector<float> queryBuffer;
+    std::vector<float> keyBuffer;
+    std::vector<float> valueBuffer;
+    std::vector<float> dstBuffer;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -9,6 +9,9 @@
 #include "mkldnn_input_node.h"
 #include <ngraph/opsets/opset1.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <numeric>
 #include <string>
 
 #define THROW_ERROR IE_THROW() << NameFromType(getType()) << " node with name '" << getName() << "' "
@@ -284,6 +287,17 @@ void MKLDNNStridedSliceNode::initSupportedPrimitiveDescriptors() {
     }
     supportedTypes.push_back(LayoutType::ncsp);
     auto creators = BlockedDescCreator::getCommonCreators();
+
+    // Optimized inplace case
+    if (!isConstantInput[DATA_ID] && canOutputBeView() && canSliceBeView(viewOffset)) {
+        auto viewConfig = config;
+        viewConfig.inConfs[DATA_ID].desc = makeViewDesc(dataPrecision, getInputShapeAtPort(DATA_ID));
+        for (size_t i = BEGIN_ID; i < viewConfig.inConfs.size(); i++)
+            viewConfig.inConfs[i].desc = creators.at(LayoutType::ncsp)->createSharedDesc(iPrecision, getInputShapeAtPort(i));
+        viewConfig.outConfs[0].inPlace = DATA_ID;
+        viewConfig.outConfs[0].desc = makeViewDesc(dataPrecision, getOutputShapeAtPort(0));
+        supportedPrimitiveDescriptors.emplace_back(viewConfig, impl_desc_type::unknown);
+    }
     auto range = BlockedDescCreator::makeFilteredRange(creators, nDims, supportedTypes);
 
     for (auto itr = range.first; itr != range.second; ++itr) {
@@ -300,8 +314,71 @@ void MKLDNNStridedSliceNode::initSupportedPrimitiveDescriptors() {
     }
 }
 
+bool MKLDNNStridedSliceNode::canSliceBeView(size_t& offset) const {
+    if (std::any_of(attrs.ellipsisMask.begin(), attrs.ellipsisMask.end(), [](int bit) { return bit == 1; }))
+        return false;
+
+    // begin and length of the slice for every source dim, the same normalization as the executor does
+    const auto& srcDims = getInputShapeAtPort(DATA_ID).getStaticDims();
+    VectorDims begin(srcDims.size(), 0);
+    VectorDims length(srcDims);
+    size_t srcIdx = 0;
+    for (size_t axis = 0; axis < attrs.begin.size() && srcIdx < srcDims.size(); ++axis) {
+        if (attrs.newAxisMask[axis] == 1)
+            continue;
+
+        const int dim = static_cast<int>(srcDims[srcIdx]);
+        auto normalize = [dim](int idx) {
+            idx = idx >= 0 ? idx : idx + dim;
+            return std::min(std::max(idx, 0), dim - 1);
+        };
+        const int b = normalize(attrs.beginMask[axis] == 1 ? attrs.begin[axis] : 0);
+        int e = b;
+        if (attrs.shrinkAxisMask[axis] != 1) {
+            if (axis < attrs.stride.size() && attrs.stride[axis] != 1)
+                return false;
+            e = normalize(attrs.endMask[axis] == 1 ? attrs.end[axis] - 1 : -1);
+        }
+        if (e < b)
+            return false;
+        begin[srcIdx] = b;
+        length[srcIdx] = e - b + 1;
+        srcIdx++;
+    }
+
+    const size_t elementsCount = std::accumulate(length.begin(), length.end(), size_t{1}, std::multiplies<size_t>());
+    if (elementsCount != getOutputShapeAtPort(0).getElementsCount())
+        return false;
+
+    // only the outermost sliced dim may be partial, all the inner ones must be taken in full
+    auto partialDim = std::find_if(length.begin(), length.end(), [](Dim dim) { return dim != 1; });
+    if (partialDim != length.end() &&
+            !std::equal(std::next(partialDim), length.end(), srcDims.begin() + std::distance(length.begin(), partialDim) + 1))
+        return false;
+
+    offset = 0;
+    size_t stride = 1;
+    for (size_t i = srcDims.size(); i-- > 0;) {
+        offset += begin[i] * stride;
+        stride *= srcDims[i];
+    }
+    return true;
+}
+
+void MKLDNNStridedSliceNode::selectOptimalPrimitiveDescriptor() {
+    selectOptimalViewDescriptor();
+}
+
+void MKLDNNStridedSliceNode::initOptimalPrimitiveDescriptor() {
+    if (isOutputView()) {
+        initOptimalViewDescriptor(viewOffset);
+    } else {
+        MKLDNNNode::initOptimalPrimitiveDescriptor();
+    }
+}
+
 bool MKLDNNStridedSliceNode::isExecutable() const {
-    return !isInputTensorAtPortEmpty(0);
+    return !isInputTensorAtPortEmpty(0) && !isOutputView();
 }
 
 void MKLDNNStridedSliceNode::createPrimitive() {
@@ -675,6 +752,8 @@ void MKLDNNStridedSliceNode::StridedSliceExecutor::exec(const uint8_t* srcData,
 }
 
 void MKLDNNStridedSliceNode::execute(mkldnn::stream strm) {
+    if (isOutputView())
+        return;
     if (!execPtr)
         THROW_ERROR << "doesn't have compiled executor!";
     const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemory().GetPtr());
@@ -17,6 +17,8 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
+    void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -32,6 +34,7 @@ protected:
 
 private:
     void addHiddenDims(const size_t nSrcDims, int ellipsisPos1);
+    bool canSliceBeView(size_t& offset) const;
     void orderParametersByLayouts(const MKLDNNMemoryPtr& srcMemPtr);
 
     struct StridedSliceAttributes {
@@ -86,6 +89,10 @@ private:
     using executorPtr = std::shared_ptr<StridedSliceExecutor>;
     executorPtr execPtr = nullptr;
 
+    // Unit steps slice of the outermost non unit dim is a contiguous block of data,
+    // so the output is a view on the input starting at viewOffset elements
+    size_t viewOffset = 0;
+
     bool isStridedSliceOp = true;
     bool isStrideSpecified = false;
     bool isAxesSpecified = false;
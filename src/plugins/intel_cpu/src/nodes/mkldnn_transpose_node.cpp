@@ -6,6 +6,7 @@
 #include "ie_parallel.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <string>
 #include "mkldnn_extension_utils.h"
 #include <common/primitive_hashing_utils.hpp>
@@ -78,6 +79,21 @@ void MKLDNNTransposeNode::initSupportedPrimitiveDescriptors() {
 
     const auto& inputDataShape = getInputShapeAtPort(INPUT_DATA_IDX);
     const auto& outputDataShape = getOutputShapeAtPort(0);
+
+    // Optimized inplace case: the permutation keeps the order of the non unit dims, so the data in memory are the same
+    if (isInputOrderConst && canOutputBeView()) {
+        const auto& srcDims = inputDataShape.getStaticDims();
+        std::vector<size_t> nonUnitOrder;
+        std::copy_if(order.begin(), order.end(), std::back_inserter(nonUnitOrder), [&](size_t axis) { return srcDims[axis] != 1; });
+        if (order.size() == srcDims.size() && std::is_sorted(nonUnitOrder.begin(), nonUnitOrder.end())) {
+            auto viewConfig = config;
+            viewConfig.inConfs[INPUT_DATA_IDX].desc = makeViewDesc(prec, inputDataShape);
+            viewConfig.outConfs[0].inPlace = INPUT_DATA_IDX;
+            viewConfig.outConfs[0].desc = makeViewDesc(prec, outputDataShape);
+            supportedPrimitiveDescriptors.push_back({viewConfig, impl_desc_type::unknown});
+        }
+    }
+
     if (inputDataShape.getRank() == 4 || inputDataShape.getRank() == 5) {
         config.inConfs[0].desc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(prec, inputDataShape);
         config.outConfs[0].desc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(prec, outputDataShape);
@@ -107,8 +123,20 @@ void MKLDNNTransposeNode::initSupportedPrimitiveDescriptors() {
     }
 }
 
+void MKLDNNTransposeNode::selectOptimalPrimitiveDescriptor() {
+    selectOptimalViewDescriptor();
+}
+
+void MKLDNNTransposeNode::initOptimalPrimitiveDescriptor() {
+    if (isOutputView()) {
+        initOptimalViewDescriptor(0);
+    } else {
+        MKLDNNNode::initOptimalPrimitiveDescriptor();
+    }
+}
+
 bool MKLDNNTransposeNode::isExecutable() const {
-    return !isInputTensorAtPortEmpty(0);
+    return !isInputTensorAtPortEmpty(0) && !isOutputView();
 }
 
 bool MKLDNNTransposeNode::needPrepareParams() const {
@@ -153,6 +181,9 @@ void MKLDNNTransposeNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW() << "Preferable primitive descriptor was not set.";
 
+    if (isOutputView())
+        return;
+
     if (getParentEdgeAt(INPUT_DATA_IDX)->getMemory().getDesc().hasLayoutType(LayoutType::ncsp) &&
             std::find(optimizedOrders.begin(), optimizedOrders.end(), order) != optimizedOrders.end()) {
         isOptimized = true;
@@ -276,6 +307,9 @@ void MKLDNNTransposeNode::optimizedExecute(const int MB, const MKLDNNMemoryPtr&
 }
 
 void MKLDNNTransposeNode::execute(mkldnn::stream strm) {
+    if (isOutputView())
+        return;
+
     if (execPtr) {
         auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
         auto &srcMemPtr = getParentEdgeAt(INPUT_DATA_IDX)->getMemoryPtr();
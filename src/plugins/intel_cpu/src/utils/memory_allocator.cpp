@@ -0,0 +1,284 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_allocator.h"
+
+#include <cstdlib>
+#include <limits>
+
+#include <ie_common.h>
+
+#include "numa_utils.h"
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+#if defined(__linux__)
+#include <sys/mman.h>
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+constexpr size_t defaultAlignment = 64;
+constexpr size_t hugePageSize = 2ul << 20;
+constexpr size_t gigaPageSize = 1ul << 30;
+
+thread_local MemoryAllocator* currentAllocator = nullptr;
+thread_local MemoryAllocator::Lifetime currentLifetime = MemoryAllocator::Lifetime::Persistent;
+thread_local int currentNumaNodeId = -1;
+
+size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+void* alignedAlloc(size_t size) {
+#if defined(_WIN32)
+    return _aligned_malloc(size, defaultAlignment);
+#else
+    void* ptr = nullptr;
+    return posix_memalign(&ptr, defaultAlignment, size) == 0 ? ptr : nullptr;
+#endif
+}
+
+void alignedFree(void* ptr) {
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+}  // namespace
+
+struct MemoryAllocator::Mapping {
+    enum class Kind {
+        Heap,
+        Pages,           // anonymous mapping without huge pages
+        HugePages,       // hugetlbfs pages
+        TransparentHugePages,
+    };
+    Kind kind;
+    size_t size;
+    bool numaBound;
+};
+
+MemoryAllocator::MemoryAllocator(const Config& config) : config(config) {}
+
+MemoryAllocator::~MemoryAllocator() {
+    for (auto& buffers : freeBuffers) {
+        for (auto ptr : buffers.second) {
+            alignedFree(ptr);
+        }
+    }
+}
+
+std::shared_ptr<void> MemoryAllocator::allocate(size_t size, Lifetime lifetime, int numaNodeId) {
+    if (size == 0)
+        return nullptr;
+
+    // the buffers keep the allocator alive, since they are returned to its pool
+    auto self = shared_from_this();
+    if (lifetime == Lifetime::Persistent) {
+        Mapping mapping{Mapping::Kind::Heap, 0, false};
+        void* ptr = allocatePersistent(size, mapping);
+        if (ptr == nullptr)
+            IE_THROW() << "Failed to allocate " << size << " bytes of persistent memory";
+        if (numaNodeId >= 0)
+            bindPersistent(ptr, mapping, numaNodeId);
+        return std::shared_ptr<void>(ptr, [self, mapping](void* p) {
+            self->releasePersistent(p, mapping);
+        });
+    }
+
+    const size_t sizeClass = config.pool ? getSizeClass(size) : size;
+    void* ptr = allocateTransient(sizeClass);
+    if (ptr == nullptr)
+        IE_THROW() << "Failed to allocate " << size << " bytes of transient memory";
+    return std::shared_ptr<void>(ptr, [self, sizeClass](void* p) {
+        self->releaseTransient(p, sizeClass);
+    });
+}
+
+void* MemoryAllocator::allocatePersistent(size_t size, Mapping& mapping) {
+#if defined(__linux__)
+    if (config.hugePages != HugePages::Disabled && size >= hugePageSize) {
+        if (config.hugePages == HugePages::Explicit2M || config.hugePages == HugePages::Explicit1G) {
+            const bool gigaPages = config.hugePages == HugePages::Explicit1G && size >= gigaPageSize;
+            const size_t pageSize = gigaPages ? gigaPageSize : hugePageSize;
+            const int pageShift = gigaPages ? 30 : 21;
+            const size_t mappedSize = roundUp(size, pageSize);
+            void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (pageShift << MAP_HUGE_SHIFT), -1, 0);
+            if (ptr != MAP_FAILED) {
+                mapping = {Mapping::Kind::HugePages, mappedSize, false};
+                hugePagesBytes += mappedSize;
+                persistentBytes += mappedSize;
+                return ptr;
+            }
+            // the hugetlbfs pool of the system is exhausted or not configured
+            hugePagesFallbacks++;
+        }
+
+        // the mapping is aligned to the huge page, so the whole buffer can be backed by transparent huge pages
+        const size_t mappedSize = roundUp(size, hugePageSize);
+        void* raw = mmap(nullptr, mappedSize + hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw != MAP_FAILED) {
+            const auto rawBegin = reinterpret_cast<uintptr_t>(raw);
+            const auto rawEnd = rawBegin + mappedSize + hugePageSize;
+            const auto begin = roundUp(rawBegin, hugePageSize);
+            const auto end = begin + mappedSize;
+            if (begin > rawBegin)
+                munmap(raw, begin - rawBegin);
+            if (rawEnd > end)
+                munmap(reinterpret_cast<void*>(end), rawEnd - end);
+
+            void* ptr = reinterpret_cast<void*>(begin);
+            if (madvise(ptr, mappedSize, MADV_HUGEPAGE) == 0) {
+                mapping = {Mapping::Kind::TransparentHugePages, mappedSize, false};
+                transparentHugePagesBytes += mappedSize;
+            } else {
+                // transparent huge pages are disabled in the system
+                mapping = {Mapping::Kind::Pages, mappedSize, false};
+                if (config.hugePages == HugePages::Transparent)
+                    hugePagesFallbacks++;
+            }
+            persistentBytes += mappedSize;
+            return ptr;
+        }
+    }
+#endif
+    void* ptr = alignedAlloc(size);
+    if (ptr != nullptr) {
+        mapping = {Mapping::Kind::Heap, size, false};
+        persistentBytes += size;
+    }
+    return ptr;
+}
+
+void MemoryAllocator::bindPersistent(void* ptr, Mapping& mapping, int numaNodeId) {
+    // mbind of a part of hugetlbfs mapping fails, since the kernel can't split the mapping inside of a huge page,
+    // so the mapping is bound as a whole. Only whole pages inside of the heap buffer are bound
+    if (bindToNumaNode(ptr, mapping.size, numaNodeId)) {
+        mapping.numaBound = true;
+        numaBoundBytes += mapping.size;
+    } else {
+        numaBindFailures++;
+    }
+}
+
+void MemoryAllocator::releasePersistent(void* ptr, const Mapping& mapping) {
+    persistentBytes -= mapping.size;
+    if (mapping.numaBound)
+        numaBoundBytes -= mapping.size;
+    switch (mapping.kind) {
+    case Mapping::Kind::Heap:
+        alignedFree(ptr);
+        return;
+    case Mapping::Kind::HugePages:
+        hugePagesBytes -= mapping.size;
+        break;
+    case Mapping::Kind::TransparentHugePages:
+        transparentHugePagesBytes -= mapping.size;
+        break;
+    case Mapping::Kind::Pages:
+        break;
+    }
+#if defined(__linux__)
+    munmap(ptr, mapping.size);
+#endif
+}
+
+void* MemoryAllocator::allocateTransient(size_t size) {
+    if (config.pool) {
+        std::lock_guard<std::mutex> lock{poolMutex};
+        auto buffers = freeBuffers.find(size);
+        if (buffers != freeBuffers.end() && !buffers->second.empty()) {
+            void* ptr = buffers->second.back();
+            buffers->second.pop_back();
+            cachedBytes -= size;
+            poolHits++;
+            transientBytes += size;
+            return ptr;
+        }
+        poolMisses++;
+    }
+    void* ptr = alignedAlloc(size);
+    if (ptr != nullptr)
+        transientBytes += size;
+    return ptr;
+}
+
+void MemoryAllocator::releaseTransient(void* ptr, size_t sizeClass) {
+    transientBytes -= sizeClass;
+    if (config.pool) {
+        std::lock_guard<std::mutex> lock{poolMutex};
+        if (cachedBytes + sizeClass <= config.poolCapacity) {
+            freeBuffers[sizeClass].push_back(ptr);
+            cachedBytes += sizeClass;
+            return;
+        }
+    }
+    alignedFree(ptr);
+}
+
+std::map<std::string, uint64_t> MemoryAllocator::getStats() const {
+    uint64_t poolCachedBytes = 0;
+    {
+        std::lock_guard<std::mutex> lock{poolMutex};
+        poolCachedBytes = cachedBytes;
+    }
+    return {
+        {"persistent_bytes", persistentBytes},
+        {"transient_bytes", transientBytes},
+        {"huge_pages_bytes", hugePagesBytes},
+        {"transparent_huge_pages_bytes", transparentHugePagesBytes},
+        {"huge_pages_fallbacks", hugePagesFallbacks},
+        {"pool_hits", poolHits},
+        {"pool_misses", poolMisses},
+        {"pool_cached_bytes", poolCachedBytes},
+        {"numa_bound_bytes", numaBoundBytes},
+        {"numa_bind_failures", numaBindFailures},
+    };
+}
+
+size_t MemoryAllocator::getSizeClass(size_t size) {
+    constexpr size_t minSizeClass = defaultAlignment;
+    if (size <= minSizeClass)
+        return minSizeClass;
+    if (size > (std::numeric_limits<size_t>::max() >> 1))
+        return size;
+    size_t power = minSizeClass;
+    while (power < size)
+        power <<= 1;
+    // the classes between power / 2 and power are 5/8, 6/8, 7/8 and 8/8 of power
+    return roundUp(size, power / 8);
+}
+
+std::shared_ptr<void> MemoryAllocator::allocateInScope(size_t size) {
+    if (currentAllocator == nullptr)
+        return nullptr;
+    return currentAllocator->allocate(size, currentLifetime, currentNumaNodeId);
+}
+
+MemoryAllocator::Scope::Scope(const Ptr& allocator, Lifetime lifetime, int numaNodeId)
+    : prevAllocator(currentAllocator),
+      prevLifetime(currentLifetime),
+      prevNumaNodeId(currentNumaNodeId) {
+    currentAllocator = allocator.get();
+    currentLifetime = lifetime;
+    currentNumaNodeId = numaNodeId;
+}
+
+MemoryAllocator::Scope::~Scope() {
+    currentAllocator = prevAllocator;
+    currentLifetime = prevLifetime;
+    currentNumaNodeId = prevNumaNodeId;
+}
+
+}  // namespace MKLDNNPlugin
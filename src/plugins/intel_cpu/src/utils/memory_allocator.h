@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Allocator of the buffers which MKLDNNMemory owns (graph workspace, constant data, reordered weights and
+ * the memory of dynamic shapes).
+ *
+ * Buffers allocated during the graph creation are long-lived: the ones of 2 MB and larger are mapped with huge pages
+ * to reduce TLB misses. Explicit huge pages come from the hugetlbfs pool of the system, if the pool is exhausted
+ * transparent huge pages are requested by madvise, and regular pages are used as the last resort.
+ *
+ * Buffers allocated during the inference are transient (outputs of nodes reallocated for new dynamic shapes), they
+ * are taken from the pool of size classes, so the same sizes don't go through the system allocator every inference.
+ *
+ * Persistent buffers are bound to the NUMA node of the scope before the first touch. The whole mapping is bound, since
+ * a range of huge pages which isn't aligned to the huge page size can't be bound.
+ *
+ * The allocator is selected for the current thread by MemoryAllocator::Scope, MKLDNNMemory falls back to the
+ * oneDNN allocation out of the scope.
+ */
+class MemoryAllocator : public std::enable_shared_from_this<MemoryAllocator> {
+public:
+    using Ptr = std::shared_ptr<MemoryAllocator>;
+
+    enum class HugePages {
+        Disabled,
+        Transparent,  // madvise(MADV_HUGEPAGE)
+        Explicit2M,   // hugetlbfs 2 MB pages
+        Explicit1G,   // hugetlbfs 1 GB pages for buffers of 1 GB and larger, 2 MB pages for the rest
+    };
+
+    enum class Lifetime {
+        Persistent,
+        Transient,
+    };
+
+    struct Config {
+        HugePages hugePages = HugePages::Disabled;
+        bool pool = false;
+        size_t poolCapacity = 256ul << 20;  // bytes of the free buffers kept by the pool
+    };
+
+    explicit MemoryAllocator(const Config& config);
+    ~MemoryAllocator();
+
+    /**
+     * @brief Allocates the buffer aligned to 64 bytes at least, the buffer is released when the pointer is destroyed
+     * @param numaNodeId The NUMA node to bind the persistent buffer to, -1 keeps the default placement
+     * @return nullptr for zero size
+     */
+    std::shared_ptr<void> allocate(size_t size, Lifetime lifetime, int numaNodeId = -1);
+
+    /**
+     * @brief Statistics of the allocations:
+     *  - persistent_bytes, transient_bytes: bytes of the allocated buffers;
+     *  - huge_pages_bytes, transparent_huge_pages_bytes: bytes mapped with explicit and transparent huge pages;
+     *  - huge_pages_fallbacks: number of buffers which didn't get the requested huge pages;
+     *  - pool_hits, pool_misses: transient allocations served by the pool and by the system allocator;
+     *  - pool_cached_bytes: bytes of the free buffers kept by the pool;
+     *  - numa_bound_bytes: bytes of the persistent buffers bound to NUMA nodes;
+     *  - numa_bind_failures: number of persistent buffers which failed to be bound to the requested NUMA node.
+     */
+    std::map<std::string, uint64_t> getStats() const;
+
+    const Config& getConfig() const {
+        return config;
+    }
+
+    /**
+     * @brief Allocates with the allocator of the current thread scope
+     * @return nullptr if there is no scope
+     */
+    static std::shared_ptr<void> allocateInScope(size_t size);
+
+    /**
+     * @brief Selects the allocator, the lifetime and the NUMA node of the allocations in the current thread, null
+     * allocator keeps the allocations out of the scope
+     */
+    class Scope {
+    public:
+        Scope(const Ptr& allocator, Lifetime lifetime, int numaNodeId = -1);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        MemoryAllocator* prevAllocator;
+        Lifetime prevLifetime;
+        int prevNumaNodeId;
+    };
+
+    /**
+     * @brief Size classes of the pool: 4 classes per power of two, so at most 25% of the buffer is wasted
+     */
+    static size_t getSizeClass(size_t size);
+
+private:
+    struct Mapping;
+
+    void* allocatePersistent(size_t size, Mapping& mapping);
+    void bindPersistent(void* ptr, Mapping& mapping, int numaNodeId);
+    void* allocateTransient(size_t size);
+    void releasePersistent(void* ptr, const Mapping& mapping);
+    void releaseTransient(void* ptr, size_t sizeClass);
+
+    const Config config;
+
+    mutable std::mutex poolMutex;
+    std::unordered_map<size_t, std::vector<void*>> freeBuffers;
+    size_t cachedBytes = 0;
+
+    std::atomic<uint64_t> persistentBytes{0};
+    std::atomic<uint64_t> transientBytes{0};
+    std::atomic<uint64_t> hugePagesBytes{0};
+    std::atomic<uint64_t> transparentHugePagesBytes{0};
+    std::atomic<uint64_t> hugePagesFallbacks{0};
+    std::atomic<uint64_t> poolHits{0};
+    std::atomic<uint64_t> poolMisses{0};
+    std::atomic<uint64_t> numaBoundBytes{0};
+    std::atomic<uint64_t> numaBindFailures{0};
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_utils.h"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+#if defined(__linux__)
+namespace {
+
+// the values are taken from <numaif.h> to avoid dependency on libnuma
+constexpr int mpolBind = 2;
+constexpr unsigned mpolMfMove = 1u << 1;
+constexpr size_t maxNumaNodes = 1024;
+
+size_t getPageSize() {
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+}  // namespace
+
+bool bindToNumaNode(const void* ptr, size_t size, int numaNodeId) {
+    if (ptr == nullptr || numaNodeId < 0 || static_cast<size_t>(numaNodeId) >= maxNumaNodes)
+        return false;
+
+    const size_t pageSize = getPageSize();
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + pageSize - 1) / pageSize * pageSize;
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) / pageSize * pageSize;
+    // there is nothing to bind if the range doesn't contain whole pages
+    if (begin >= end)
+        return true;
+
+    std::vector<unsigned long> nodeMask(maxNumaNodes / (8 * sizeof(unsigned long)), 0);  // NOLINT
+    nodeMask[numaNodeId / (8 * sizeof(unsigned long))] |= 1ul << (numaNodeId % (8 * sizeof(unsigned long)));
+    return syscall(SYS_mbind, begin, end - begin, mpolBind, nodeMask.data(), maxNumaNodes, mpolMfMove) == 0;
+}
+
+void collectNumaNodesResidentBytes(const void* ptr, size_t size, std::map<int, uint64_t>& residentBytes) {
+    if (ptr == nullptr || size == 0)
+        return;
+
+    const size_t pageSize = getPageSize();
+    const auto first = reinterpret_cast<uintptr_t>(ptr) / pageSize * pageSize;
+    const auto last = reinterpret_cast<uintptr_t>(ptr) + size;
+    const size_t pagesNum = (last - first + pageSize - 1) / pageSize;
+
+    std::vector<void*> pages(pagesNum);
+    for (size_t i = 0; i < pagesNum; i++)
+        pages[i] = reinterpret_cast<void*>(first + i * pageSize);
+    std::vector<int> status(pagesNum, -1);
+
+    // move_pages with null nodes doesn't move anything and returns the node of every page in status
+    if (syscall(SYS_move_pages, 0, pagesNum, pages.data(), nullptr, status.data(), 0) != 0) {
+        residentBytes[-1] += size;
+        return;
+    }
+
+    for (size_t i = 0; i < pagesNum; i++) {
+        // negative status means that the page isn't mapped yet
+        if (status[i] < 0)
+            continue;
+        const auto pageBegin = std::max(first + i * pageSize, reinterpret_cast<uintptr_t>(ptr));
+        const auto pageEnd = std::min(first + (i + 1) * pageSize, last);
+        residentBytes[status[i]] += pageEnd - pageBegin;
+    }
+}
+#else
+bool bindToNumaNode(const void* ptr, size_t size, int numaNodeId) {
+    return false;
+}
+
+void collectNumaNodesResidentBytes(const void* ptr, size_t size, std::map<int, uint64_t>& residentBytes) {
+    if (ptr != nullptr && size != 0)
+        residentBytes[-1] += size;
+}
+#endif
+
+}  // namespace MKLDNNPlugin
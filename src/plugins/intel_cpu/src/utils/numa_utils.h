@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Binds pages of the memory range to the NUMA node, pages which have been already touched are migrated.
+ *        Only whole pages inside the range are bound, the range of huge pages must be aligned to the huge page size.
+ * @return false if NUMA binding isn't supported by the platform or the call failed
+ */
+bool bindToNumaNode(const void* ptr, size_t size, int numaNodeId);
+
+/**
+ * @brief Adds resident bytes of the memory range to the per NUMA node statistics. Pages which haven't been touched
+ *        yet are skipped. If the placement can't be queried, the whole range is accounted under -1 node id.
+ */
+void collectNumaNodesResidentBytes(const void* ptr, size_t size, std::map<int, uint64_t>& residentBytes);
+
+}  // namespace MKLDNNPlugin
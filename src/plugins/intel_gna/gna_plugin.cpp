@@ -35,6 +35,7 @@
 #include "memory/gna_memory_state.hpp"
 #include "gna_model_serial.hpp"
 #include "runtime/gna_float_runtime.hpp"
+#include "runtime/quantize_input.hpp"
 #include <layers/gna_fake_quantize_layer.hpp>
 #include "gna_graph_patterns.hpp"
 #include "gna_tensor_tools.hpp"
@@ -128,6 +129,12 @@ void GNAPlugin::copyInputData(T *dst,
     if (!dst || !src) {
         return;
     }
+    if (std::is_same<U, float>::value && !std::is_same<T, U>::value) {
+        GNAPluginNS::runtime::XARCH::QuantizeInput(dst, reinterpret_cast<const float *>(src), num_frames, num_group,
+            num_vector_elements, num_vector_stride, orientation == kDnnInterleavedOrientation,
+            gnaFlags->input_low_precision, scaleFactor);
+        return;
+    }
     if (orientation == kDnnInterleavedOrientation) {
         for (uint32_t i = 0; i < num_frames; i++) {
             for (uint32_t j = 0; j < num_vector_elements; j++) {
@@ -200,44 +207,25 @@ void GNAPlugin::ExportScores(void *ptr_dst,
     // rotate if necessary and only copy actual scores (not padding)
     if (orientation == kDnnInterleavedOrientation) {
         if (num_bytes_per_element == 2) {
-            int16_t *dst = reinterpret_cast<int16_t *>(ptr_dst);
-            const int16_t *src = reinterpret_cast<const int16_t *>(ptr_src);
-            for (uint32_t i = 0; i < num_frames; i++) {
-                for (uint32_t j = 0; j < num_active_elements; j++) {
-                    dst[i * num_vector_elements + j] = src[j * num_group + i];
-                }
-                for (uint32_t j = num_active_elements; j < num_vector_elements; j++) {
-                    dst[i * num_vector_elements + j] = 0;
-                }
-            }
+            TransposeScores(reinterpret_cast<int16_t *>(ptr_dst), reinterpret_cast<const int16_t *>(ptr_src),
+                            num_frames, num_group, num_vector_elements, num_active_elements);
         } else if (num_bytes_per_element == 4) {  // should work for both int and float
-            int32_t *dst = reinterpret_cast<int32_t *>(ptr_dst);
-            const int8_t *src = reinterpret_cast<const int8_t*>(ptr_src);
-            for (uint32_t i = 0; i < num_frames; i++) {
-                for (uint32_t j = 0; j < num_active_elements; j++) {
-                    auto input_ptr = src + (j * num_group + i) * num_bytes_per_element_input;
-                    auto dst_ptr = dst + (i * num_vector_elements + j);
-
-                    switch (num_bytes_per_element_input) {
-                        case 1: {
-                            *dst_ptr = static_cast<int32_t>(*reinterpret_cast<const int8_t*>(input_ptr));
-                            break;
-                        }
-                        case 2 : {
-                            *dst_ptr  = static_cast<int32_t>(*reinterpret_cast<const int16_t*>(input_ptr));
-                            break;
-                        }
-                        case 4 : {
-                            *dst_ptr = *reinterpret_cast<const int32_t *>(input_ptr);
-                            break;
-                        }
-                        default:
-                            THROW_GNA_EXCEPTION << "Unsupported output layer precision: " << num_bytes_per_element_input << "bytes";
-                    }
-                }
-                for (uint32_t j = num_active_elements; j < num_vector_elements; j++) {
-                    dst[i * num_vector_elements + j] = 0;
-                }
+            auto dst = reinterpret_cast<int32_t *>(ptr_dst);
+            switch (num_bytes_per_element_input) {
+                case 1:
+                    TransposeScores(dst, reinterpret_cast<const int8_t *>(ptr_src),
+                                    num_frames, num_group, num_vector_elements, num_active_elements);
+                    break;
+                case 2:
+                    TransposeScores(dst, reinterpret_cast<const int16_t *>(ptr_src),
+                                    num_frames, num_group, num_vector_elements, num_active_elements);
+                    break;
+                case 4:
+                    TransposeScores(dst, reinterpret_cast<const int32_t *>(ptr_src),
+                                    num_frames, num_group, num_vector_elements, num_active_elements);
+                    break;
+                default:
+                    THROW_GNA_EXCEPTION << "Unsupported output layer precision: " << num_bytes_per_element_input << "bytes";
             }
         } else {
             THROW_GNA_EXCEPTION << "Unsupported target precision for infer : " << num_bytes_per_element << "bytes";
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <ie_memcpy.h>
 #include "gna_data_types.hpp"
 
@@ -79,4 +80,22 @@ inline void ConvertTensorFromNCHWToNHWC(size_t precision, size_t rows, size_t co
     }
 }
 
-} // namespace GNAPluginNS
\ No newline at end of file
+/**
+ * @brief copies the interleaved scores to the frames: the element j of the frame i is read from src[j * num_group + i].
+ * Elements from num_active_elements up to num_vector_elements of every frame are zeroed.
+ * @param dst pointer to the frames, num_frames * num_vector_elements elements
+ * @param src pointer to the interleaved scores, num_active_elements * num_group elements at least
+ */
+template <typename TDst, typename TSrc>
+inline void TransposeScores(TDst* dst, const TSrc* src, uint32_t num_frames, uint32_t num_group,
+                            uint32_t num_vector_elements, uint32_t num_active_elements) {
+    for (uint32_t i = 0; i < num_frames; i++) {
+        TDst* dst_vec = dst + i * num_vector_elements;
+        for (uint32_t j = 0; j < num_active_elements; j++) {
+            dst_vec[j] = static_cast<TDst>(src[j * num_group + i]);
+        }
+        std::fill(dst_vec + std::min(num_active_elements, num_vector_elements), dst_vec + num_vector_elements, TDst{0});
+    }
+}
+
+} // namespace GNAPluginNS
@@ -9,6 +9,9 @@
 #include <limits>
 #include <cstdint>
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 #ifdef _NO_MKL_
 #include <cmath>
@@ -468,6 +471,82 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
 }
 
 
+namespace {
+
+// Pivot search depends on the function, its bounds and the error budget only, so the result is shared
+// by all layers with the same activation regardless of their scale factors
+struct PwlSearchKey {
+    DnnActivationType type;
+    float exponent;
+    float scale;
+    float offset;
+    double l_bound;
+    double u_bound;
+    double threshold;
+    double allowed_err_pct;
+    int samples;
+
+    bool operator<(const PwlSearchKey& other) const {
+        return std::tie(type, exponent, scale, offset, l_bound, u_bound, threshold, allowed_err_pct, samples) <
+               std::tie(other.type, other.exponent, other.scale, other.offset, other.l_bound, other.u_bound,
+                        other.threshold, other.allowed_err_pct, other.samples);
+    }
+};
+
+struct PwlSearchResult {
+    std::vector<pwl_t> pwl;
+    double err_pct;
+};
+
+// Limits the memory if a process designs activations for many different input statistics
+constexpr size_t kMaxPwlSearchCacheSize = 1024;
+
+std::mutex pwlSearchCacheMutex;
+std::map<PwlSearchKey, PwlSearchResult> pwlSearchCache;
+
+std::vector<pwl_t> pwl_search_cached(const DnnActivation& activation_type,
+                                     const double l_bound,
+                                     const double u_bound,
+                                     const double threshold,
+                                     const double allowed_err_pct,
+                                     const int samples,
+                                     double& err_pct) {
+    PwlSearchKey key{activation_type.type, 0.0f, 0.0f, 0.0f, l_bound, u_bound, threshold, allowed_err_pct, samples};
+    if (activation_type == kActPow) {
+        key.exponent = activation_type.args.pow.exponent;
+        key.scale = activation_type.args.pow.scale;
+        key.offset = activation_type.args.pow.offset;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pwlSearchCacheMutex);
+        auto found = pwlSearchCache.find(key);
+        if (found != pwlSearchCache.end()) {
+            err_pct = found->second.err_pct;
+            return found->second.pwl;
+        }
+    }
+    // the search isn't locked, so concurrent loads of the networks design different activations in parallel
+    auto pwl = pwl_search(activation_type, l_bound, u_bound, threshold, allowed_err_pct, samples, err_pct);
+    std::lock_guard<std::mutex> lock(pwlSearchCacheMutex);
+    if (pwlSearchCache.size() >= kMaxPwlSearchCacheSize) {
+        pwlSearchCache.clear();
+    }
+    pwlSearchCache[key] = {pwl, err_pct};
+    return pwl;
+}
+
+}  // namespace
+
+size_t PwlSearchCacheSize() {
+    std::lock_guard<std::mutex> lock(pwlSearchCacheMutex);
+    return pwlSearchCache.size();
+}
+
+void PwlSearchCacheClear() {
+    std::lock_guard<std::mutex> lock(pwlSearchCacheMutex);
+    pwlSearchCache.clear();
+}
+
 void PwlDesignOpt(const DnnActivation& activation_type,
                     std::vector<gna_pwl_segment_t> &ptr_segment,
                     const float scale_in,
@@ -487,7 +566,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
             auto absMax = std::max(std::abs(minInputStats), std::abs(maxInputStats));
             auto minInput = (activation_type.srcFQParams.set && absMax < SIGMOID_DOMAIN) ? -absMax : -SIGMOID_DOMAIN;
             auto maxInput = (activation_type.srcFQParams.set && absMax < SIGMOID_DOMAIN) ? absMax : SIGMOID_DOMAIN;
-            pwl = pwl_search(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, minInput, maxInput, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -495,7 +574,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
             auto absMax = std::max(std::abs(minInputStats), std::abs(maxInputStats));
             auto minInput = (activation_type.srcFQParams.set && absMax < TANH_DOMAIN) ? -absMax : -TANH_DOMAIN;
             auto maxInput = (activation_type.srcFQParams.set && absMax < TANH_DOMAIN) ? absMax : TANH_DOMAIN;
-            pwl = pwl_search(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, minInput, maxInput, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -503,7 +582,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
             auto absMax = std::max(std::abs(minInputStats), std::abs(maxInputStats));
             auto minInput = (activation_type.srcFQParams.set && absMax < SOFTSIGN_DOMAIN) ? -absMax : -SOFTSIGN_DOMAIN;
             auto maxInput = (activation_type.srcFQParams.set && absMax < SOFTSIGN_DOMAIN) ? absMax : SOFTSIGN_DOMAIN;
-            pwl = pwl_search(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, minInput, maxInput, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, minInput, maxInput, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -524,28 +603,28 @@ void PwlDesignOpt(const DnnActivation& activation_type,
         case kActLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((static_cast<double>(INT32_MAX) / scale_in) < LOG_DOMAIN) ? (static_cast<double>(INT32_MAX) / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
         case kActNegLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((static_cast<double>(INT32_MAX) / scale_in) < LOG_DOMAIN) ? (static_cast<double>(INT32_MAX) / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
         case kActNegHalfLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((static_cast<double>(INT32_MAX) / scale_in) < LOG_DOMAIN) ? (static_cast<double>(INT32_MAX) / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
         case kActExp: {
             double x_min = -log(scale_out);
             double x_max = x_min + log(INT16_MAX);
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, pwlMaxErrorPercent, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
             break;
         }
@@ -571,7 +650,7 @@ void PwlDesignOpt(const DnnActivation& activation_type,
 
             if (activation_type.args.pow.exponent != 0.0f) {
                 auto maxError = pwlMaxErrorPercent > 0.015f ? 0.015f: pwlMaxErrorPercent;
-                pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, maxError, PWL_DESIGN_SAMPLES, err_pct);
+                pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, maxError, PWL_DESIGN_SAMPLES, err_pct);
             }
 
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, low_precision, ptr_segment);
@@ -97,9 +97,21 @@ void PwlDesign(const DnnActivation& activation_type,
                  const float scale_in,
                  const float scale_out,
                  const bool low_precision);
+/**
+ * @brief Designs the GNA segments of the activation. Pivot search results are memoized in the process, so the layers
+ * with the same activation, input bounds and error budget share the search
+ */
 void PwlDesignOpt(const DnnActivation& activation_type,
                 std::vector<gna_pwl_segment_t> &ptr_segment,
                 const float scale_in,
                 const float scale_out,
                 const float pwlMaxErrorPercent,
                 const bool low_precision);
+/**
+ * @brief Returns the number of the pivot search results memoized by PwlDesignOpt
+ */
+size_t PwlSearchCacheSize();
+/**
+ * @brief Drops the pivot search results memoized by PwlDesignOpt
+ */
+void PwlSearchCacheClear();
@@ -0,0 +1,263 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "quantize_input.hpp"
+
+#include <cstring>
+#include <limits>
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+#include "preprocessing.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+namespace {
+
+// The scaled value is rounded to float before the rounding addend is added, as ConvertFloatToInt16/ConvertFloatToInt8
+// do. GNU compilers contract a multiplication followed by an addition into FMA when it's enabled (-ffp-contract=fast),
+// which changes the result near the half-way values, so the product is hidden from the optimizer
+inline float KeepRounded(float value) {
+#if defined(__GNUC__)
+    __asm__("" : "+x"(value));
+#endif
+    return value;
+}
+
+template <typename T>
+T Quantize(float value, float scale_factor);
+
+template <>
+int16_t Quantize<int16_t>(float value, float scale_factor) {
+    return ConvertFloatToInt16(KeepRounded(value * scale_factor));
+}
+
+template <>
+int8_t Quantize<int8_t>(float value, float scale_factor) {
+    return ConvertFloatToInt8(KeepRounded(value * scale_factor));
+}
+
+#if defined(HAVE_AVX2)
+constexpr uint32_t kBlock = 8;
+
+inline __m256 KeepRounded(__m256 value) {
+#if defined(__GNUC__)
+    __asm__("" : "+x"(value));
+#endif
+    return value;
+}
+
+// Rounds half away from zero and saturates exactly as ConvertFloatToInt16/ConvertFloatToInt8,
+// the result is truncated to integer by the conversion after the transposition
+template <typename T>
+inline __m256 QuantizeVector(__m256 value, __m256 scale) {
+    const __m256 lower = _mm256_set1_ps(static_cast<float>(std::numeric_limits<T>::min()));
+    const __m256 upper = _mm256_set1_ps(static_cast<float>(std::numeric_limits<T>::max()));
+    value = KeepRounded(_mm256_mul_ps(value, scale));
+    const __m256 positive = _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_GT_OQ);
+    value = _mm256_add_ps(value, _mm256_blendv_ps(_mm256_set1_ps(-0.5f), _mm256_set1_ps(0.5f), positive));
+    return _mm256_min_ps(_mm256_max_ps(value, lower), upper);
+}
+
+inline void StoreVector(int16_t* dst, __m256 value) {
+    const __m256i row = _mm256_cvttps_epi32(value);
+    const __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(row), _mm256_extracti128_si256(row, 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), packed);
+}
+
+inline void StoreVector(int8_t* dst, __m256 value) {
+    const __m256i row = _mm256_cvttps_epi32(value);
+    const __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(row), _mm256_extracti128_si256(row, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi16(packed, packed));
+}
+
+inline void Transpose8x8(__m256 (&rows)[kBlock]) {
+    const __m256 t0 = _mm256_unpacklo_ps(rows[0], rows[1]);
+    const __m256 t1 = _mm256_unpackhi_ps(rows[0], rows[1]);
+    const __m256 t2 = _mm256_unpacklo_ps(rows[2], rows[3]);
+    const __m256 t3 = _mm256_unpackhi_ps(rows[2], rows[3]);
+    const __m256 t4 = _mm256_unpacklo_ps(rows[4], rows[5]);
+    const __m256 t5 = _mm256_unpackhi_ps(rows[4], rows[5]);
+    const __m256 t6 = _mm256_unpacklo_ps(rows[6], rows[7]);
+    const __m256 t7 = _mm256_unpackhi_ps(rows[6], rows[7]);
+    const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+    rows[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+    rows[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+    rows[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+    rows[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+    rows[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+    rows[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+    rows[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+    rows[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+#endif
+
+#if defined(HAVE_AVX512F)
+constexpr uint32_t kWideBlock = 16;
+
+inline __m512 KeepRounded(__m512 value) {
+#if defined(__GNUC__)
+    __asm__("" : "+v"(value));
+#endif
+    return value;
+}
+
+template <typename T>
+inline __m512 QuantizeVector(__m512 value, __m512 scale) {
+    const __m512 lower = _mm512_set1_ps(static_cast<float>(std::numeric_limits<T>::min()));
+    const __m512 upper = _mm512_set1_ps(static_cast<float>(std::numeric_limits<T>::max()));
+    value = KeepRounded(_mm512_mul_ps(value, scale));
+    const __mmask16 positive = _mm512_cmp_ps_mask(value, _mm512_setzero_ps(), _CMP_GT_OQ);
+    value = _mm512_add_ps(value, _mm512_mask_blend_ps(positive, _mm512_set1_ps(-0.5f), _mm512_set1_ps(0.5f)));
+    return _mm512_min_ps(_mm512_max_ps(value, lower), upper);
+}
+
+inline void StoreVector(int16_t* dst, __m512 value) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm512_cvtsepi32_epi16(_mm512_cvttps_epi32(value)));
+}
+
+inline void StoreVector(int8_t* dst, __m512 value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm512_cvtsepi32_epi8(_mm512_cvttps_epi32(value)));
+}
+#endif
+
+// Scalar part of the interleaved layout: the frames from num_frames up to frame_end are zeros
+template <typename T>
+void QuantizeColumns(T* dst, const float* src,
+                     uint32_t frame_begin, uint32_t frame_end,
+                     uint32_t element_begin, uint32_t element_end,
+                     uint32_t num_frames, uint32_t num_group, uint32_t num_vector_elements,
+                     float scale_factor) {
+    for (uint32_t i = frame_begin; i < frame_end; i++) {
+        for (uint32_t j = element_begin; j < element_end; j++) {
+            dst[j * num_group + i] = i < num_frames ? Quantize<T>(src[i * num_vector_elements + j], scale_factor) : 0;
+        }
+    }
+}
+
+template <typename T>
+void QuantizeInterleaved(T* dst, const float* src,
+                         uint32_t num_frames, uint32_t num_group,
+                         uint32_t num_vector_elements, uint32_t num_vector_stride,
+                         float scale_factor) {
+    uint32_t vector_frames = 0;
+    uint32_t vector_elements = 0;
+#if defined(HAVE_AVX2)
+    // Blocks of 8 frames by 8 elements are transposed in registers, so every destination row of the block
+    // is stored at once. The group doesn't exceed 8 frames usually, so the blocks aren't extended to 16x16 for AVX-512
+    vector_frames = num_group - num_group % kBlock;
+    vector_elements = num_vector_elements - num_vector_elements % kBlock;
+    const __m256 scale = _mm256_set1_ps(scale_factor);
+    for (uint32_t i = 0; i < vector_frames; i += kBlock) {
+        for (uint32_t j = 0; j < vector_elements; j += kBlock) {
+            __m256 rows[kBlock];
+            for (uint32_t r = 0; r < kBlock; r++) {
+                rows[r] = i + r < num_frames
+                              ? QuantizeVector<T>(_mm256_loadu_ps(src + (i + r) * num_vector_elements + j), scale)
+                              : _mm256_setzero_ps();
+            }
+            Transpose8x8(rows);
+            for (uint32_t c = 0; c < kBlock; c++) {
+                StoreVector(dst + (j + c) * num_group + i, rows[c]);
+            }
+        }
+    }
+#endif
+    QuantizeColumns(dst, src, 0, vector_frames, vector_elements, num_vector_elements,
+                    num_frames, num_group, num_vector_elements, scale_factor);
+    QuantizeColumns(dst, src, vector_frames, num_group, 0, num_vector_elements,
+                    num_frames, num_group, num_vector_elements, scale_factor);
+    // pad to meet weight matrix row length requirement
+    if (num_vector_stride > num_vector_elements) {
+        std::memset(dst + num_vector_elements * num_group, 0,
+                    (num_vector_stride - num_vector_elements) * num_group * sizeof(T));
+    }
+}
+
+template <typename T>
+void QuantizeFrames(T* dst, const float* src,
+                    uint32_t num_frames, uint32_t num_group,
+                    uint32_t num_vector_elements, uint32_t num_vector_stride,
+                    float scale_factor) {
+#if defined(HAVE_AVX512F)
+    const __m512 wide_scale = _mm512_set1_ps(scale_factor);
+#endif
+#if defined(HAVE_AVX2)
+    const __m256 scale = _mm256_set1_ps(scale_factor);
+#endif
+    for (uint32_t i = 0; i < num_frames; i++) {
+        T* dst_vec = dst + i * num_vector_stride;
+        const float* src_vec = src + i * num_vector_elements;
+        uint32_t j = 0;
+#if defined(HAVE_AVX512F)
+        for (; j + kWideBlock <= num_vector_elements; j += kWideBlock) {
+            StoreVector(dst_vec + j, QuantizeVector<T>(_mm512_loadu_ps(src_vec + j), wide_scale));
+        }
+#endif
+#if defined(HAVE_AVX2)
+        for (; j + kBlock <= num_vector_elements; j += kBlock) {
+            StoreVector(dst_vec + j, QuantizeVector<T>(_mm256_loadu_ps(src_vec + j), scale));
+        }
+#endif
+        for (; j < num_vector_elements; j++) {
+            dst_vec[j] = Quantize<T>(src_vec[j], scale_factor);
+        }
+        if (num_vector_stride > num_vector_elements) {
+            std::memset(dst_vec + num_vector_elements, 0, (num_vector_stride - num_vector_elements) * sizeof(T));
+        }
+    }
+    // pad partial group
+    if (num_group > num_frames) {
+        std::memset(dst + num_frames * num_vector_stride, 0, (num_group - num_frames) * num_vector_stride * sizeof(T));
+    }
+}
+
+template <typename T>
+void QuantizeTyped(T* dst, const float* src,
+                   uint32_t num_frames, uint32_t num_group,
+                   uint32_t num_vector_elements, uint32_t num_vector_stride,
+                   bool interleaved, float scale_factor) {
+    if (interleaved) {
+        QuantizeInterleaved(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, scale_factor);
+    } else {
+        QuantizeFrames(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, scale_factor);
+    }
+}
+
+}  // namespace
+
+void QuantizeInput(void* dst,
+                   const float* src,
+                   uint32_t num_frames,
+                   uint32_t num_group,
+                   uint32_t num_vector_elements,
+                   uint32_t num_vector_stride,
+                   bool interleaved,
+                   bool low_precision,
+                   float scale_factor) {
+    if (!dst || !src) {
+        return;
+    }
+    if (low_precision) {
+        QuantizeTyped(reinterpret_cast<int8_t*>(dst), src, num_frames, num_group, num_vector_elements,
+                      num_vector_stride, interleaved, scale_factor);
+    } else {
+        QuantizeTyped(reinterpret_cast<int16_t*>(dst), src, num_frames, num_group, num_vector_elements,
+                      num_vector_stride, interleaved, scale_factor);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
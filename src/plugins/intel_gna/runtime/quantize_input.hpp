@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+/**
+ * @brief Scales, rounds and saturates the float input frames to int16 (int8 for the low precision) GNA input
+ * @details Every frame is padded with zeros from num_vector_elements up to num_vector_stride and the frames from
+ * num_frames up to num_group are zeroed. For the interleaved orientation the frames are stored as the columns
+ * of the destination, i.e. the element j of the frame i goes to dst[j * num_group + i].
+ */
+void QuantizeInput(void* dst,
+                   const float* src,
+                   uint32_t num_frames,
+                   uint32_t num_group,
+                   uint32_t num_vector_elements,
+                   uint32_t num_vector_stride,
+                   bool interleaved,
+                   bool low_precision,
+                   float scale_factor);
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -496,6 +496,70 @@ TEST_P(CachingTest, TestLoad) {
     }
 }
 
+TEST_P(CachingTest, TestLoadAsyncExport) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            EXPECT_CALL(net, Export(_)).Times(1);
+        });
+        // Core waits for the background export on destruction
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}, {CONFIG_KEY(CACHE_ASYNC_EXPORT), CONFIG_VALUE(YES)}});
+            m_testFunction(ie);
+        });
+        EXPECT_EQ(networks.size(), 1);
+    }
+
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(!m_remoteContext ? 1 : 0);
+        for (auto& net : networks) {
+            EXPECT_CALL(*net, Export(_)).Times(0); // No more 'Export' for existing networks
+        }
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}, {CONFIG_KEY(CACHE_ASYNC_EXPORT), CONFIG_VALUE(YES)}});
+            m_testFunction(ie);
+        });
+        EXPECT_EQ(networks.size(), 1);
+    }
+}
+
+TEST_P(CachingTest, TestCacheMaxSizeWrongValue) {
+    Core ie;
+    ASSERT_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}, {CONFIG_KEY(CACHE_MAX_SIZE), "-size"}}), Exception);
+    ASSERT_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_ASYNC_EXPORT), "ON"}}), Exception);
+}
+
+TEST_P(CachingTest, TestShareCompiledModels) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    // networks loaded with remote context are not shared
+    const uint64_t sharedLoads = m_remoteContext ? 0 : 1;
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 2 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(SHARE_COMPILED_MODELS), CONFIG_VALUE(YES)}});
+            auto first = m_testFunction(ie);
+            auto second = m_testFunction(ie);
+            EXPECT_EQ(ie.GetMetric("", METRIC_KEY(SHARED_COMPILED_MODELS_HITS)).as<uint64_t>(), sharedLoads);
+        });
+    }
+}
+
 TEST_P(CachingTest, TestLoadCustomImportExport) {
     const char customData[] = {1, 2, 3, 4, 5};
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
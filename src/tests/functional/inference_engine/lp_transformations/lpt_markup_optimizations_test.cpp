@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include <low_precision/align_quantization_intervals.hpp>
+#include <low_precision/align_quantization_parameters.hpp>
+#include <low_precision/low_precision.hpp>
+#include <low_precision/markup_avg_pool_precision_preserved.hpp>
+#include <low_precision/markup_can_be_quantized.hpp>
+#include <low_precision/markup_per_tensor_quantization.hpp>
+#include <low_precision/markup_precisions.hpp>
+#include <low_precision/propagate_precisions.hpp>
+#include <low_precision/rt_info/precisions_attribute.hpp>
+
+#include "lpt_ngraph_functions/common/builders.hpp"
+#include "lpt_ngraph_functions/common/fake_quantize_on_data.hpp"
+#include "lpt_ngraph_functions/common/fake_quantize_on_weights.hpp"
+
+using namespace testing;
+using namespace ngraph;
+using namespace ngraph::pass::low_precision;
+
+namespace {
+
+// Convolution chain with a concatenation and a pooling: each markup pass has something to mark
+std::shared_ptr<Function> createQuantizedModel(const size_t depth) {
+    const builder::subgraph::FakeQuantizeOnData fqOnData(256ul, Shape{}, {0.f}, {2.55f}, {0.f}, {2.55f});
+    const builder::subgraph::FakeQuantizeOnWeights fqOnWeights(255ul, Shape{}, {-1.27f}, {1.27f}, {-1.27f}, {1.27f});
+
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 8, 32, 32});
+    Output<Node> parent = input;
+    for (size_t i = 0; i < depth; ++i) {
+        const auto fqOnActivations = builder::subgraph::makeFakeQuantize(parent, element::f32, fqOnData);
+        const auto weights = opset1::Constant::create(element::f32, Shape{8, 8, 1, 1}, std::vector<float>(64, 1.f));
+        const auto fqOnWeightsOp = builder::subgraph::makeFakeQuantize(weights, element::f32, fqOnWeights);
+        const auto convolution = std::make_shared<opset1::Convolution>(
+            fqOnActivations,
+            fqOnWeightsOp,
+            Strides{1, 1},
+            CoordinateDiff{0, 0},
+            CoordinateDiff{0, 0},
+            Strides{1, 1});
+        const auto avgPool = std::make_shared<opset1::AvgPool>(
+            convolution,
+            Strides{1, 1},
+            Shape{0, 0},
+            Shape{0, 0},
+            Shape{1, 1},
+            true,
+            op::RoundingType::FLOOR);
+        const auto branch1 = builder::subgraph::makeFakeQuantize(avgPool, element::f32, fqOnData);
+        const auto branch2 = builder::subgraph::makeFakeQuantize(convolution, element::f32, fqOnData);
+        const auto concat = std::make_shared<opset1::Concat>(OutputVector{branch1, branch2}, 1);
+        const auto split = std::make_shared<opset1::VariadicSplit>(
+            concat,
+            opset1::Constant::create(element::i64, Shape{}, {1}),
+            opset1::Constant::create(element::i64, Shape{2}, {8, 8}));
+        parent = split->output(0);
+    }
+
+    const auto result = std::make_shared<opset1::Result>(parent);
+    return std::make_shared<Function>(ResultVector{result}, ParameterVector{input}, "QuantizedModel");
+}
+
+const std::vector<OperationPrecisionRestriction> precisionRestrictions = {
+    OperationPrecisionRestriction::create<opset1::Convolution>({{0, {element::u8}}, {1, {element::i8}}}),
+    OperationPrecisionRestriction::create<opset1::AvgPool>({{0, {element::u8}}}),
+};
+
+const std::vector<OperationPerTensorQuantizationRestriction> quantizationRestrictions = {
+    OperationPerTensorQuantizationRestriction::create<opset1::Convolution>({0})
+};
+
+std::string rtInfoToString(const ov::RTMap& rt) {
+    std::ostringstream stream;
+    for (const auto& item : rt) {
+        stream << item.first << ";";
+        if (item.second.is<PrecisionsAttribute>()) {
+            for (const auto& precision : item.second.as<PrecisionsAttribute>().value()) {
+                stream << precision << ",";
+            }
+        }
+    }
+    return stream.str();
+}
+
+}  // namespace
+
+TEST(LPT, MarkupOptimizationsIsEqualToSequentialMarkup) {
+    const auto expected = createQuantizedModel(3);
+    {
+        pass::Manager manager;
+        manager.register_pass<MarkupCanBeQuantized>();
+        manager.register_pass<MarkupPrecisions>(precisionRestrictions);
+        manager.register_pass<MarkupPerTensorQuantization>(quantizationRestrictions);
+        manager.register_pass<MarkupAvgPoolPrecisionPreserved>();
+        manager.register_pass<PropagatePrecisions>();
+        manager.register_pass<AlignQuantizationIntervals>();
+        manager.register_pass<AlignQuantizationParameters>();
+        manager.run_passes(expected);
+    }
+
+    const auto actual = createQuantizedModel(3);
+    {
+        pass::Manager manager;
+        manager.register_pass<MarkupOptimizations>(precisionRestrictions, quantizationRestrictions);
+        manager.run_passes(actual);
+    }
+
+    const auto expectedOps = expected->get_ordered_ops();
+    const auto actualOps = actual->get_ordered_ops();
+    ASSERT_EQ(expectedOps.size(), actualOps.size());
+    for (size_t i = 0; i < expectedOps.size(); ++i) {
+        ASSERT_EQ(expectedOps[i]->get_type_info(), actualOps[i]->get_type_info());
+        ASSERT_EQ(rtInfoToString(expectedOps[i]->get_rt_info()), rtInfoToString(actualOps[i]->get_rt_info()))
+            << expectedOps[i]->get_friendly_name();
+        for (size_t port = 0; port < expectedOps[i]->get_input_size(); ++port) {
+            ASSERT_EQ(rtInfoToString(expectedOps[i]->input(port).get_rt_info()),
+                      rtInfoToString(actualOps[i]->input(port).get_rt_info()))
+                << expectedOps[i]->get_friendly_name() << ":" << port;
+        }
+    }
+}
@@ -6,6 +6,7 @@
 
 #include <cpp/ie_infer_request.hpp>
 #include <openvino/core/except.hpp>
+#include <openvino/runtime/completion_queue.hpp>
 #include <openvino/runtime/infer_request.hpp>
 #include <openvino/runtime/remote_tensor.hpp>
 #include <openvino/runtime/compiled_model.hpp>
@@ -56,6 +57,23 @@ TEST(InferRequestOVTests, throwsOnUninitializedSetCompletionCallback) {
     ASSERT_THROW(req.set_callback(f), ov::Exception);
 }
 
+TEST(InferRequestOVTests, throwsOnUninitializedBindToCompletionQueue) {
+    ov::InferRequest req;
+    ov::CompletionQueue queue;
+    ASSERT_THROW(queue.bind(req, nullptr), ov::Exception);
+}
+
+TEST(InferRequestOVTests, completionQueueIsEmptyWithoutRequests) {
+    ov::CompletionQueue queue;
+    ov::CompletionQueue::Completion completion;
+    std::vector<ov::CompletionQueue::Completion> completions;
+    ASSERT_EQ(0, queue.size());
+    ASSERT_EQ(0, queue.poll(completions, 1));
+    ASSERT_FALSE(queue.wait_any_for(completion, std::chrono::milliseconds{0}));
+    queue.shutdown();
+    ASSERT_FALSE(queue.wait_any(completion));
+}
+
 TEST(InferRequestOVTests, throwsOnUninitializedQueryState) {
     ov::InferRequest req;
     ASSERT_THROW(req.query_state(), ov::Exception);
@@ -11,6 +11,7 @@
 #include <ngraph/pass/visualize_tree.hpp>
 #include <ngraph/function.hpp>
 #include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset6.hpp>
 #include <pruning.hpp>
 #include <mask_attribute.hpp>
 #include <transformations/init_node_info.hpp>
@@ -1496,3 +1497,303 @@ TEST(TransformationTests, PruneStopReduceLayerDown) {
     compare_masks(*getMask(weights_end_conv.get_node_shared_ptr()->output(0)),  Mask({{}, {}, {}, {}}));
     compare_masks(*getMask(end_conv->output(0)),  Mask({{}, {}, {}, {}}));
 }
+
+
+TEST_F(TransformationTestsF, PruneFullyConnectedNeurons) {
+    Shape input_shape{1, 3, 6};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+
+    auto weights1 = create_constant_with_zeros({6, 10}, {{}, {2, 5}});
+    auto fc1 = std::make_shared<opset5::MatMul>(input, weights1);
+    auto bias1 = create_constant_with_zeros({10}, {{2, 5}});
+    auto add1 = std::make_shared<opset5::Add>(fc1, bias1);
+    auto relu = std::make_shared<opset5::Relu>(add1);
+
+    // Output neuron 1 of fc2 is zero, but it can't be pruned because of the residual connection
+    auto weights2 = create_constant_with_zeros({10, 6}, {{}, {1}});
+    auto fc2 = std::make_shared<opset5::MatMul>(relu, weights2);
+    auto residual = std::make_shared<opset5::Add>(fc2, input);
+    auto mvn = std::make_shared<opset6::MVN>(residual, opset6::Constant::create(element::i64, Shape{1}, {2}),
+                                             true, 1e-5, op::MVNEpsMode::INSIDE_SQRT);
+    function = std::make_shared<Function>(NodeVector{mvn}, ParameterVector{input});
+
+    {
+        auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+
+        auto weights1 = opset5::Constant::create(element::f32, {6, 8}, {1});
+        auto fc1 = std::make_shared<opset5::MatMul>(input, weights1);
+        auto bias1 = opset5::Constant::create(element::f32, {8}, {1});
+        auto add1 = std::make_shared<opset5::Add>(fc1, bias1);
+        auto relu = std::make_shared<opset5::Relu>(add1);
+
+        std::vector<float> weights2_values(8 * 6, 1);
+        for (size_t i = 0; i < 8; ++i)
+            weights2_values[i * 6 + 1] = 0;
+        auto weights2 = opset5::Constant::create(element::f32, {8, 6}, weights2_values);
+        auto fc2 = std::make_shared<opset5::MatMul>(relu, weights2);
+        auto residual = std::make_shared<opset5::Add>(fc2, input);
+        auto mvn = std::make_shared<opset6::MVN>(residual, opset6::Constant::create(element::i64, Shape{1}, {2}),
+                                                 true, 1e-5, op::MVNEpsMode::INSIDE_SQRT);
+        function_ref = std::make_shared<Function>(NodeVector{mvn}, ParameterVector{input});
+    }
+    if (VISUALIZE_TESTS_TREE)
+        ngraph::pass::VisualizeTree(std::string(VISUALIZE_TREE_ROOT) + "PruneFullyConnectedNeurons.svg").run_on_function(function);
+    {
+        pass::Manager m;
+        m.register_pass<pass::InitMasks>();
+        m.register_pass<pass::PropagateMasks>();
+        m.run_passes(function);
+    }
+    compare_masks(*getMask(weights1.get_node_shared_ptr()->output(0)), Mask({{}, {2, 5}}));
+    compare_masks(*getMask(fc1->output(0)), Mask({{}, {}, {2, 5}}));
+    compare_masks(*getMask(bias1.get_node_shared_ptr()->output(0)), Mask({{2, 5}}));
+    compare_masks(*getMask(relu->output(0)), Mask({{}, {}, {2, 5}}));
+    compare_masks(*getMask(weights2.get_node_shared_ptr()->output(0)), Mask({{2, 5}, {}}));
+    compare_masks(*getMask(fc2->output(0)), Mask({{}, {}, {}}));
+    compare_masks(*getMask(mvn->output(0)), Mask({{}, {}, {}}));
+    {
+        pass::Manager m;
+        m.register_pass<pass::ShrinkWeights>();
+        m.run_passes(function);
+    }
+    disable_rt_info_check();
+    enable_accuracy_check();
+}
+
+
+namespace {
+
+// Multi-head self-attention block with hidden size 4: 2 heads of size 2
+std::shared_ptr<Function> create_attention(const Output<Node> & weights_q, const Output<Node> & weights_k,
+                                           const Output<Node> & weights_v, const Output<Node> & weights_out,
+                                           size_t heads) {
+    const int64_t seq_len = 3;
+    const int64_t head_size = 2;
+    const auto heads_count = static_cast<int64_t>(heads);
+    auto input = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 3, 4});
+
+    auto split_heads = [&](const Output<Node> & weights, const std::vector<int64_t> & order) {
+        auto fc = std::make_shared<opset5::MatMul>(input, weights);
+        auto reshape = std::make_shared<opset5::Reshape>(fc,
+            opset5::Constant::create(element::i64, Shape{4}, std::vector<int64_t>{1, seq_len, heads_count, head_size}), true);
+        return std::make_shared<opset5::Transpose>(reshape, opset5::Constant::create(element::i64, Shape{4}, order));
+    };
+    auto query = split_heads(weights_q, {0, 2, 1, 3});
+    auto key = split_heads(weights_k, {0, 2, 3, 1});
+    auto value = split_heads(weights_v, {0, 2, 1, 3});
+
+    auto scores = std::make_shared<opset5::MatMul>(query, key);
+    auto softmax = std::make_shared<opset5::Softmax>(scores, 3);
+    auto context = std::make_shared<opset5::MatMul>(softmax, value);
+    auto transpose = std::make_shared<opset5::Transpose>(context,
+        opset5::Constant::create(element::i64, Shape{4}, {0, 2, 1, 3}));
+    auto reshape = std::make_shared<opset5::Reshape>(transpose,
+        opset5::Constant::create(element::i64, Shape{3}, std::vector<int64_t>{1, seq_len, heads_count * head_size}), true);
+    auto fc_out = std::make_shared<opset5::MatMul>(reshape, weights_out);
+    return std::make_shared<Function>(NodeVector{fc_out}, ParameterVector{input});
+}
+
+}  // namespace
+
+TEST_F(TransformationTestsF, PruneAttentionHeads) {
+    // Head 1 is zero in query, key and value weights. Query neuron 0 is zero too,
+    // but it's not a whole head, so it is kept.
+    auto weights_q = create_constant_with_zeros({4, 4}, {{}, {0, 2, 3}});
+    auto weights_k = create_constant_with_zeros({4, 4}, {{}, {2, 3}});
+    auto weights_v = create_constant_with_zeros({4, 4}, {{}, {2, 3}});
+    auto weights_out = opset5::Constant::create(element::f32, {4, 4}, {1});
+    function = create_attention(weights_q, weights_k, weights_v, weights_out, 2);
+
+    {
+        std::vector<float> weights_q_values(4 * 2, 1);
+        for (size_t i = 0; i < 4; ++i)
+            weights_q_values[i * 2] = 0;
+        function_ref = create_attention(opset5::Constant::create(element::f32, {4, 2}, weights_q_values),
+                                        opset5::Constant::create(element::f32, {4, 2}, {1}),
+                                        opset5::Constant::create(element::f32, {4, 2}, {1}),
+                                        opset5::Constant::create(element::f32, {2, 4}, {1}),
+                                        1);
+    }
+    if (VISUALIZE_TESTS_TREE)
+        ngraph::pass::VisualizeTree(std::string(VISUALIZE_TREE_ROOT) + "PruneAttentionHeads.svg").run_on_function(function);
+    {
+        pass::Manager m;
+        m.register_pass<pass::InitMasks>();
+        m.register_pass<pass::PropagateMasks>();
+        m.run_passes(function);
+    }
+    compare_masks(*getMask(weights_q.get_node_shared_ptr()->output(0)), Mask({{}, {2, 3}}));
+    compare_masks(*getMask(weights_k.get_node_shared_ptr()->output(0)), Mask({{}, {2, 3}}));
+    compare_masks(*getMask(weights_v.get_node_shared_ptr()->output(0)), Mask({{}, {2, 3}}));
+    compare_masks(*getMask(weights_out->output(0)), Mask({{2, 3}, {}}));
+    {
+        pass::Manager m;
+        m.register_pass<pass::ShrinkWeights>();
+        m.run_passes(function);
+    }
+    disable_rt_info_check();
+    enable_accuracy_check();
+}
+
+
+TEST(TransformationTests, PruneAttentionPartialHeads) {
+    // Heads are zero in different projections, so no head can be pruned
+    auto weights_q = create_constant_with_zeros({4, 4}, {{}, {2, 3}});
+    auto weights_k = create_constant_with_zeros({4, 4}, {{}, {0, 1}});
+    auto weights_v = create_constant_with_zeros({4, 4}, {{}, {2, 3}});
+    auto weights_out = opset5::Constant::create(element::f32, {4, 4}, {1});
+    auto function = create_attention(weights_q, weights_k, weights_v, weights_out, 2);
+
+    if (VISUALIZE_TESTS_TREE)
+        ngraph::pass::VisualizeTree(std::string(VISUALIZE_TREE_ROOT) + "PruneAttentionPartialHeads.svg").run_on_function(function);
+
+    pass::Manager m;
+    m.register_pass<pass::Pruning>();
+    m.run_passes(function);
+
+    compare_masks(*getMask(weights_q.get_node_shared_ptr()->output(0)), Mask({{}, {}}));
+    compare_masks(*getMask(weights_k.get_node_shared_ptr()->output(0)), Mask({{}, {}}));
+    compare_masks(*getMask(weights_v.get_node_shared_ptr()->output(0)), Mask({{}, {}}));
+    compare_masks(*getMask(weights_out->output(0)), Mask({{}, {}}));
+}
+
+
+namespace {
+
+// Convolution with zero filters 1, 2, 3 -> Elementwise with the second network input -> Convolution
+std::shared_ptr<Function> create_conv_eltwise_network_input(const Shape & second_input_shape, bool multiply,
+                                                             Output<Node> & weights, std::shared_ptr<Node> & conv,
+                                                             std::shared_ptr<Node> & eltwise,
+                                                             std::shared_ptr<Node> & weights2,
+                                                             std::shared_ptr<Node> & conv2) {
+    auto input = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 3, 64, 64});
+    auto second_input = std::make_shared<opset5::Parameter>(element::f32, second_input_shape);
+    weights = create_constant_with_zeros({6, 3, 3, 3}, {{1, 2, 3}, {}, {}, {}});
+    conv = std::make_shared<opset5::Convolution>(input, weights, Strides(2, 1),
+                                                 CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    if (multiply) {
+        eltwise = std::make_shared<opset5::Multiply>(conv, second_input);
+    } else {
+        eltwise = std::make_shared<opset5::Add>(conv, second_input);
+    }
+    weights2 = opset5::Constant::create(element::f32, {6, 6, 3, 3}, {1.});
+    conv2 = std::make_shared<opset5::Convolution>(eltwise, weights2, Strides(2, 1),
+                                                  CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    return std::make_shared<Function>(NodeVector{conv2}, ParameterVector{input, second_input});
+}
+
+}  // namespace
+
+TEST(TransformationTests, PropagateMasksAddNetworkInput) {
+    // Residual connection from the network input can't be pruned
+    Output<Node> weights;
+    std::shared_ptr<Node> conv, add, weights2, conv2;
+    auto f = create_conv_eltwise_network_input({1, 6, 62, 62}, false, weights, conv, add, weights2, conv2);
+
+    if (VISUALIZE_TESTS_TREE)
+        ngraph::pass::VisualizeTree(std::string(VISUALIZE_TREE_ROOT) + "PropagateMasksAddNetworkInput.svg").run_on_function(f);
+
+    pass::Manager m;
+    m.register_pass<pass::InitMasks>();
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(conv->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(add->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(weights2->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(conv2->output(0)), Mask({{}, {}, {}, {}}));
+}
+
+
+TEST(TransformationTests, PropagateMasksAddBroadcastedNetworkInput) {
+    // Zero channels of Convolution become equal to the broadcasted input after Add, so they can't be pruned
+    Output<Node> weights;
+    std::shared_ptr<Node> conv, add, weights2, conv2;
+    auto f = create_conv_eltwise_network_input({1, 1, 62, 62}, false, weights, conv, add, weights2, conv2);
+
+    if (VISUALIZE_TESTS_TREE)
+        ngraph::pass::VisualizeTree(std::string(VISUALIZE_TREE_ROOT) + "PropagateMasksAddBroadcastedNetworkInput.svg").run_on_function(f);
+
+    pass::Manager m;
+    m.register_pass<pass::InitMasks>();
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(conv->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(add->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(weights2->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(conv2->output(0)), Mask({{}, {}, {}, {}}));
+}
+
+
+TEST(TransformationTests, PropagateMasksMultiplyBroadcastedNetworkInput) {
+    // Zero channels of Convolution stay zero after Multiply by the input broadcasted along the channels
+    Output<Node> weights;
+    std::shared_ptr<Node> conv, mul, weights2, conv2;
+    auto f = create_conv_eltwise_network_input({1, 1, 62, 62}, true, weights, conv, mul, weights2, conv2);
+
+    if (VISUALIZE_TESTS_TREE)
+        ngraph::pass::VisualizeTree(std::string(VISUALIZE_TREE_ROOT) + "PropagateMasksMultiplyBroadcastedNetworkInput.svg").run_on_function(f);
+
+    pass::Manager m;
+    m.register_pass<pass::InitMasks>();
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights), Mask({{1, 2, 3}, {}, {}, {}}));
+    compare_masks(*getMask(conv->output(0)), Mask({{}, {1, 2, 3}, {}, {}}));
+    compare_masks(*getMask(mul->output(0)), Mask({{}, {1, 2, 3}, {}, {}}));
+    compare_masks(*getMask(weights2->output(0)), Mask({{}, {1, 2, 3}, {}, {}}));
+    compare_masks(*getMask(conv2->output(0)), Mask({{}, {}, {}, {}}));
+}
+
+
+TEST(TransformationTests, PropagateMasksMultiplyNetworkInput) {
+    Output<Node> weights;
+    std::shared_ptr<Node> conv, mul, weights2, conv2;
+    auto f = create_conv_eltwise_network_input({1, 6, 62, 62}, true, weights, conv, mul, weights2, conv2);
+
+    if (VISUALIZE_TESTS_TREE)
+        ngraph::pass::VisualizeTree(std::string(VISUALIZE_TREE_ROOT) + "PropagateMasksMultiplyNetworkInput.svg").run_on_function(f);
+
+    pass::Manager m;
+    m.register_pass<pass::InitMasks>();
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(conv->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(mul->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(weights2->output(0)), Mask({{}, {}, {}, {}}));
+}
+
+
+TEST(TransformationTests, PropagateMasksAddLowRankConstant) {
+    // Constant of rank 1 has no channel dim to check on zeros, so the channels can't be pruned
+    Shape input_shape{1, 3, 64, 64};
+    auto input = std::make_shared<opset5::Parameter>(element::f32, input_shape);
+    auto weights = create_constant_with_zeros({6, 3, 3, 3}, {{1, 2, 3}, {}, {}, {}});
+    auto conv = std::make_shared<opset5::Convolution>(input, weights, Strides(2, 1),
+                                                      CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto add_const = opset5::Constant::create(element::f32, {62}, {1.});
+    auto add = std::make_shared<opset5::Add>(conv, add_const);
+    auto weights2 = opset5::Constant::create(element::f32, {6, 6, 3, 3}, {1.});
+    auto conv2 = std::make_shared<opset5::Convolution>(add, weights2, Strides(2, 1),
+                                                       CoordinateDiff(2, 0), CoordinateDiff(2, 0), Strides(2, 1));
+    auto f = std::make_shared<Function>(NodeVector{conv2}, ParameterVector{input});
+
+    if (VISUALIZE_TESTS_TREE)
+        ngraph::pass::VisualizeTree(std::string(VISUALIZE_TREE_ROOT) + "PropagateMasksAddLowRankConstant.svg").run_on_function(f);
+
+    pass::Manager m;
+    m.register_pass<pass::InitMasks>();
+    m.register_pass<pass::PropagateMasks>();
+    m.run_passes(f);
+
+    compare_masks(*getMask(weights), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(conv->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(add->output(0)), Mask({{}, {}, {}, {}}));
+    compare_masks(*getMask(weights2->output(0)), Mask({{}, {}, {}, {}}));
+}
@@ -0,0 +1,15 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "multi/multi_scheduling_tests.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+const std::vector<DevicesNames> device_names_for_scheduling {
+        {CPU}, // CPU via MULTI
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SchedulingMultiCPU, MultiDevice_Test,
+        ::testing::ValuesIn(device_names_for_scheduling), MultiDevice_Test::getTestCaseName);
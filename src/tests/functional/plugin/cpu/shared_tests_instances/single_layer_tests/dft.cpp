@@ -100,8 +100,34 @@ const auto testCase4D = ::testing::Combine(
     ::testing::Values(CommonTestUtils::DEVICE_CPU)
 );
 
+/* Lengths which are not powers of two: mixed radix (400 = 4 * 4 * 5 * 5, 60, 7) and Bluestein (97, 194) */
+
+const std::vector<std::vector<size_t>> inputShapesMixedRadix = {
+    {2, 400, 2},
+    {60, 97, 2},
+    {7, 194, 2},
+};
+
+const std::vector<std::vector<int64_t>> axesMixedRadix = {
+    {0}, {1}, {0, 1}
+};
+
+const std::vector<std::vector<int64_t>> signalSizesMixedRadix = {
+    {}
+};
+
+const auto testCaseMixedRadix = ::testing::Combine(
+    ::testing::ValuesIn(inputShapesMixedRadix),
+    ::testing::Values(InferenceEngine::Precision::FP32),
+    ::testing::ValuesIn(axesMixedRadix),
+    ::testing::ValuesIn(signalSizesMixedRadix),
+    ::testing::ValuesIn(opTypes),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
 
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_1d, DFTLayerTest, testCase1D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_2d, DFTLayerTest, testCase2D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_3d, DFTLayerTest, testCase3D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_4d, DFTLayerTest, testCase4D, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_MixedRadix, DFTLayerTest, testCaseMixedRadix, DFTLayerTest::getTestCaseName);
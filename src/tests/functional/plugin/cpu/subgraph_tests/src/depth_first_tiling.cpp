@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The intermediate tensors of the chain don't fit the cache (256 KB, pinned by the config, so the test doesn't depend
+ * on L2 cache of the host), so the chain is split into horizontal bands,
+ * which are computed depth-first and concatenated:
+
+       Input
+         |
+    Convolution
+         |
+        Relu
+         |
+      MaxPool
+         |
+    Convolution (dilated)
+         |
+    Add (per-channel)
+         |
+    Convolution (stride 2)
+         |
+       Output
+*/
+
+class DepthFirstTiling : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING] = PluginConfigParams::YES;
+        configuration[PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING_CACHE_SIZE] = std::to_string(256 * 1024);
+
+        auto params = builder::makeParams(element::f32, {{1, 16, 192, 192}});
+        auto conv1 = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<opset1::Relu>(conv1);
+        auto pool = std::make_shared<opset1::MaxPool>(relu, Strides{1, 1}, Shape{1, 1}, Shape{1, 1}, Shape{3, 3},
+                                                      op::RoundingType::FLOOR);
+        auto conv2 = builder::makeConvolution(pool, element::f32, {3, 3}, {1, 1}, {2, 2}, {2, 2}, {2, 2},
+                                              op::PadType::EXPLICIT, 16);
+        auto bias = builder::makeConstant<float>(element::f32, {1, 16, 1, 1}, {}, true);
+        auto add = std::make_shared<opset1::Add>(conv2, bias);
+        auto conv3 = builder::makeConvolution(add, element::f32, {3, 3}, {2, 2}, {1, 1}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, 16);
+        function = std::make_shared<Function>(NodeVector{conv3}, params, "DepthFirstTiling");
+    }
+
+    size_t countNodes(const std::string& type) {
+        size_t count = 0;
+        for (const auto& node : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            if (it != rtInfo.end() && it->second.as<std::string>() == type)
+                count++;
+        }
+        return count;
+    }
+};
+
+TEST_F(DepthFirstTiling, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // the bands of the chain are concatenated by the single node at the end of the chain
+    ASSERT_EQ(countNodes("Concatenation"), 1);
+    ASSERT_GT(countNodes("Convolution"), 3);
+}
+
+} // namespace SubgraphTestsDefinitions
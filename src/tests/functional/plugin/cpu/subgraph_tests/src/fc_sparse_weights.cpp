@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* MatMul with pruned constant weights. Input channels of the weights are zeroed with the given rate, so if the rate
+ * is not less than CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, FullyConnected node packs the weights into block-sparse format
+ * and the zero blocks are skipped during execution:
+
+    Input    Constant (pruned)
+        \       /
+         MatMul
+           |
+         Output
+*/
+
+using FCSparseWeightsParams = std::tuple<SizeVector,   // input shape
+                                         size_t,       // output channels
+                                         float,        // pruned input channels rate
+                                         std::string>; // sparse weights decompression rate
+
+class FCSparseWeights : public testing::WithParamInterface<FCSparseWeightsParams>,
+                        public CPUTestsBase,
+                        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCSparseWeightsParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels;
+        float prunedRate;
+        std::string decompressionRate;
+        std::tie(inputShape, outputChannels, prunedRate, decompressionRate) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outputChannels << "_";
+        result << "prunedRate=" << prunedRate << "_";
+        result << "decompressionRate=" << decompressionRate;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        SizeVector inputShape;
+        size_t outputChannels;
+        float prunedRate;
+        std::string decompressionRate;
+        std::tie(inputShape, outputChannels, prunedRate, decompressionRate) = this->GetParam();
+
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, decompressionRate});
+
+        const size_t K = inputShape.back();
+        auto params = builder::makeParams(element::f32, {inputShape});
+
+        auto weightsValues = CommonTestUtils::generate_float_numbers(outputChannels * K, -1.f, 1.f);
+        const size_t prunedChannels = static_cast<size_t>(prunedRate * K);
+        for (size_t k = 0; k < prunedChannels; k++) {
+            // spread pruned input channels over the whole K dimension
+            const size_t prunedK = k * K / prunedChannels;
+            for (size_t n = 0; n < outputChannels; n++)
+                weightsValues[n * K + prunedK] = 0.f;
+        }
+        auto weights = builder::makeConstant<float>(element::f32, {outputChannels, K}, weightsValues);
+
+        auto matMul = builder::makeMatMul(params[0], weights, false, true);
+        function = makeNgraphFunction(element::f32, params, matMul, "FCSparseWeights");
+
+        // every pruned input channel zeroes the whole [1 x 16] weights blocks column
+        expectSparseKernel = std::stof(decompressionRate) < 1.f &&
+                             static_cast<float>(prunedChannels) / K >= std::stof(decompressionRate);
+    }
+
+    void CheckSparseKernel() {
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, function);
+        size_t fcCount = 0;
+        for (const auto& node : function->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string& paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                return it->second.as<std::string>();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) != "FullyConnected")
+                continue;
+            fcCount++;
+            const auto primType = getExecValue(ExecGraphInfoSerialization::IMPL_TYPE);
+            ASSERT_EQ(expectSparseKernel, primType.find("sparse") != std::string::npos) << "primitive type: " << primType;
+        }
+        ASSERT_EQ(1, fcCount);
+    }
+
+    bool expectSparseKernel = false;
+};
+
+TEST_P(FCSparseWeights, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckSparseKernel();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCSparseWeights, FCSparseWeights,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 64}, SizeVector{5, 96}, SizeVector{2, 3, 128}, SizeVector{16, 256}),
+                                            ::testing::Values(70),
+                                            ::testing::Values(0.f, 0.5f, 0.9f),
+                                            ::testing::Values("0.5", "1")),
+                         FCSparseWeights::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
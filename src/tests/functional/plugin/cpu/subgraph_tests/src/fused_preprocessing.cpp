@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using ov::preprocess::ColorFormat;
+using ov::preprocess::ResizeAlgorithm;
+
+namespace SubgraphTestsDefinitions {
+
+/* The input preprocessing inserted by PrePostProcessor is fused into FusedPreprocessing node if CPU_PREPROCESSING_FUSION
+ * is enabled:
+
+    Y    UV / I420 / NHWC u8 image
+     \   /
+    ConvertColor (optional)
+       |
+    Transpose (NHWC -> NCHW)
+       |
+    Convert (f32)
+       |
+    Interpolate
+       |
+    Subtract (per-channel mean)
+       |
+    Divide (scale)
+       |
+    Convolution
+*/
+
+using FusedPreprocessingParams = std::tuple<ColorFormat,        // input color format, RGB means u8 NHWC image
+                                            ResizeAlgorithm>;
+
+class FusedPreprocessing : public testing::WithParamInterface<FusedPreprocessingParams>,
+                           public CPUTestsBase,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FusedPreprocessingParams> obj) {
+        ColorFormat colorFormat;
+        ResizeAlgorithm resizeAlgorithm;
+        std::tie(colorFormat, resizeAlgorithm) = obj.param;
+
+        std::ostringstream result;
+        result << "colorFormat=" << static_cast<int>(colorFormat) << "_";
+        result << "resize=" << (resizeAlgorithm == ResizeAlgorithm::RESIZE_LINEAR ? "linear" : "nearest");
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigInternalParams::KEY_CPU_PREPROCESSING_FUSION] = PluginConfigParams::YES;
+
+        ColorFormat colorFormat;
+        ResizeAlgorithm resizeAlgorithm;
+        std::tie(colorFormat, resizeAlgorithm) = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {{1, 3, 24, 32}});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 8);
+        function = std::make_shared<Function>(conv, params, "FusedPreprocessing");
+
+        ov::preprocess::PrePostProcessor p(function);
+        p.input().tensor().set_element_type(element::u8).set_spatial_static_shape(40, 60);
+        if (colorFormat == ColorFormat::RGB) {
+            p.input().tensor().set_layout("NHWC");
+        } else {
+            p.input().tensor().set_color_format(colorFormat);
+            p.input().preprocess().convert_color(ColorFormat::BGR);
+        }
+        p.input().preprocess()
+            .convert_layout()
+            .convert_element_type(element::f32)
+            .resize(resizeAlgorithm)
+            .mean({123.675f, 116.28f, 103.53f})
+            .scale(255.f);
+        p.input().model().set_layout("NCHW");
+        function = p.build();
+
+        // the rounding of the color conversion may differ by one
+        threshold = 0.01f;
+    }
+
+    Blob::Ptr GenerateInput(const InputInfo &info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 255, 0);
+    }
+};
+
+TEST_P(FusedPreprocessing, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FusedPreprocessing", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Interpolate", 0);
+    CheckNodeOfTypeCount(executableNetwork, "ColorConvert", 0);
+}
+
+TEST_P(FusedPreprocessing, NotFusedByDefault) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.erase(PluginConfigInternalParams::KEY_CPU_PREPROCESSING_FUSION);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FusedPreprocessing", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FusedPreprocessing, FusedPreprocessing,
+                         ::testing::Combine(::testing::Values(ColorFormat::RGB,
+                                                              ColorFormat::NV12_TWO_PLANES,
+                                                              ColorFormat::NV12_SINGLE_PLANE,
+                                                              ColorFormat::I420_THREE_PLANES),
+                                            ::testing::Values(ResizeAlgorithm::RESIZE_LINEAR,
+                                                              ResizeAlgorithm::RESIZE_NEAREST)),
+                         FusedPreprocessing::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
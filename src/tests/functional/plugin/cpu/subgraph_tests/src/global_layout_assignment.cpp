@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* MVN supports planar and blocked layouts by the same kernel, the node by node selection gives it the planar layout of
+ * the input, so both convolutions (32 input channels, executed only with nspc or blocked input by jit kernels) read
+ * their inputs through reorders. With the global layout assignment MVN takes the layout of its children and the only
+ * reorder is on its input:
+
+         Input
+           |
+          MVN
+         /    \
+  Convolution  Convolution
+       |            |
+     Output       Output
+*/
+
+class GlobalLayoutAssignment : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = builder::makeParams(element::f32, {{1, 32, 16, 16}});
+        auto mvn = builder::makeMVN(params[0], false, true, 1e-9);
+        auto conv1 = builder::makeConvolution(mvn, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 32);
+        auto conv2 = builder::makeConvolution(mvn, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, 32);
+        function = std::make_shared<Function>(NodeVector{conv1, conv2}, params, "GlobalLayoutAssignment");
+    }
+
+    struct Reorders {
+        size_t count;
+        uint64_t bytes;
+    };
+
+    Reorders getReorders(const std::string& globalLayoutAssignment) {
+        auto config = configuration;
+        config[PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT] = globalLayoutAssignment;
+        auto execNet = core->LoadNetwork(InferenceEngine::CNNNetwork{function}, targetDevice, config);
+        Reorders reorders{0, execNet.GetMetric(PluginConfigInternalParams::METRIC_CPU_REORDER_BYTES).as<uint64_t>()};
+        for (const auto& node : execNet.GetExecGraphInfo().getFunction()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            if (it != rtInfo.end() && it->second.as<std::string>() == "Reorder")
+                reorders.count++;
+        }
+        return reorders;
+    }
+};
+
+TEST_F(GlobalLayoutAssignment, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration[PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT] = PluginConfigParams::YES;
+    Run();
+}
+
+TEST_F(GlobalLayoutAssignment, LessReorders) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the blocked layouts need jit kernels of MVN
+    if (!InferenceEngine::with_cpu_x86_sse42())
+        GTEST_SKIP();
+
+    const auto nodeByNode = getReorders(PluginConfigParams::NO);
+    const auto global = getReorders(PluginConfigParams::YES);
+    // the reorders of MVN input to both convolutions are replaced by the single reorder of the MVN input
+    ASSERT_EQ(global.count + 1, nodeByNode.count);
+    ASSERT_LT(global.bytes, nodeByNode.bytes);
+}
+
+} // namespace SubgraphTestsDefinitions
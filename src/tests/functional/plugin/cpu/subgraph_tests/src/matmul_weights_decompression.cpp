@@ -0,0 +1,192 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/single_layer/activation.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* Weights-only compressed MatMul. The decompression subgraph on the weights path is fused into FullyConnected node,
+ * so the compressed weights are kept in memory and decompressed on the fly:
+
+        Constant (u8/i8)
+            |
+         Convert      Constant
+            |           /
+      Subtract (optional)   Constant
+                 \          /
+                   Multiply
+                      |
+    Input      Reshape (group-wise only)
+        \       /
+         MatMul
+           |
+         Output
+*/
+
+std::shared_ptr<Node> makeDecompressedWeights(size_t K, size_t outputChannels, size_t groups, ngraph::element::Type weightsPrecision,
+                                              bool transposeWeights, bool withZeroPoints) {
+    SizeVector weightsShape = groups > 1 ? SizeVector{outputChannels, groups, K / groups} :
+                              transposeWeights ? SizeVector{outputChannels, K} : SizeVector{K, outputChannels};
+    SizeVector decompressionShape = groups > 1 ? SizeVector{outputChannels, groups, 1} :
+                                    transposeWeights ? SizeVector{outputChannels, 1} : SizeVector{1, outputChannels};
+
+    auto weights = builder::makeConstant<int8_t>(weightsPrecision, weightsShape, {}, true, 7, 0);
+    std::shared_ptr<Node> decompression = std::make_shared<opset1::Convert>(weights, element::f32);
+    if (withZeroPoints) {
+        auto zeroPoints = builder::makeConstant<float>(element::f32, decompressionShape, {}, true, 4, 1);
+        decompression = std::make_shared<opset1::Subtract>(decompression, zeroPoints);
+    }
+    auto scales = builder::makeConstant<float>(element::f32, decompressionShape, {}, true, 0.5, 0.1);
+    decompression = std::make_shared<opset1::Multiply>(decompression, scales);
+    if (groups > 1) {
+        auto targetShape = opset1::Constant::create(element::i64, Shape{2}, {outputChannels, K});
+        decompression = std::make_shared<opset1::Reshape>(decompression, targetShape, false);
+    }
+    return decompression;
+}
+
+using MatMulWeightsDecompressionParams = std::tuple<SizeVector,           // input shape
+                                                    size_t,               // output channels
+                                                    size_t,               // decompression groups
+                                                    ngraph::element::Type, // compressed weights precision
+                                                    bool,                 // transpose weights
+                                                    bool>;                // with zero points
+
+class MatMulWeightsDecompression : public testing::WithParamInterface<MatMulWeightsDecompressionParams>,
+                                   public CPUTestsBase,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulWeightsDecompressionParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels, groups;
+        ngraph::element::Type weightsPrecision;
+        bool transposeWeights, withZeroPoints;
+        std::tie(inputShape, outputChannels, groups, weightsPrecision, transposeWeights, withZeroPoints) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outputChannels << "_";
+        result << "groups=" << groups << "_";
+        result << "weiPRC=" << weightsPrecision << "_";
+        result << "transposeWeights=" << transposeWeights << "_";
+        result << "withZP=" << withZeroPoints;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        SizeVector inputShape;
+        size_t outputChannels, groups;
+        ngraph::element::Type weightsPrecision;
+        bool transposeWeights, withZeroPoints;
+        std::tie(inputShape, outputChannels, groups, weightsPrecision, transposeWeights, withZeroPoints) = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto decompression = makeDecompressedWeights(inputShape.back(), outputChannels, groups, weightsPrecision,
+                                                     transposeWeights, withZeroPoints);
+        auto matMul = builder::makeMatMul(params[0], decompression, false, transposeWeights || groups > 1);
+        function = makeNgraphFunction(element::f32, params, matMul, "MatMulWeightsDecompression");
+    }
+};
+
+TEST_P(MatMulWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+/* The activation after MatMul is fused into FullyConnected and applied by the decompression kernel to the output tile:
+
+    Input   Decompressed weights
+        \       /
+         MatMul
+           |
+       Activation
+           |
+         Output
+*/
+using MatMulWeightsDecompressionActivationParams = std::tuple<ngraph::helpers::ActivationTypes, // activation after MatMul
+                                                              size_t>;                          // decompression groups
+
+class MatMulWeightsDecompressionActivation : public testing::WithParamInterface<MatMulWeightsDecompressionActivationParams>,
+                                             public CPUTestsBase,
+                                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulWeightsDecompressionActivationParams> obj) {
+        ngraph::helpers::ActivationTypes activation;
+        size_t groups;
+        std::tie(activation, groups) = obj.param;
+
+        std::ostringstream result;
+        result << "activation=" << LayerTestsDefinitions::activationNames[activation] << "_";
+        result << "groups=" << groups;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        ngraph::helpers::ActivationTypes activation;
+        size_t groups;
+        std::tie(activation, groups) = this->GetParam();
+
+        const SizeVector inputShape{2, 256};
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto decompression = makeDecompressedWeights(inputShape.back(), 96, groups, element::u8, true, true);
+        auto matMul = builder::makeMatMul(params[0], decompression, false, true);
+        auto result = builder::makeActivation(matMul, element::f32, activation);
+        function = makeNgraphFunction(element::f32, params, result, "MatMulWeightsDecompressionActivation");
+    }
+};
+
+TEST_P(MatMulWeightsDecompressionActivation, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_perChannel, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 64}, SizeVector{2, 5, 96}),
+                                            ::testing::Values(70),
+                                            ::testing::Values(1),
+                                            ::testing::Values(element::u8, element::i8),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true, false)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_groupWise, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 512}, SizeVector{3, 1, 512}),
+                                            ::testing::Values(128),
+                                            ::testing::Values(4, 8),
+                                            ::testing::Values(element::u8),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true, false)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_activation, MatMulWeightsDecompressionActivation,
+                         ::testing::Combine(::testing::Values(ngraph::helpers::Relu, ngraph::helpers::Sigmoid,
+                                                              ngraph::helpers::Gelu, ngraph::helpers::Tanh),
+                                            ::testing::Values(1, 4)),
+                         MatMulWeightsDecompressionActivation::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
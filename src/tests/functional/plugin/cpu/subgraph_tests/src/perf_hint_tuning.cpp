@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The number of streams and threads chosen by PERFORMANCE_HINT is tuned empirically during LoadNetwork.
+ * The tuned config is exported with the network and reused on import:
+
+    Input
+      |
+  Convolution
+      |
+     Relu
+      |
+    Output
+*/
+
+using PerfHintTuningParams = std::string;  // performance hint
+
+class PerfHintTuning : public testing::WithParamInterface<PerfHintTuningParams>,
+                       public CPUTestsBase,
+                       virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<PerfHintTuningParams> obj) {
+        std::ostringstream result;
+        result << "hint=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        configuration.insert({PluginConfigParams::KEY_PERFORMANCE_HINT, this->GetParam()});
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PERFORMANCE_HINT_TUNING_BUDGET, "200"});
+
+        auto params = builder::makeParams(element::f32, {{1, 8, 16, 16}});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<opset1::Relu>(conv);
+        function = makeNgraphFunction(element::f32, params, relu, "PerfHintTuning");
+    }
+};
+
+TEST_P(PerfHintTuning, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    const auto streams = executableNetwork.GetConfig(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS).as<std::string>();
+    ASSERT_GT(std::stoi(streams), 0);
+}
+
+TEST_P(PerfHintTuning, ExportImport) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    std::stringstream strm;
+    executableNetwork.Export(strm);
+    auto importedNetwork = core->ImportNetwork(strm, targetDevice, configuration);
+
+    for (const auto& key : {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, PluginConfigParams::KEY_CPU_THREADS_NUM}) {
+        ASSERT_EQ(executableNetwork.GetConfig(key).as<std::string>(), importedNetwork.GetConfig(key).as<std::string>());
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_PerfHintTuning, PerfHintTuning,
+                         ::testing::Values(PluginConfigParams::THROUGHPUT, PluginConfigParams::LATENCY),
+                         PerfHintTuning::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The attention pattern is fused into ScaledDotProductAttention node, which doesn't materialize the scores matrix,
+ * if CPU_SDPA_FUSION is enabled:
+
+    Query   Key
+       \    /
+       MatMul
+         |
+      Multiply (scale)
+         |
+        Add (mask, optional)
+         |
+      Softmax   Value
+          \      /
+           MatMul
+             |
+           Output
+*/
+
+using ScaledDotProductAttentionParams = std::tuple<SizeVector,  // query shape [B, H, Lq, D]
+                                                   size_t,      // key length
+                                                   bool,        // transpose key
+                                                   bool>;       // with mask
+
+class ScaledDotProductAttention : public testing::WithParamInterface<ScaledDotProductAttentionParams>,
+                                  public CPUTestsBase,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ScaledDotProductAttentionParams> obj) {
+        SizeVector queryShape;
+        size_t keyLength;
+        bool transposeKey, withMask;
+        std::tie(queryShape, keyLength, transposeKey, withMask) = obj.param;
+
+        std::ostringstream result;
+        result << "QS=" << CommonTestUtils::vec2str(queryShape) << "_";
+        result << "Lk=" << keyLength << "_";
+        result << "transposeKey=" << transposeKey << "_";
+        result << "withMask=" << withMask;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigInternalParams::KEY_CPU_SDPA_FUSION] = PluginConfigParams::YES;
+
+        SizeVector queryShape;
+        size_t keyLength;
+        bool transposeKey, withMask;
+        std::tie(queryShape, keyLength, transposeKey, withMask) = this->GetParam();
+
+        const size_t batch = queryShape[0], heads = queryShape[1], headSize = queryShape[3];
+        const SizeVector keyShape = transposeKey ? SizeVector{batch, heads, keyLength, headSize}
+                                                 : SizeVector{batch, heads, headSize, keyLength};
+        const SizeVector valueShape{batch, heads, keyLength, headSize};
+        std::vector<SizeVector> inputShapes{queryShape, keyShape, valueShape};
+        if (withMask)
+            inputShapes.push_back({batch, 1, 1, keyLength});
+        auto params = builder::makeParams(element::f32, inputShapes);
+
+        auto scores = builder::makeMatMul(params[0], params[1], false, transposeKey);
+        auto scale = builder::makeConstant<float>(element::f32, {}, {1.f / std::sqrt(static_cast<float>(headSize))});
+        std::shared_ptr<Node> scaled = std::make_shared<opset1::Multiply>(scores, scale);
+        if (withMask)
+            scaled = std::make_shared<opset1::Add>(scaled, params[3]);
+        auto softmax = std::make_shared<opset1::Softmax>(scaled, 3);
+        auto attention = builder::makeMatMul(softmax, params[2], false, false);
+        function = makeNgraphFunction(element::f32, params, attention, "ScaledDotProductAttention");
+    }
+};
+
+TEST_P(ScaledDotProductAttention, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "ScaledDotProductAttention", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Softmax", 0);
+    CheckNodeOfTypeCount(executableNetwork, "MatMul", 0);
+}
+
+TEST_P(ScaledDotProductAttention, NotFusedByDefault) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.erase(PluginConfigInternalParams::KEY_CPU_SDPA_FUSION);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "ScaledDotProductAttention", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledDotProductAttention, ScaledDotProductAttention,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 2, 16, 32}, SizeVector{2, 3, 40, 64}),
+                                            ::testing::Values(16, 300),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true, false)),
+                         ScaledDotProductAttention::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
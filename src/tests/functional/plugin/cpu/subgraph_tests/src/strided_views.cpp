@@ -0,0 +1,177 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* Data movement nodes select contiguous blocks of their inputs, so their outputs are views on the input memory
+ * and the nodes don't copy the data:
+
+       Input            Input                 Input
+         |                |                     |
+    Gather (axis 0,  StridedSlice (channels  Transpose (only
+     scalar index)    of one batch)           unit dims moved)
+         |                |                     |
+   Input |          Input |               Input |
+      \  |             \  |                  \  |
+       Add              Add                   Add
+        |                |                     |
+      Output           Output                Output
+*/
+
+class StridedViews : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = builder::makeParams(element::f32, {{3, 16, 32}, {16, 32},
+                                                         {2, 8, 16, 32}, {1, 4, 16, 32},
+                                                         {1, 16, 1, 32}, {1, 1, 16, 32}});
+
+        auto gather = std::make_shared<opset8::Gather>(params[0],
+                                                       opset8::Constant::create(element::i64, {}, {1}),
+                                                       opset8::Constant::create(element::i64, {}, {0}));
+        auto slice = builder::makeStridedSlice(params[2], {1, 2, 0, 0}, {2, 6, 16, 32}, {1, 1, 1, 1}, element::i64,
+                                             {0, 0, 0, 0}, {0, 0, 0, 0});
+        auto transpose = std::make_shared<opset8::Transpose>(params[4],
+                                                             opset8::Constant::create(element::i64, {4}, {0, 2, 1, 3}));
+
+        // the views are the second inputs, since the first input of Add may be overwritten in-place
+        ResultVector results;
+        for (const auto& view : NodeVector{gather, slice, transpose}) {
+            const auto other = params[results.size() * 2 + 1];
+            results.push_back(std::make_shared<opset8::Result>(std::make_shared<opset8::Add>(other, view)));
+        }
+        function = std::make_shared<Function>(results, params, "StridedViews");
+    }
+};
+
+TEST_F(StridedViews, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto eliminatedBytes = executableNetwork.GetMetric(PluginConfigInternalParams::METRIC_CPU_VIEW_ELIMINATED_BYTES).as<uint64_t>();
+    ASSERT_EQ(eliminatedBytes, (16 * 32 + 4 * 16 * 32 + 16 * 32) * sizeof(float));
+}
+
+/* The views are the first inputs of Add, which may be computed in-place. Add mustn't overwrite the memory behind the
+ * views: the graph inputs and the Relu output, which is read by the second Add after it:
+
+       Input            Input                 Input
+         |                |                     |
+    Gather (axis 0,  StridedSlice (channels    Relu -------+
+     scalar index)    of one batch)             |          |
+         |                |                   Gather       |
+         |  Input         |  Input              |  Input   |
+         |  /             |  /                  |  /       |
+        Add              Add                   Add         |
+         |                |                     |          |
+       Output           Output                 Add --------+
+                                                |
+                                              Output
+*/
+
+class StridedViewsInPlaceEltwise : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = builder::makeParams(element::f32, {{3, 16, 32}, {16, 32},
+                                                         {2, 8, 16, 32}, {1, 4, 16, 32},
+                                                         {3, 16, 32}, {16, 32}});
+
+        auto gather = std::make_shared<opset8::Gather>(params[0],
+                                                       opset8::Constant::create(element::i64, {}, {1}),
+                                                       opset8::Constant::create(element::i64, {}, {0}));
+        auto slice = builder::makeStridedSlice(params[2], {1, 2, 0, 0}, {2, 6, 16, 32}, {1, 1, 1, 1}, element::i64,
+                                             {0, 0, 0, 0}, {0, 0, 0, 0});
+        auto relu = std::make_shared<opset8::Relu>(params[4]);
+        auto reluGather = std::make_shared<opset8::Gather>(relu,
+                                                           opset8::Constant::create(element::i64, {}, {1}),
+                                                           opset8::Constant::create(element::i64, {}, {0}));
+
+        ResultVector results;
+        for (const auto& view : NodeVector{gather, slice}) {
+            const auto other = params[results.size() * 2 + 1];
+            results.push_back(std::make_shared<opset8::Result>(std::make_shared<opset8::Add>(view, other)));
+        }
+        auto reluGatherAdd = std::make_shared<opset8::Add>(reluGather, params[5]);
+        results.push_back(std::make_shared<opset8::Result>(std::make_shared<opset8::Add>(relu, reluGatherAdd)));
+        function = std::make_shared<Function>(results, params, "StridedViewsInPlaceEltwise");
+    }
+};
+
+TEST_F(StridedViewsInPlaceEltwise, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto eliminatedBytes = executableNetwork.GetMetric(PluginConfigInternalParams::METRIC_CPU_VIEW_ELIMINATED_BYTES).as<uint64_t>();
+    ASSERT_EQ(eliminatedBytes, (16 * 32 + 4 * 16 * 32 + 16 * 32) * sizeof(float));
+}
+
+/* The producer of the sliced data runs in the blocked layout. The view needs the plain layout, so StridedSlice must
+ * keep running on the blocked input instead of getting a reorder of the whole tensor in front of it:
+
+       Input
+         |
+    Convolution (blocked output)
+         |
+    StridedSlice (channels)
+         |
+       Relu
+         |
+       Output
+*/
+
+class StridedViewsBlockedProducer : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = builder::makeParams(element::f32, {{1, 3, 16, 16}});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 32);
+        auto slice = builder::makeStridedSlice(conv, {0, 0, 0, 0}, {1, 16, 16, 16}, {1, 1, 1, 1}, element::i64,
+                                             {0, 0, 0, 0}, {0, 0, 0, 0});
+        auto relu = std::make_shared<opset8::Relu>(slice);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset8::Result>(relu)}, params,
+                                              "StridedViewsBlockedProducer");
+    }
+};
+
+TEST_F(StridedViewsBlockedProducer, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, execGraph);
+    const auto getLayerType = [](const std::shared_ptr<Node>& node) {
+        return node->get_rt_info().at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>();
+    };
+    size_t slices = 0;
+    for (const auto& node : execGraph->get_ops()) {
+        if (getLayerType(node) != "StridedSlice")
+            continue;
+        slices++;
+        ASSERT_NE("Reorder", getLayerType(node->get_input_node_shared_ptr(0)));
+        for (const auto& consumer : node->get_output_target_inputs(0))
+            ASSERT_NE("Reorder", getLayerType(consumer.get_node()->shared_from_this()));
+    }
+    ASSERT_EQ(1u, slices);
+
+    const auto eliminatedBytes = executableNetwork.GetMetric(PluginConfigInternalParams::METRIC_CPU_VIEW_ELIMINATED_BYTES).as<uint64_t>();
+    ASSERT_EQ(0u, eliminatedBytes);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,202 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/completion_queue.hpp>
+#include <openvino/runtime/core.hpp>
+
+#include "node_benchmark.hpp"
+
+using namespace CPUNodeBenchmarks;
+
+namespace {
+
+// The model is tiny, so the time of a request is dominated by the runtime overhead of the asynchronous pipeline
+std::shared_ptr<ov::Model> makeTinyModel() {
+    const auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 16});
+    const auto add = std::make_shared<ov::opset8::Add>(param, ov::opset8::Constant::create(ov::element::f32, {1, 16}, {1}));
+    return makeModel(add, {param});
+}
+
+ov::Core& getCore() {
+    static ov::Core core;
+    return core;
+}
+
+/**
+ * Throughput of small inferences: every iteration starts all the requests and waits for them.
+ * The `infer/s` counter is the number of completed inferences per second.
+ */
+void runAsyncRequests(benchmark::State& state, size_t requestsNum, bool useCallback) {
+    ov::CompiledModel compiledModel;
+    try {
+        compiledModel = getCore().compile_model(makeTinyModel(), "CPU", ov::streams::num(static_cast<int32_t>(requestsNum)));
+    } catch (const std::exception& ex) {
+        state.SkipWithError(ex.what());
+        return;
+    }
+
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < requestsNum; ++i) {
+        requests.push_back(compiledModel.create_infer_request());
+        if (useCallback) {
+            requests.back().set_callback([](std::exception_ptr) {});
+        }
+        requests.back().infer();
+    }
+
+    for (auto _ : state) {
+        for (auto& request : requests) {
+            request.start_async();
+        }
+        for (auto& request : requests) {
+            request.wait();
+        }
+    }
+
+    const auto inferences = static_cast<double>(state.iterations() * requestsNum);
+    state.counters["infer/s"] = benchmark::Counter(inferences, benchmark::Counter::kIsRate);
+}
+
+std::vector<ov::InferRequest> createRequests(benchmark::State& state, size_t requestsNum) {
+    ov::CompiledModel compiledModel;
+    try {
+        compiledModel = getCore().compile_model(makeTinyModel(), "CPU", ov::streams::num(ov::streams::AUTO));
+    } catch (const std::exception& ex) {
+        state.SkipWithError(ex.what());
+        return {};
+    }
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < requestsNum; ++i) {
+        requests.push_back(compiledModel.create_infer_request());
+        requests.back().infer();
+    }
+    return requests;
+}
+
+// Every request is restarted as soon as it is completed, so `requestsNum` inferences are always in flight
+constexpr size_t inferencesPerRequest = 16;
+
+/**
+ * Completions are harvested by the benchmark thread from the queue in batches and the requests are restarted there
+ * without wait.
+ */
+void runCompletionQueue(benchmark::State& state, size_t requestsNum) {
+    auto requests = createRequests(state, requestsNum);
+    if (requests.empty()) {
+        return;
+    }
+    ov::CompletionQueue queue;
+    for (auto& request : requests) {
+        queue.bind(request, &request);
+    }
+    const size_t inferences = requestsNum * inferencesPerRequest;
+    std::vector<ov::CompletionQueue::Completion> completions;
+    completions.reserve(requestsNum);
+
+    for (auto _ : state) {
+        size_t started = 0;
+        size_t completed = 0;
+        for (auto& request : requests) {
+            request.start_async();
+            started++;
+        }
+        while (completed < inferences) {
+            completions.resize(1);
+            queue.wait_any(completions.front());
+            queue.poll(completions, requestsNum);
+            for (const auto& completion : completions) {
+                completed++;
+                if (started < inferences) {
+                    static_cast<ov::InferRequest*>(completion.tag)->start_async();
+                    started++;
+                }
+            }
+        }
+    }
+
+    const auto total = static_cast<double>(state.iterations() * inferences);
+    state.counters["infer/s"] = benchmark::Counter(total, benchmark::Counter::kIsRate);
+}
+
+/**
+ * The requests are restarted by their callbacks, the benchmark thread waits for the last completion.
+ */
+void runCallbacks(benchmark::State& state, size_t requestsNum) {
+    auto requests = createRequests(state, requestsNum);
+    if (requests.empty()) {
+        return;
+    }
+    const size_t inferences = requestsNum * inferencesPerRequest;
+    std::atomic<size_t> started{0};
+    std::mutex mutex;
+    std::condition_variable allCompleted;
+    size_t completed = 0;
+    for (auto& request : requests) {
+        auto* req = &request;
+        request.set_callback([&, req](std::exception_ptr) {
+            if (started.fetch_add(1) < inferences) {
+                req->start_async();
+            }
+            std::lock_guard<std::mutex> lock{mutex};
+            if (++completed == inferences) {
+                allCompleted.notify_one();
+            }
+        });
+    }
+
+    for (auto _ : state) {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            completed = 0;
+        }
+        started = requestsNum;
+        for (auto& request : requests) {
+            request.start_async();
+        }
+        std::unique_lock<std::mutex> lock{mutex};
+        allCompleted.wait(lock, [&] {
+            return completed == inferences;
+        });
+    }
+    for (auto& request : requests) {
+        request.wait();
+    }
+
+    const auto total = static_cast<double>(state.iterations() * inferences);
+    state.counters["infer/s"] = benchmark::Counter(total, benchmark::Counter::kIsRate);
+}
+
+bool registerAsyncRequests() {
+    for (const size_t requestsNum : {1, 2, 4, 8}) {
+        for (const bool useCallback : {false, true}) {
+            const auto name = "AsyncInfer/" + std::to_string(requestsNum) + (useCallback ? "/callback" : "/wait");
+            benchmark::RegisterBenchmark(name.c_str(), runAsyncRequests, requestsNum, useCallback)
+                ->Unit(benchmark::kMicrosecond)
+                ->UseRealTime();
+        }
+    }
+    for (const size_t requestsNum : {8, 32, 128}) {
+        const auto requests = "/" + std::to_string(requestsNum);
+        benchmark::RegisterBenchmark(("CompletionQueue" + requests).c_str(), runCompletionQueue, requestsNum)
+            ->Unit(benchmark::kMicrosecond)
+            ->UseRealTime();
+        benchmark::RegisterBenchmark(("CompletionCallback" + requests).c_str(), runCallbacks, requestsNum)
+            ->Unit(benchmark::kMicrosecond)
+            ->UseRealTime();
+    }
+    return true;
+}
+
+const bool asyncRequestsRegistered = registerAsyncRequests();
+
+}  // namespace
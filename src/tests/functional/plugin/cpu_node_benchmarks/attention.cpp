@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+
+#include <openvino/opsets/opset8.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "node_benchmark.hpp"
+
+using namespace CPUNodeBenchmarks;
+
+namespace {
+
+/**
+ * Self-attention of a BERT/GPT layer with 12 heads of 64 channels and the padding mask: the unfused MatMul -> Multiply
+ * -> Add -> Softmax -> MatMul nodes write and read the [B, H, L, L] scores, the ScaledDotProductAttention node
+ * (`CPU_SDPA_FUSION`) doesn't materialize them. Long sequences make the scores larger than the caches.
+ */
+bool registerAttention() {
+    const size_t heads = 12;
+    const size_t headSize = 64;
+    for (const size_t length : {512, 2048, 4096}) {
+        for (const auto& precision : {fp32(), bf16()}) {
+            for (const bool fused : {false, true}) {
+                const ov::Shape shape{1, heads, length, headSize};
+                const ov::Shape maskShape{1, 1, 1, length};
+                auto config = precision.config;
+                config[InferenceEngine::PluginConfigInternalParams::KEY_CPU_SDPA_FUSION] =
+                    fused ? InferenceEngine::PluginConfigParams::YES : InferenceEngine::PluginConfigParams::NO;
+                registerNodeBenchmark({
+                    "Attention/" + shapeToString(shape) + "/" + precision.name + "/" +
+                        (fused ? "SDPA" : "MatMulSoftmax"),
+                    [=]() {
+                        auto params = ngraph::builder::makeParams(precision.type, {shape, shape, shape, maskShape});
+                        auto scores = ngraph::builder::makeMatMul(params[0], params[1], false, true);
+                        const float scaleValue = 1.f / std::sqrt(static_cast<float>(headSize));
+                        auto scale = ngraph::builder::makeConstant<float>(precision.type, {}, {scaleValue});
+                        auto scaled = std::make_shared<ov::opset8::Multiply>(scores, scale);
+                        auto masked = std::make_shared<ov::opset8::Add>(scaled, params[3]);
+                        auto softmax = std::make_shared<ov::opset8::Softmax>(masked, 3);
+                        auto attention = ngraph::builder::makeMatMul(softmax, params[2], false, false);
+                        return makeModel(attention, params);
+                    },
+                    4.0 * heads * length * length * headSize,
+                    config});
+            }
+        }
+    }
+    return true;
+}
+
+const bool attentionRegistered = registerAttention();
+
+}  // namespace
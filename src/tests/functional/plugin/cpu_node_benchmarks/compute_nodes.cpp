@@ -0,0 +1,194 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <sstream>
+
+#include <openvino/opsets/opset8.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "node_benchmark.hpp"
+
+using namespace CPUNodeBenchmarks;
+using namespace CPUTestUtils;
+using namespace ngraph::helpers;
+
+namespace {
+
+const std::vector<ov::Shape> shapes4D = {
+    {1, 64, 56, 56},
+    {1, 256, 14, 14},
+    {8, 32, 64, 64},
+};
+
+const std::vector<cpu_memory_format_t> layouts4D = {nchw, nhwc, nChw8c, nChw16c};
+
+template <typename T>
+std::string toString(const T& value) {
+    std::ostringstream result;
+    result << value;
+    return result.str();
+}
+
+std::string caseName(const std::string& node, const ov::Shape& shape, const Precision& precision,
+                     cpu_memory_format_t layout) {
+    return node + "/" + shapeToString(shape) + "/" + precision.name + "/" + CPUTestsBase::cpu_fmt2str(layout);
+}
+
+std::shared_ptr<ov::Node> withLayout(const std::shared_ptr<ov::Node>& node, cpu_memory_format_t layout, size_t dataInputs = 1) {
+    for (const auto& item : makeLayoutInfo(layout, dataInputs)) {
+        node->get_rt_info()[item.first] = item.second;
+    }
+    return node;
+}
+
+// Eltwise: one operation per output element, the second input is either the full tensor or per channel
+bool registerEltwise() {
+    const std::vector<EltwiseTypes> floatTypes = {EltwiseTypes::ADD, EltwiseTypes::MULTIPLY, EltwiseTypes::DIVIDE,
+                                                  EltwiseTypes::POWER};
+    const std::vector<EltwiseTypes> integerTypes = {EltwiseTypes::ADD, EltwiseTypes::MULTIPLY};
+    for (const auto& precision : {fp32(), bf16(), i32()}) {
+        for (const auto type : precision.type.is_real() ? floatTypes : integerTypes) {
+            for (const auto& shape : shapes4D) {
+                for (const auto perChannel : {false, true}) {
+                    for (const auto layout : layouts4D) {
+                        const ov::Shape secondShape = perChannel ? ov::Shape{1, shape[1], 1, 1} : shape;
+                        registerNodeBenchmark({
+                            caseName("Eltwise_" + toString(type) + (perChannel ? "_PerChannel" : ""), shape, precision, layout),
+                            [=]() {
+                                auto params = ngraph::builder::makeParams(precision.type, {shape, secondShape});
+                                auto eltwise = ngraph::builder::makeEltwise(params[0], params[1], type);
+                                return makeModel(withLayout(eltwise, layout, 2), params);
+                            },
+                            static_cast<double>(ov::shape_size(shape)),
+                            precision.config});
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Reduce: one operation per input element
+bool registerReduce() {
+    const std::vector<std::pair<std::string, std::vector<int64_t>>> axesSets = {
+        {"Spatial", {2, 3}},
+        {"Channel", {1}},
+        {"All", {1, 2, 3}},
+    };
+    for (const auto type : {ReductionType::Mean, ReductionType::Max, ReductionType::Sum, ReductionType::L2}) {
+        for (const auto& precision : {fp32(), bf16()}) {
+            for (const auto& shape : shapes4D) {
+                for (const auto& axes : axesSets) {
+                    for (const auto layout : {nchw, nhwc, nChw16c}) {
+                        registerNodeBenchmark({
+                            caseName("Reduce" + toString(type) + "_" + axes.first, shape, precision, layout),
+                            [=]() {
+                                auto params = ngraph::builder::makeParams(precision.type, {shape});
+                                auto axesNode = ov::opset8::Constant::create(ov::element::i64, {axes.second.size()}, axes.second);
+                                auto reduce = ngraph::builder::makeReduce(params[0], axesNode, true, type);
+                                return makeModel(withLayout(reduce, layout), params);
+                            },
+                            static_cast<double>(ov::shape_size(shape)),
+                            precision.config});
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// MVN: mean and variance accumulation and the normalization, about 6 operations per element
+bool registerMVN() {
+    for (const auto& precision : {fp32(), bf16()}) {
+        for (const auto& shape : shapes4D) {
+            for (const auto acrossChannels : {false, true}) {
+                for (const auto layout : layouts4D) {
+                    registerNodeBenchmark({
+                        caseName(acrossChannels ? "MVN_AcrossChannels" : "MVN", shape, precision, layout),
+                        [=]() {
+                            auto params = ngraph::builder::makeParams(precision.type, {shape});
+                            const auto axes = acrossChannels ? std::vector<int64_t>{1, 2, 3} : std::vector<int64_t>{2, 3};
+                            auto axesNode = ov::opset8::Constant::create(ov::element::i64, {axes.size()}, axes);
+                            std::string epsMode = "inside_sqrt";
+                            auto mvn = ngraph::builder::makeMVN6(params[0], axesNode, true, 1e-9f, epsMode);
+                            return makeModel(withLayout(mvn, layout), params);
+                        },
+                        6.0 * ov::shape_size(shape),
+                        precision.config});
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Interpolate: x2 spatial upscale, operations per output element are estimated by the number of taps
+bool registerInterpolate() {
+    using Interpolate = ov::opset8::Interpolate;
+    const std::vector<std::pair<Interpolate::InterpolateMode, double>> modes = {
+        {Interpolate::InterpolateMode::NEAREST, 0.0},
+        {Interpolate::InterpolateMode::LINEAR_ONNX, 8.0},
+        {Interpolate::InterpolateMode::CUBIC, 32.0},
+    };
+    for (const auto& mode : modes) {
+        for (const auto& precision : {fp32(), bf16()}) {
+            for (const auto& shape : shapes4D) {
+                for (const auto layout : layouts4D) {
+                    const ov::Shape outShape = {shape[0], shape[1], shape[2] * 2, shape[3] * 2};
+                    registerNodeBenchmark({
+                        caseName("Interpolate_" + toString(mode.first), shape, precision, layout),
+                        [=]() {
+                            auto params = ngraph::builder::makeParams(precision.type, {shape});
+                            auto sizes = ov::opset8::Constant::create(ov::element::i64, {2}, {outShape[2], outShape[3]});
+                            auto scales = ov::opset8::Constant::create(ov::element::f32, {2}, {2.f, 2.f});
+                            auto axes = ov::opset8::Constant::create(ov::element::i64, {2}, {2, 3});
+                            Interpolate::InterpolateAttrs attrs(mode.first, Interpolate::ShapeCalcMode::SCALES, {0, 0, 0, 0}, {0, 0, 0, 0});
+                            auto interpolate = std::make_shared<Interpolate>(params[0], sizes, scales, axes, attrs);
+                            return makeModel(withLayout(interpolate, layout), params);
+                        },
+                        mode.second * ov::shape_size(outShape),
+                        precision.config});
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// DFT: 5 * N * log2(N) operations per complex transform of the length N, both power of two and mixed radix lengths
+bool registerDFT() {
+    const std::vector<ov::Shape> shapes = {
+        {64, 256, 2},
+        {16, 4096, 2},
+        {64, 400, 2},
+        {64, 1000, 2},
+        {64, 1009, 2},
+    };
+    for (const auto opType : {DFTOpType::FORWARD, DFTOpType::INVERSE}) {
+        for (const auto& shape : shapes) {
+            const double length = static_cast<double>(shape[1]);
+            registerNodeBenchmark({
+                std::string(opType == DFTOpType::FORWARD ? "DFT" : "IDFT") + "/" + shapeToString(shape) + "/" + fp32().name,
+                [=]() {
+                    auto params = ngraph::builder::makeParams(ov::element::f32, {shape});
+                    auto dft = ngraph::builder::makeDFT(params[0], {1}, {}, opType);
+                    return makeModel(dft, params);
+                },
+                5.0 * length * std::log2(length) * shape[0],
+                fp32().config});
+        }
+    }
+    return true;
+}
+
+const bool eltwiseRegistered = registerEltwise();
+const bool reduceRegistered = registerReduce();
+const bool mvnRegistered = registerMVN();
+const bool interpolateRegistered = registerInterpolate();
+const bool dftRegistered = registerDFT();
+
+}  // namespace
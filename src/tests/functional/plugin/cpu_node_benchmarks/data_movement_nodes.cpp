@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset8.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "node_benchmark.hpp"
+
+using namespace CPUNodeBenchmarks;
+using namespace ngraph::helpers;
+
+namespace {
+
+std::string caseName(const std::string& node, const ov::Shape& shape, const Precision& precision) {
+    return node + "/" + shapeToString(shape) + "/" + precision.name;
+}
+
+// Deterministic spread of the indices over the whole axis
+std::vector<int64_t> makeIndices(size_t count, size_t axisDim) {
+    std::vector<int64_t> indices(count);
+    for (size_t i = 0; i < count; ++i) {
+        indices[i] = static_cast<int64_t>((i * 7919) % axisDim);
+    }
+    return indices;
+}
+
+bool registerGather() {
+    struct GatherCase {
+        ov::Shape data;
+        size_t axis;
+        size_t indices;
+    };
+    const std::vector<GatherCase> cases = {
+        {{30000, 512}, 0, 4096},       // embeddings lookup
+        {{1, 256, 56, 56}, 1, 128},    // channels selection
+        {{64, 128, 1024}, 2, 512},     // innermost axis
+    };
+    for (const auto& precision : {fp32(), bf16(), i32(), u8()}) {
+        for (const auto& gatherCase : cases) {
+            registerNodeBenchmark({
+                caseName("Gather_Axis" + std::to_string(gatherCase.axis), gatherCase.data, precision) + "/" +
+                    std::to_string(gatherCase.indices),
+                [=]() {
+                    auto params = ngraph::builder::makeParams(precision.type, {gatherCase.data});
+                    const auto indicesData = makeIndices(gatherCase.indices, gatherCase.data[gatherCase.axis]);
+                    auto indices = ov::opset8::Constant::create(ov::element::i64, {gatherCase.indices}, indicesData);
+                    auto axis = ov::opset8::Constant::create(ov::element::i64, {}, {gatherCase.axis});
+                    auto gather = std::make_shared<ov::opset8::Gather>(params[0], indices, axis);
+                    return makeModel(gather, params);
+                },
+                0.0,
+                precision.config});
+        }
+    }
+    return true;
+}
+
+bool registerTopK() {
+    struct TopKCase {
+        ov::Shape data;
+        int64_t axis;
+        int64_t k;
+    };
+    const std::vector<TopKCase> cases = {
+        {{1, 1000}, 1, 5},           // classification
+        {{8, 32768}, 1, 100},        // long rows
+        {{1, 256, 56, 56}, 1, 16},   // across channels
+    };
+    for (const auto& precision : {fp32(), bf16(), i32()}) {
+        for (const auto& topKCase : cases) {
+            for (const auto sort : {ov::opset8::TopK::SortType::SORT_VALUES, ov::opset8::TopK::SortType::SORT_INDICES}) {
+                registerNodeBenchmark({
+                    caseName("TopK_K" + std::to_string(topKCase.k) +
+                             (sort == ov::opset8::TopK::SortType::SORT_VALUES ? "_SortValues" : "_SortIndices"),
+                             topKCase.data, precision),
+                    [=]() {
+                        auto params = ngraph::builder::makeParams(precision.type, {topKCase.data});
+                        auto k = ov::opset8::Constant::create(ov::element::i64, {}, {topKCase.k});
+                        auto topK = std::make_shared<ov::opset8::TopK>(params[0], k, topKCase.axis,
+                                                                       ov::opset8::TopK::Mode::MAX, sort);
+                        return makeModel(topK, params);
+                    },
+                    0.0,
+                    precision.config});
+            }
+        }
+    }
+    return true;
+}
+
+bool registerNMS() {
+    for (const size_t boxes : {1000, 5000}) {
+        for (const size_t classes : {1, 80}) {
+            const ov::Shape boxesShape = {1, boxes, 4};
+            const ov::Shape scoresShape = {1, classes, boxes};
+            registerNodeBenchmark({
+                caseName("NonMaxSuppression_Classes" + std::to_string(classes), boxesShape, fp32()),
+                [=]() {
+                    auto params = ngraph::builder::makeParams(ov::element::f32, {boxesShape, scoresShape});
+                    auto nms = ngraph::builder::makeNms(params[0], params[1], ov::element::i32, ov::element::f32,
+                                                        200, 0.5f, 0.05f, 0.f,
+                                                        ov::opset8::NonMaxSuppression::BoxEncodingType::CORNER,
+                                                        true, ov::element::i32);
+                    return makeModel(nms, params);
+                },
+                0.0,
+                fp32().config});
+        }
+    }
+    return true;
+}
+
+bool registerConvert() {
+    const std::vector<std::pair<ov::element::Type, ov::element::Type>> conversions = {
+        {ov::element::u8, ov::element::f32},
+        {ov::element::f32, ov::element::u8},
+        {ov::element::f32, ov::element::bf16},
+        {ov::element::bf16, ov::element::f32},
+        {ov::element::f32, ov::element::i32},
+        {ov::element::i32, ov::element::f32},
+    };
+    for (const auto& conversion : conversions) {
+        for (const ov::Shape& shape : {ov::Shape{1, 3, 224, 224}, ov::Shape{1, 256, 56, 56}}) {
+            registerNodeBenchmark({
+                "Convert_" + conversion.first.get_type_name() + "_to_" + conversion.second.get_type_name() + "/" +
+                    shapeToString(shape),
+                [=]() {
+                    auto params = ngraph::builder::makeParams(conversion.first, {shape});
+                    auto convert = ngraph::builder::makeConversion(params[0], conversion.second, ConversionTypes::CONVERT);
+                    return makeModel(convert, params);
+                },
+                0.0,
+                {}});
+        }
+    }
+    return true;
+}
+
+// Layout permutations, the CPU plugin executes them by the reorder and permute kernels
+bool registerReorder() {
+    const std::vector<std::pair<std::string, std::vector<int64_t>>> orders = {
+        {"nchw_to_nhwc", {0, 2, 3, 1}},
+        {"nhwc_to_nchw", {0, 3, 1, 2}},
+        {"swap_hw", {0, 1, 3, 2}},
+    };
+    for (const auto& precision : {fp32(), bf16(), u8()}) {
+        for (const auto& order : orders) {
+            for (const ov::Shape& shape : {ov::Shape{1, 3, 224, 224}, ov::Shape{1, 256, 56, 56}, ov::Shape{8, 64, 64, 64}}) {
+                registerNodeBenchmark({
+                    caseName("Reorder_" + order.first, shape, precision),
+                    [=]() {
+                        auto params = ngraph::builder::makeParams(precision.type, {shape});
+                        auto orderNode = ov::opset8::Constant::create(ov::element::i64, {order.second.size()}, order.second);
+                        auto transpose = std::make_shared<ov::opset8::Transpose>(params[0], orderNode);
+                        return makeModel(transpose, params);
+                    },
+                    0.0,
+                    precision.config});
+            }
+        }
+    }
+    return true;
+}
+
+const bool gatherRegistered = registerGather();
+const bool topKRegistered = registerTopK();
+const bool nmsRegistered = registerNMS();
+const bool convertRegistered = registerConvert();
+const bool reorderRegistered = registerReorder();
+
+}  // namespace
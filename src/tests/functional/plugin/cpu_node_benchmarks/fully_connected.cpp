@@ -0,0 +1,135 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset8.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "node_benchmark.hpp"
+
+using namespace CPUNodeBenchmarks;
+
+namespace {
+
+// Weights of MatMul: fp32 constant, or u8/i8 constant with Convert -> Subtract -> Multiply decompression subgraph,
+// which is kept compressed by the plugin and decompressed inside FullyConnected node
+std::shared_ptr<ov::Node> makeWeights(size_t N, size_t K, ov::element::Type weightsType, size_t groups) {
+    if (weightsType == ov::element::f32) {
+        return ngraph::builder::makeConstant<float>(ov::element::f32, {N, K}, {}, true, 1.f, -1.f);
+    }
+    const ov::Shape decompressionShape = groups > 1 ? ov::Shape{N, groups, 1} : ov::Shape{N, 1};
+    auto weights = ngraph::builder::makeConstant<int8_t>(weightsType, groups > 1 ? ov::Shape{N, groups, K / groups} : ov::Shape{N, K},
+                                                         {}, true, 7, 0);
+    std::shared_ptr<ov::Node> decompression = std::make_shared<ov::opset8::Convert>(weights, ov::element::f32);
+    auto zeroPoints = ngraph::builder::makeConstant<float>(ov::element::f32, decompressionShape, {}, true, 4.f, 1.f);
+    decompression = std::make_shared<ov::opset8::Subtract>(decompression, zeroPoints);
+    auto scales = ngraph::builder::makeConstant<float>(ov::element::f32, decompressionShape, {}, true, 0.5f, 0.1f);
+    decompression = std::make_shared<ov::opset8::Multiply>(decompression, scales);
+    if (groups > 1) {
+        auto targetShape = ov::opset8::Constant::create(ov::element::i64, {2}, {N, K});
+        decompression = std::make_shared<ov::opset8::Reshape>(decompression, targetShape, false);
+    }
+    return decompression;
+}
+
+/**
+ * FullyConnected with fp32 and compressed weights: the small batches are bound by the weights bandwidth, so the
+ * compressed cases are compared with fp32 ones of the same shape. The Relu cases check the fused activation.
+ */
+bool registerWeightsDecompression() {
+    struct WeightsCase {
+        std::string name;
+        ov::element::Type type;
+        size_t groups;
+    };
+    const std::vector<WeightsCase> weightsCases = {
+        {"FP32", ov::element::f32, 1},
+        {"U8", ov::element::u8, 1},
+        {"I8", ov::element::i8, 1},
+        {"U8_Group128", ov::element::u8, 0},
+    };
+    const std::vector<std::pair<size_t, size_t>> weightsShapes = {
+        {4096, 4096},
+        {11008, 4096},
+    };
+    for (const auto& weightsShape : weightsShapes) {
+        const size_t N = weightsShape.first;
+        const size_t K = weightsShape.second;
+        for (const size_t batch : {1, 16, 64}) {
+            for (const auto& weightsCase : weightsCases) {
+                for (const bool withRelu : {false, true}) {
+                    const ov::Shape inputShape{batch, K};
+                    const size_t groups = weightsCase.groups == 0 ? K / 128 : weightsCase.groups;
+                    registerNodeBenchmark({
+                        std::string("FullyConnected_Compressed") + (withRelu ? "_Relu" : "") + "/" + shapeToString(inputShape) +
+                            "x" + std::to_string(N) + "/" + weightsCase.name,
+                        [=]() {
+                            auto params = ngraph::builder::makeParams(ov::element::f32, {inputShape});
+                            auto weights = makeWeights(N, K, weightsCase.type, groups);
+                            std::shared_ptr<ov::Node> node = std::make_shared<ov::opset8::MatMul>(params[0], weights, false, true);
+                            if (withRelu) {
+                                node = std::make_shared<ov::opset8::Relu>(node);
+                            }
+                            return makeModel(node, params);
+                        },
+                        2.0 * batch * N * K,
+                        fp32().config});
+                }
+            }
+        }
+    }
+    return true;
+}
+
+const bool weightsDecompressionRegistered = registerWeightsDecompression();
+
+/**
+ * FullyConnected with fp32 weights pruned by input channels: the Dense cases run oneDNN kernel, the Sparse cases pack
+ * the same weights into block-sparse format (CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE) and skip the zero blocks. GFLOPS
+ * counts the dense operations, so the speedup of the sparse kernel is the ratio of the times.
+ */
+bool registerSparseWeights() {
+    const std::vector<std::pair<size_t, size_t>> weightsShapes = {
+        {1024, 1024},
+        {4096, 4096},
+    };
+    for (const auto& weightsShape : weightsShapes) {
+        const size_t N = weightsShape.first;
+        const size_t K = weightsShape.second;
+        for (const size_t batch : {1, 16, 64}) {
+            for (const float sparsity : {0.5f, 0.7f, 0.9f, 0.95f}) {
+                for (const bool sparse : {false, true}) {
+                    const ov::Shape inputShape{batch, K};
+                    registerNodeBenchmark({
+                        std::string("FullyConnected_") + (sparse ? "Sparse" : "Dense") + "/" + shapeToString(inputShape) +
+                            "x" + std::to_string(N) + "/Sparsity" + std::to_string(static_cast<int>(sparsity * 100)),
+                        [=]() {
+                            auto params = ngraph::builder::makeParams(ov::element::f32, {inputShape});
+                            std::vector<float> weightsValues(N * K, 0.f);
+                            const size_t prunedChannels = static_cast<size_t>(sparsity * K);
+                            for (size_t k = 0; k < K; k++) {
+                                // every K / (K - prunedChannels)-th input channel is kept
+                                if (k * (K - prunedChannels) % K >= K - prunedChannels)
+                                    continue;
+                                for (size_t n = 0; n < N; n++)
+                                    weightsValues[n * K + k] = static_cast<float>((n + k) % 7) * 0.25f - 0.75f;
+                            }
+                            auto weights = ngraph::builder::makeConstant<float>(ov::element::f32, {N, K}, weightsValues);
+                            auto matMul = std::make_shared<ov::opset8::MatMul>(params[0], weights, false, true);
+                            return makeModel(matMul, params);
+                        },
+                        2.0 * batch * N * K,
+                        {{InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO},
+                         {InferenceEngine::PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE,
+                          sparse ? "0.5" : "1"}}});
+                }
+            }
+        }
+    }
+    return true;
+}
+
+const bool sparseWeightsRegistered = registerSparseWeights();
+
+}  // namespace
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset8.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "node_benchmark.hpp"
+
+using namespace CPUNodeBenchmarks;
+
+namespace {
+
+/**
+ * MVN feeding several convolution branches: the node by node layout selection gives MVN the planar layout of the
+ * input, so every branch reads it through a reorder, the global layout assignment moves the single reorder to the
+ * MVN input. The `reorder MB` counter is the data moved by the reorders per inference.
+ */
+bool registerLayoutAssignment() {
+    const std::vector<ov::Shape> shapes = {
+        {1, 64, 56, 56},
+        {1, 256, 14, 14},
+    };
+    for (const auto& shape : shapes) {
+        for (const size_t branches : {2, 4}) {
+            for (const bool global : {false, true}) {
+                registerNodeBenchmark({
+                    "LayoutAssignment/MVN_Conv" + std::to_string(branches) + "/" + shapeToString(shape) + "/" +
+                        (global ? "Global" : "NodeByNode"),
+                    [=]() {
+                        auto params = ngraph::builder::makeParams(ov::element::f32, {shape});
+                        auto mvn = ngraph::builder::makeMVN(params[0], false, true, 1e-9);
+                        ov::ResultVector results;
+                        for (size_t i = 0; i < branches; i++) {
+                            auto conv = ngraph::builder::makeConvolution(mvn, ov::element::f32, {1, 1}, {1, 1}, {0, 0},
+                                                                         {0, 0}, {1, 1}, ov::op::PadType::EXPLICIT,
+                                                                         shape[1]);
+                            results.push_back(std::make_shared<ov::opset8::Result>(conv));
+                        }
+                        return std::make_shared<ov::Model>(results, params, "LayoutAssignment");
+                    },
+                    2.0 * branches * ov::shape_size(shape) * shape[1],
+                    {{InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO},
+                     {InferenceEngine::PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT,
+                      global ? InferenceEngine::PluginConfigParams::YES : InferenceEngine::PluginConfigParams::NO}}});
+            }
+        }
+    }
+    return true;
+}
+
+const bool layoutAssignmentRegistered = registerLayoutAssignment();
+
+}  // namespace
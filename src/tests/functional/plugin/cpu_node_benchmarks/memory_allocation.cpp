@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset8.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "node_benchmark.hpp"
+
+using namespace CPUNodeBenchmarks;
+
+namespace {
+
+/**
+ * MatMul with the large constant weights: the weights are repacked by the plugin and streamed through every
+ * inference, so the latency depends on TLB misses of the weights buffer. The cases differ in the pages the weights
+ * and the graph workspace are mapped with, TLB misses are measured by the run under `perf stat -e dTLB-load-misses`.
+ */
+bool registerHugePages() {
+    const std::vector<std::pair<size_t, size_t>> weightsShapes = {
+        {4096, 4096},     // 64 MB
+        {4096, 16384},    // 256 MB
+    };
+    const std::vector<std::string> hugePagesModes = {"NO", "TRANSPARENT", "2MB", "1GB"};
+    for (const auto& weightsShape : weightsShapes) {
+        for (const size_t batch : {1, 16}) {
+            for (const auto& hugePages : hugePagesModes) {
+                const ov::Shape inputShape{batch, weightsShape.first};
+                registerNodeBenchmark({
+                    "MatMul_ConstWeights/" + shapeToString(inputShape) + "x" + std::to_string(weightsShape.second) +
+                        "/FP32/HugePages_" + hugePages,
+                    [=]() {
+                        auto params = ngraph::builder::makeParams(ov::element::f32, {inputShape});
+                        auto weights = ngraph::builder::makeConstant<float>(ov::element::f32,
+                                                                            {weightsShape.first, weightsShape.second},
+                                                                            {}, true);
+                        auto matMul = std::make_shared<ov::opset8::MatMul>(params[0], weights);
+                        return makeModel(matMul, params);
+                    },
+                    2.0 * batch * weightsShape.first * weightsShape.second,
+                    {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_HUGE_PAGES, hugePages}}});
+            }
+        }
+    }
+    return true;
+}
+
+const bool hugePagesRegistered = registerHugePages();
+
+}  // namespace
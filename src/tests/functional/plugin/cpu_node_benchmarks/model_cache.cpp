@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/core.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "node_benchmark.hpp"
+
+using namespace CPUNodeBenchmarks;
+
+namespace {
+
+// Chain of convolutions with ~9 MB of weights, so both the compilation and the blob export take a noticeable time
+std::shared_ptr<ov::Model> makeConvolutionsChain(size_t layers) {
+    auto params = ngraph::builder::makeParams(ov::element::f32, {{1, 64, 56, 56}});
+    std::shared_ptr<ov::Node> node = params[0];
+    for (size_t i = 0; i < layers; i++) {
+        node = ngraph::builder::makeConvolution(node, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                ov::op::PadType::EXPLICIT, 64, true);
+        node = std::make_shared<ov::opset8::Relu>(node);
+    }
+    return makeModel(node, params);
+}
+
+enum class CacheMode {
+    NoCache,        // compilation without the cache directory
+    Export,         // cold cache, the compiled model is exported before compile_model returns
+    AsyncExport,    // cold cache, the compiled model is exported in background (CACHE_ASYNC_EXPORT)
+    Import,         // warm cache, the compiled model is imported
+};
+
+void clearCache(const std::string& cacheDir) {
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    CommonTestUtils::removeFilesWithExt(cacheDir, "index");
+}
+
+/**
+ * First load latency: compile_model and the first inference by a new Core, as in a new application process.
+ * The Core is created and destroyed outside of the measured time, so the background export of AsyncExport
+ * case is completed before the next iteration.
+ */
+void runFirstLoad(benchmark::State& state, CacheMode mode) {
+    const auto model = makeConvolutionsChain(16);
+    const std::string cacheDir = "ov_cpu_node_benchmarks_cache";
+    CommonTestUtils::createDirectory(cacheDir);
+    clearCache(cacheDir);
+
+    auto makeCore = [&]() {
+        std::unique_ptr<ov::Core> core(new ov::Core);
+        if (mode != CacheMode::NoCache) {
+            core->set_property(ov::cache_dir(cacheDir));
+            core->set_property(ov::cache_async_export(mode == CacheMode::AsyncExport));
+        }
+        return core;
+    };
+
+    try {
+        if (mode == CacheMode::Import) {
+            makeCore()->compile_model(model, "CPU");
+        }
+    } catch (const std::exception& ex) {
+        state.SkipWithError(ex.what());
+        return;
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (mode == CacheMode::Export || mode == CacheMode::AsyncExport) {
+            clearCache(cacheDir);
+        }
+        auto core = makeCore();
+        state.ResumeTiming();
+
+        auto request = core->compile_model(model, "CPU").create_infer_request();
+        request.infer();
+
+        state.PauseTiming();
+        request = {};
+        core.reset();
+        state.ResumeTiming();
+    }
+
+    clearCache(cacheDir);
+    CommonTestUtils::removeDir(cacheDir);
+}
+
+bool registerModelCache() {
+    const std::vector<std::pair<std::string, CacheMode>> modes = {
+        {"NoCache", CacheMode::NoCache},
+        {"Export", CacheMode::Export},
+        {"AsyncExport", CacheMode::AsyncExport},
+        {"Import", CacheMode::Import},
+    };
+    for (const auto& mode : modes) {
+        benchmark::RegisterBenchmark(("ModelCache_FirstLoad/" + mode.first).c_str(), runFirstLoad, mode.second)
+            ->Unit(benchmark::kMillisecond)
+            ->UseRealTime();
+    }
+    return true;
+}
+
+const bool modelCacheRegistered = registerModelCache();
+
+}  // namespace
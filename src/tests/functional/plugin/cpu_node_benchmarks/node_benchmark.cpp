@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_benchmark.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <set>
+#include <sstream>
+
+#include <exec_graph_info.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/core.hpp>
+
+#include "functional_test_utils/ov_tensor_utils.hpp"
+
+namespace CPUNodeBenchmarks {
+
+using namespace InferenceEngine;
+
+const Precision& fp32() {
+    static const Precision precision{"FP32", ov::element::f32, {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO}}};
+    return precision;
+}
+
+const Precision& bf16() {
+    static const Precision precision{"BF16", ov::element::f32, {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES}}};
+    return precision;
+}
+
+const Precision& i32() {
+    static const Precision precision{"I32", ov::element::i32, {}};
+    return precision;
+}
+
+const Precision& u8() {
+    static const Precision precision{"U8", ov::element::u8, {}};
+    return precision;
+}
+
+CPUTestUtils::CPUTestsBase::CPUInfo makeLayoutInfo(CPUTestUtils::cpu_memory_format_t fmt, size_t dataInputs) {
+    return CPUTestUtils::CPUTestsBase::makeCPUInfo(std::vector<CPUTestUtils::cpu_memory_format_t>(dataInputs, fmt), {fmt}, {});
+}
+
+std::string shapeToString(const ov::Shape& shape) {
+    std::ostringstream result;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        result << (i == 0 ? "" : "x") << shape[i];
+    }
+    return result.str();
+}
+
+std::shared_ptr<ov::Model> makeModel(const std::shared_ptr<ov::Node>& node, const ov::ParameterVector& params) {
+    ov::ResultVector results;
+    for (const auto& output : node->outputs()) {
+        results.push_back(std::make_shared<ov::opset8::Result>(output));
+    }
+    return std::make_shared<ov::Model>(results, params, node->get_type_name());
+}
+
+namespace {
+
+std::string getImplementationTypes(const ov::CompiledModel& compiledModel) {
+    std::set<std::string> types;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        const auto layerType = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        const auto implType = rtInfo.find(ExecGraphInfoSerialization::IMPL_TYPE);
+        if (layerType == rtInfo.end() || implType == rtInfo.end()) {
+            continue;
+        }
+        const auto layer = layerType->second.as<std::string>();
+        if (layer == "Input" || layer == "Output") {
+            continue;
+        }
+        types.insert(layer + ":" + implType->second.as<std::string>());
+    }
+
+    std::string label;
+    for (const auto& type : types) {
+        label += (label.empty() ? "" : ",") + type;
+    }
+    return label;
+}
+
+void runNodeBenchmark(benchmark::State& state, const NodeBenchmarkCase& benchmarkCase) {
+    static ov::Core core;
+
+    ov::AnyMap config;
+    for (const auto& item : benchmarkCase.config) {
+        config.emplace(item.first, item.second);
+    }
+
+    ov::CompiledModel compiledModel;
+    try {
+        compiledModel = core.compile_model(benchmarkCase.createModel(), "CPU", config);
+    } catch (const std::exception& ex) {
+        state.SkipWithError(ex.what());
+        return;
+    }
+
+    auto request = compiledModel.create_infer_request();
+    double bytes = 0.0;
+    for (const auto& input : compiledModel.inputs()) {
+        const auto tensor = ov::test::utils::create_and_fill_tensor(input.get_element_type(), input.get_shape(), 10, 0, 100);
+        request.set_tensor(input, tensor);
+        bytes += tensor.get_byte_size();
+    }
+    // warm up run, it also defines the shapes of data dependent outputs (e.g. NMS)
+    request.infer();
+    for (const auto& output : compiledModel.outputs()) {
+        bytes += request.get_tensor(output).get_byte_size();
+    }
+
+    for (auto _ : state) {
+        request.infer();
+    }
+
+    const auto iterations = static_cast<double>(state.iterations());
+    state.counters["GB/s"] = benchmark::Counter(iterations * bytes * 1e-9, benchmark::Counter::kIsRate);
+    if (benchmarkCase.flops > 0.0) {
+        state.counters["GFLOPS"] = benchmark::Counter(iterations * benchmarkCase.flops * 1e-9, benchmark::Counter::kIsRate);
+    }
+    // data moved by the reorders between the nodes with different layouts, they are a part of the measured time
+    state.counters["reorder MB"] =
+        compiledModel.get_property(PluginConfigInternalParams::METRIC_CPU_REORDER_BYTES).as<uint64_t>() * 1e-6;
+    state.SetLabel(getImplementationTypes(compiledModel));
+}
+
+}  // namespace
+
+bool registerNodeBenchmark(const NodeBenchmarkCase& benchmarkCase) {
+    benchmark::RegisterBenchmark(benchmarkCase.name.c_str(), runNodeBenchmark, benchmarkCase)
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+    return true;
+}
+
+}  // namespace CPUNodeBenchmarks
+
+BENCHMARK_MAIN();
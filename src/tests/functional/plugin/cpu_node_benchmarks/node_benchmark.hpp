@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <openvino/core/model.hpp>
+#include <openvino/runtime/properties.hpp>
+
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace CPUNodeBenchmarks {
+
+/**
+ * Execution precision of the benchmarked model: the element type of the model inputs and the plugin configuration
+ * which selects the corresponding kernels (e.g. BF16 enforcement).
+ */
+struct Precision {
+    std::string name;
+    ov::element::Type type;
+    std::map<std::string, std::string> config;
+};
+
+const Precision& fp32();
+const Precision& bf16();
+const Precision& i32();
+const Precision& u8();
+
+/**
+ * Single-op model benchmark. The model is compiled by the CPU plugin once, then the synchronous inference is measured.
+ * Throughput is reported by the counters:
+ *  - GB/s: bytes of all input and output tensors per second;
+ *  - GFLOPS: 'flops' per second, the counter is omitted for the pure data movement nodes ('flops' is 0).
+ * The implementation types of the executed nodes (e.g. "MVN:jit_avx512_FP32") are reported as a label, so results of
+ * different ISA paths can be told apart.
+ */
+struct NodeBenchmarkCase {
+    std::string name;                                   // "<Node>/<shape>/<precision>[/<layout>]"
+    std::function<std::shared_ptr<ov::Model>()> createModel;
+    double flops;                                       // floating point operations per inference
+    std::map<std::string, std::string> config;
+};
+
+/// Registers the case in Google Benchmark, intended to be called during static initialization
+bool registerNodeBenchmark(const NodeBenchmarkCase& benchmarkCase);
+
+/// Runtime info which forces the memory format (e.g. nChw16c) of the data inputs and the output of the node
+CPUTestUtils::CPUTestsBase::CPUInfo makeLayoutInfo(CPUTestUtils::cpu_memory_format_t fmt, size_t dataInputs = 1);
+
+std::string shapeToString(const ov::Shape& shape);
+
+std::shared_ptr<ov::Model> makeModel(const std::shared_ptr<ov::Node>& node, const ov::ParameterVector& params);
+
+}  // namespace CPUNodeBenchmarks
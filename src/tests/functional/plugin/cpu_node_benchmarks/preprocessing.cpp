@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/core/preprocess/pre_post_process.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "node_benchmark.hpp"
+
+using namespace CPUNodeBenchmarks;
+
+namespace {
+
+/**
+ * Input preprocessing of a camera frame: 1080p NV12 image converted to BGR, resized to the network input, normalized
+ * and read by the first convolution. The unfused case runs ColorConvert, Interpolate and the eltwise nodes, the fused
+ * one runs FusedPreprocessing node (`CPU_PREPROCESSING_FUSION`). `reorder MB` shows the reorders of the output of
+ * the preprocessing to the layout of the convolution.
+ */
+bool registerPreprocessing() {
+    const size_t frameHeight = 1080;
+    const size_t frameWidth = 1920;
+    for (const size_t size : {224, 640}) {
+        for (const bool fused : {false, true}) {
+            registerNodeBenchmark({
+                "Preprocessing/NV12_" + std::to_string(frameWidth) + "x" + std::to_string(frameHeight) + "_to_" +
+                    std::to_string(size) + "x" + std::to_string(size) + "/" + (fused ? "Fused" : "Unfused"),
+                [=]() {
+                    auto params = ngraph::builder::makeParams(ov::element::f32, {{1, 3, size, size}});
+                    auto conv = ngraph::builder::makeConvolution(params[0], ov::element::f32, {1, 1}, {1, 1}, {0, 0},
+                                                                 {0, 0}, {1, 1}, ov::op::PadType::EXPLICIT, 16);
+                    auto model = makeModel(conv, params);
+
+                    ov::preprocess::PrePostProcessor p(model);
+                    p.input().tensor()
+                        .set_element_type(ov::element::u8)
+                        .set_color_format(ov::preprocess::ColorFormat::NV12_TWO_PLANES)
+                        .set_spatial_static_shape(frameHeight, frameWidth);
+                    p.input().preprocess()
+                        .convert_color(ov::preprocess::ColorFormat::BGR)
+                        .convert_layout()
+                        .convert_element_type(ov::element::f32)
+                        .resize(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR)
+                        .mean({123.675f, 116.28f, 103.53f})
+                        .scale(255.f);
+                    p.input().model().set_layout("NCHW");
+                    return p.build();
+                },
+                0.0,
+                {{InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO},
+                 {InferenceEngine::PluginConfigInternalParams::KEY_CPU_PREPROCESSING_FUSION,
+                  fused ? InferenceEngine::PluginConfigParams::YES : InferenceEngine::PluginConfigParams::NO}}});
+        }
+    }
+    return true;
+}
+
+const bool preprocessingRegistered = registerPreprocessing();
+
+}  // namespace
@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "base/ov_behavior_test_utils.hpp"
+#include "openvino/runtime/completion_queue.hpp"
+
+namespace ov {
+namespace test {
+namespace behavior {
+struct OVInferRequestCompletionQueueTests : public OVInferRequestTests {
+    static std::string getTestCaseName(const testing::TestParamInfo<InferRequestParams>& obj);
+    void SetUp() override;
+    void TearDown() override;
+    std::vector<ov::InferRequest> requests;
+    ov::CompletionQueue queue;
+};
+}  // namespace behavior
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "ie_core.hpp"
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include <multi-device/multi_device_config.hpp>
+
+TEST_P(MultiDevice_Test, canScheduleByExpectedLatency) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    std::map<std::string, std::string> config = {
+        {MULTI_CONFIG_KEY(SCHEDULING_POLICY), InferenceEngine::MultiDeviceConfigParams::MULTI_SCHEDULING_LATENCY}};
+    auto exec_net = ie->LoadNetwork(net, device_names, config);
+    ASSERT_EQ(exec_net.GetConfig(MULTI_CONFIG_KEY(SCHEDULING_POLICY)).as<std::string>(),
+              InferenceEngine::MultiDeviceConfigParams::MULTI_SCHEDULING_LATENCY);
+
+    const auto numRequests = exec_net.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (unsigned int i = 0; i < numRequests; i++)
+        requests.push_back(exec_net.CreateInferRequest());
+    const size_t numIterations = 4;
+    for (size_t i = 0; i < numIterations; i++) {
+        for (auto&& request : requests)
+            ASSERT_NO_THROW(request.StartAsync());
+        for (auto&& request : requests)
+            ASSERT_EQ(request.Wait(InferenceEngine::InferRequest::RESULT_READY), InferenceEngine::StatusCode::OK);
+    }
+
+    auto dispatched = exec_net.GetMetric(METRIC_KEY(MULTI_DEVICE_DISPATCHED_INFERENCES))
+                          .as<std::map<std::string, uint64_t>>();
+    auto latency = exec_net.GetMetric(METRIC_KEY(MULTI_DEVICE_INFERENCE_LATENCY)).as<std::map<std::string, float>>();
+    auto inFlight = exec_net.GetMetric(METRIC_KEY(MULTI_DEVICE_INFERENCES_IN_FLIGHT)).as<std::map<std::string, int>>();
+    uint64_t total = 0;
+    for (auto&& device : dispatched) {
+        total += device.second;
+        if (device.second > 0)
+            ASSERT_GT(latency[device.first], 0.f);
+        ASSERT_EQ(inFlight[device.first], 0);
+    }
+    ASSERT_EQ(total, numIterations * requests.size());
+}
+
+TEST_P(MultiDevice_Test, cannotLoadWithWrongSchedulingPolicy) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    std::map<std::string, std::string> config = {{MULTI_CONFIG_KEY(SCHEDULING_POLICY), "WRONG"}};
+    ASSERT_THROW(ie->LoadNetwork(net, device_names, config), InferenceEngine::Exception);
+}
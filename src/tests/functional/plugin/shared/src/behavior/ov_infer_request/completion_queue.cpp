@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <set>
+#include <thread>
+
+#include "behavior/ov_infer_request/completion_queue.hpp"
+
+namespace ov {
+namespace test {
+namespace behavior {
+
+namespace {
+constexpr size_t requestsNum = 8;
+}  // namespace
+
+std::string OVInferRequestCompletionQueueTests::getTestCaseName(const testing::TestParamInfo<InferRequestParams>& obj) {
+    return OVInferRequestTests::getTestCaseName(obj);
+}
+
+void OVInferRequestCompletionQueueTests::SetUp() {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    OVInferRequestTests::SetUp();
+    requests.resize(requestsNum);
+    for (size_t i = 0; i < requestsNum; i++) {
+        requests[i] = execNet.create_infer_request();
+        queue.bind(requests[i], &requests[i]);
+    }
+}
+
+void OVInferRequestCompletionQueueTests::TearDown() {
+    requests.clear();
+    OVInferRequestTests::TearDown();
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, canHarvestCompletionsOfAllRequests) {
+    for (auto& request : requests) {
+        OV_ASSERT_NO_THROW(request.start_async());
+    }
+    std::vector<ov::CompletionQueue::Completion> completions;
+    while (completions.size() < requestsNum) {
+        ov::CompletionQueue::Completion completion;
+        ASSERT_TRUE(queue.wait_any(completion));
+        completions.push_back(completion);
+        queue.poll(completions, requestsNum);
+    }
+    ASSERT_EQ(requestsNum, completions.size());
+    ASSERT_EQ(0, queue.size());
+    std::set<void*> tags;
+    for (const auto& completion : completions) {
+        ASSERT_EQ(nullptr, completion.exception);
+        tags.insert(completion.tag);
+    }
+    ASSERT_EQ(requestsNum, tags.size());
+    for (auto& request : requests) {
+        ASSERT_NE(tags.end(), tags.find(&request));
+        OV_ASSERT_NO_THROW(request.wait());
+    }
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, canRestartHarvestedRequests) {
+    const size_t inferencesNum = requestsNum * 10;
+    size_t started = 0;
+    for (auto& request : requests) {
+        OV_ASSERT_NO_THROW(request.start_async());
+        started++;
+    }
+    size_t completed = 0;
+    ov::CompletionQueue::Completion completion;
+    while (completed < inferencesNum) {
+        // the completion of the restarted request isn't lost, even if it ends before the previous callback returns
+        ASSERT_TRUE(queue.wait_any_for(completion, std::chrono::seconds{10}));
+        ASSERT_EQ(nullptr, completion.exception);
+        completed++;
+        auto& request = *static_cast<ov::InferRequest*>(completion.tag);
+        // the request is idle as soon as its completion is in the queue, it's restarted without wait
+        if (started < inferencesNum) {
+            OV_ASSERT_NO_THROW(request.start_async());
+            started++;
+        }
+    }
+    ASSERT_EQ(inferencesNum, completed);
+    for (auto& request : requests) {
+        OV_ASSERT_NO_THROW(request.wait());
+    }
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, syncInferDoesNotPushCompletion) {
+    OV_ASSERT_NO_THROW(requests.front().infer());
+    ov::CompletionQueue::Completion completion;
+    ASSERT_FALSE(queue.wait_any_for(completion, std::chrono::milliseconds{0}));
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, shutdownWakesUpWaitingThread) {
+    bool taken = true;
+    std::thread waiting{[&] {
+        ov::CompletionQueue::Completion completion;
+        taken = queue.wait_any(completion);
+    }};
+    queue.shutdown();
+    waiting.join();
+    ASSERT_FALSE(taken);
+}
+
+}  // namespace behavior
+}  // namespace test
+}  // namespace ov
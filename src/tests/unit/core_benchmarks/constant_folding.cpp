@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/constant_folding.hpp>
+#include <openvino/pass/manager.hpp>
+
+namespace {
+
+// Weights of a compressed model: f16 constants decompressed by Convert -> Multiply subgraphs before every MatMul
+std::shared_ptr<ov::Model> makeCompressedModel(size_t layers, size_t channels) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, channels});
+    std::shared_ptr<ov::Node> node = param;
+    for (size_t i = 0; i < layers; i++) {
+        auto weights = ov::opset8::Constant::create(ov::element::f16, {channels, channels}, {0.5f});
+        auto convert = std::make_shared<ov::opset8::Convert>(weights, ov::element::f32);
+        auto scale = ov::opset8::Constant::create(ov::element::f32, {channels, 1}, {0.25f});
+        auto multiply = std::make_shared<ov::opset8::Multiply>(convert, scale);
+        node = std::make_shared<ov::opset8::MatMul>(node, multiply, false, true);
+    }
+    return std::make_shared<ov::Model>(node, ov::ParameterVector{param});
+}
+
+/**
+ * ConstantFolding of the decompression subgraphs: the unlimited pass folds all of them, the budget of 1 MB keeps
+ * the larger ones in the model. The `bytes/s` counter is the folded weights bytes per second.
+ */
+void runConstantFolding(benchmark::State& state, size_t layers, size_t channels, size_t maxFoldedSize) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto model = makeCompressedModel(layers, channels);
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::ConstantFolding>(maxFoldedSize);
+        state.ResumeTiming();
+
+        manager.run_passes(model);
+        benchmark::DoNotOptimize(model.get());
+
+        state.PauseTiming();
+        model.reset();
+        state.ResumeTiming();
+    }
+    const auto foldedBytes = maxFoldedSize == 0 || channels * channels * sizeof(float) <= maxFoldedSize
+                                 ? layers * channels * channels * sizeof(float)
+                                 : 0;
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * foldedBytes));
+}
+
+bool registerConstantFolding() {
+    for (const size_t channels : {256, 1024, 4096}) {
+        for (const size_t maxFoldedSize : {size_t{0}, size_t{1} << 20}) {
+            const auto name = "ConstantFolding/Decompression/16x" + std::to_string(channels) + "x" +
+                              std::to_string(channels) + (maxFoldedSize == 0 ? "/Unlimited" : "/Budget1MB");
+            benchmark::RegisterBenchmark(name.c_str(), runConstantFolding, 16, channels, maxFoldedSize)
+                ->Unit(benchmark::kMillisecond);
+        }
+    }
+    return true;
+}
+
+const bool constantFoldingRegistered = registerConstantFolding();
+
+}  // namespace
@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/serialize.hpp>
+#include <openvino/runtime/core.hpp>
+
+namespace {
+
+// Model with many small layers, so the read time is dominated by the topology and not by the weights
+std::shared_ptr<ov::Model> makeManyLayersModel(size_t blocks) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 64, 16, 16});
+    std::shared_ptr<ov::Node> node = param;
+    for (size_t i = 0; i < blocks; i++) {
+        auto weights = ov::opset8::Constant::create(ov::element::f32, {64, 64, 1, 1}, {0.01f});
+        node = std::make_shared<ov::opset8::Convolution>(node,
+                                                         weights,
+                                                         ov::Strides{1, 1},
+                                                         ov::CoordinateDiff{0, 0},
+                                                         ov::CoordinateDiff{0, 0},
+                                                         ov::Strides{1, 1});
+        auto bias = ov::opset8::Constant::create(ov::element::f32, {1, 64, 1, 1}, {0.1f});
+        node = std::make_shared<ov::opset8::Add>(node, bias);
+        node = std::make_shared<ov::opset8::Relu>(node);
+    }
+    return std::make_shared<ov::Model>(node, ov::ParameterVector{param});
+}
+
+/**
+ * Read of the IR by ov::Core::read_model: from the .xml only, and from the binary topology section appended to
+ * the weights by ov::pass::Serialize. The model has `blocks` Convolution -> Add -> Relu blocks.
+ */
+void runIRRead(benchmark::State& state, size_t blocks, bool binaryTopology) {
+    const std::string name = "ov_core_benchmarks_ir_read_" + std::to_string(blocks) + (binaryTopology ? "_topo" : "");
+    const std::string xmlPath = name + ".xml";
+    const std::string binPath = name + ".bin";
+    ov::pass::Serialize(xmlPath, binPath, ov::pass::Serialize::Version::UNSPECIFIED, binaryTopology)
+        .run_on_model(makeManyLayersModel(blocks));
+
+    ov::Core core;
+    for (auto _ : state) {
+        auto model = core.read_model(xmlPath, binPath);
+        benchmark::DoNotOptimize(model.get());
+    }
+    state.counters["layers/s"] =
+        benchmark::Counter(static_cast<double>(state.iterations() * (blocks * 5 + 2)), benchmark::Counter::kIsRate);
+
+    std::remove(xmlPath.c_str());
+    std::remove(binPath.c_str());
+}
+
+bool registerIRRead() {
+    for (const size_t blocks : {100, 1000, 5000}) {
+        for (const bool binaryTopology : {false, true}) {
+            const auto name =
+                "IRRead/" + std::to_string(blocks) + "Blocks" + (binaryTopology ? "/BinaryTopology" : "/Xml");
+            benchmark::RegisterBenchmark(name.c_str(), runIRRead, blocks, binaryTopology)
+                ->Unit(benchmark::kMillisecond);
+        }
+    }
+    return true;
+}
+
+const bool irReadRegistered = registerIRRead();
+
+}  // namespace
@@ -0,0 +1,171 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <openvino/runtime/core.hpp>
+
+#include <low_precision/align_quantization_intervals.hpp>
+#include <low_precision/align_quantization_parameters.hpp>
+#include <low_precision/low_precision.hpp>
+#include <low_precision/markup_avg_pool_precision_preserved.hpp>
+#include <low_precision/markup_can_be_quantized.hpp>
+#include <low_precision/markup_per_tensor_quantization.hpp>
+#include <low_precision/markup_precisions.hpp>
+#include <low_precision/network_helper.hpp>
+#include <low_precision/propagate_precisions.hpp>
+
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace ngraph::pass::low_precision;
+
+namespace {
+
+// Convolution chain with a concatenation and a pooling in every block, so each markup pass has something to mark
+std::shared_ptr<Function> makeQuantizedModel(size_t depth) {
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 8, 32, 32});
+    Output<Node> parent = input;
+    auto fqOnData = [](const Output<Node>& in) {
+        return builder::makeFakeQuantize(in, element::f32, 256, {}, {0.f}, {2.55f}, {0.f}, {2.55f});
+    };
+    for (size_t i = 0; i < depth; ++i) {
+        const auto weights = opset1::Constant::create(element::f32, Shape{8, 8, 1, 1}, std::vector<float>(64, 1.f));
+        const auto fqOnWeights = builder::makeFakeQuantize(weights, element::f32, 255, {}, {-1.27f}, {1.27f}, {-1.27f}, {1.27f});
+        const auto convolution = std::make_shared<opset1::Convolution>(fqOnData(parent),
+                                                                       fqOnWeights,
+                                                                       Strides{1, 1},
+                                                                       CoordinateDiff{0, 0},
+                                                                       CoordinateDiff{0, 0},
+                                                                       Strides{1, 1});
+        const auto avgPool = std::make_shared<opset1::AvgPool>(convolution,
+                                                               Strides{1, 1},
+                                                               Shape{0, 0},
+                                                               Shape{0, 0},
+                                                               Shape{1, 1},
+                                                               true,
+                                                               op::RoundingType::FLOOR);
+        const auto concat = std::make_shared<opset1::Concat>(OutputVector{fqOnData(avgPool), fqOnData(convolution)}, 1);
+        const auto split = std::make_shared<opset1::VariadicSplit>(concat,
+                                                                   opset1::Constant::create(element::i64, Shape{}, {1}),
+                                                                   opset1::Constant::create(element::i64, Shape{2}, {8, 8}));
+        parent = split->output(0);
+    }
+    return std::make_shared<Function>(OutputVector{parent}, ParameterVector{input}, "QuantizedModel");
+}
+
+const std::vector<OperationPrecisionRestriction> precisionRestrictions = {
+    OperationPrecisionRestriction::create<opset1::Convolution>({{0, {element::u8}}, {1, {element::i8}}}),
+    OperationPrecisionRestriction::create<opset1::AvgPool>({{0, {element::u8}}}),
+};
+
+const std::vector<OperationPerTensorQuantizationRestriction> quantizationRestrictions = {
+    OperationPerTensorQuantizationRestriction::create<opset1::Convolution>({0})
+};
+
+using ModelFactory = std::function<std::shared_ptr<Function>()>;
+using Stage = std::function<void(pass::Manager&)>;
+
+/**
+ * A stage of LPT pipeline on a fresh copy of the model. The model is created outside of the measured time.
+ */
+void runStage(benchmark::State& state, const ModelFactory& makeModel, const Stage& stage) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        const auto model = makeModel();
+        pass::Manager manager;
+        stage(manager);
+        state.ResumeTiming();
+
+        manager.run_passes(model);
+
+        state.PauseTiming();
+        benchmark::DoNotOptimize(model.get());
+        state.ResumeTiming();
+    }
+}
+
+/**
+ * NetworkHelper::getDequantization for every input of every operation of the model transformed by LPT: the lookup
+ * which the transformations repeat for the same nodes. The `lookups/s` counter is the number of the lookups per
+ * second.
+ */
+void runGetDequantization(benchmark::State& state, const ModelFactory& makeModel) {
+    const auto model = makeModel();
+    {
+        pass::Manager manager;
+        manager.register_pass<LowPrecision>(precisionRestrictions, quantizationRestrictions);
+        manager.run_passes(model);
+    }
+    const auto ops = model->get_ordered_ops();
+    size_t lookups = 0;
+    for (auto _ : state) {
+        for (const auto& op : ops) {
+            for (size_t i = 0; i < op->get_input_size(); ++i) {
+                auto dequantization = NetworkHelper::getDequantization(op, i);
+                benchmark::DoNotOptimize(dequantization);
+                lookups++;
+            }
+        }
+    }
+    state.counters["lookups/s"] = benchmark::Counter(static_cast<double>(lookups), benchmark::Counter::kIsRate);
+}
+
+bool registerLowPrecision() {
+    // INT8 IR models can be provided by LPT_BENCHMARK_MODELS environment variable (paths separated by ';')
+    std::vector<std::pair<std::string, ModelFactory>> models;
+    for (const size_t depth : {8, 64, 256}) {
+        models.emplace_back("Generated" + std::to_string(depth), [depth]() { return makeQuantizedModel(depth); });
+    }
+    if (const char* modelPaths = std::getenv("LPT_BENCHMARK_MODELS")) {
+        std::stringstream stream(modelPaths);
+        std::string path;
+        while (std::getline(stream, path, ';')) {
+            if (!path.empty()) {
+                models.emplace_back(path, [path]() { return ov::Core().read_model(path); });
+            }
+        }
+    }
+
+    const std::vector<std::pair<std::string, Stage>> stages = {
+        {"TypeRelaxedReplacer", [](pass::Manager& manager) { manager.register_pass<TypeRelaxedReplacer>(); }},
+        {"MarkupSequential", [](pass::Manager& manager) {
+            manager.register_pass<MarkupCanBeQuantized>();
+            manager.register_pass<MarkupPrecisions>(precisionRestrictions);
+            manager.register_pass<MarkupPerTensorQuantization>(quantizationRestrictions);
+            manager.register_pass<MarkupAvgPoolPrecisionPreserved>();
+            manager.register_pass<PropagatePrecisions>();
+            manager.register_pass<AlignQuantizationIntervals>();
+            manager.register_pass<AlignQuantizationParameters>();
+        }},
+        {"MarkupOptimizations", [](pass::Manager& manager) {
+            manager.register_pass<MarkupOptimizations>(precisionRestrictions, quantizationRestrictions);
+        }},
+        {"LowPrecision", [](pass::Manager& manager) {
+            manager.register_pass<LowPrecision>(precisionRestrictions, quantizationRestrictions);
+        }},
+    };
+
+    for (const auto& model : models) {
+        for (const auto& stage : stages) {
+            benchmark::RegisterBenchmark(("LPT/" + stage.first + "/" + model.first).c_str(), runStage, model.second, stage.second)
+                ->Unit(benchmark::kMillisecond);
+        }
+        benchmark::RegisterBenchmark(("LPT/GetDequantization/" + model.first).c_str(), runGetDequantization, model.second)
+            ->Unit(benchmark::kMicrosecond);
+    }
+    return true;
+}
+
+const bool lowPrecisionRegistered = registerLowPrecision();
+
+}  // namespace
@@ -0,0 +1,7 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
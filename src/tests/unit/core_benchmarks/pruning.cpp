@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/constant_folding.hpp>
+#include <openvino/pass/manager.hpp>
+#include <pruning.hpp>
+
+namespace {
+
+// Weights with zero output channels (dim 0) or output neurons (the last dim) in every `step`-th position
+std::shared_ptr<ov::Node> makeWeights(const ov::Shape& shape, size_t zeroDim, size_t step) {
+    std::vector<float> values(ov::shape_size(shape), 1.f);
+    size_t inner = 1;
+    for (size_t dim = zeroDim + 1; dim < shape.size(); ++dim) {
+        inner *= shape[dim];
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+        if ((i / inner) % shape[zeroDim] % step == 0) {
+            values[i] = 0.f;
+        }
+    }
+    return ov::opset8::Constant::create(ov::element::f32, shape, values);
+}
+
+// Convolution chain, every second filter of each Convolution is zero
+std::shared_ptr<ov::Model> makeConvolutionModel(size_t depth) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 64, 56, 56});
+    std::shared_ptr<ov::Node> node = param;
+    for (size_t i = 0; i < depth; i++) {
+        node = std::make_shared<ov::opset8::Convolution>(node,
+                                                         makeWeights({64, 64, 3, 3}, 0, 2),
+                                                         ov::Strides{1, 1},
+                                                         ov::CoordinateDiff{1, 1},
+                                                         ov::CoordinateDiff{1, 1},
+                                                         ov::Strides{1, 1});
+        node = std::make_shared<ov::opset8::Relu>(node);
+    }
+    return std::make_shared<ov::Model>(node, ov::ParameterVector{param});
+}
+
+// Feed forward blocks of a transformer, every fourth neuron of the first MatMul of each block is zero
+std::shared_ptr<ov::Model> makeFeedForwardModel(size_t depth) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 128, 256});
+    std::shared_ptr<ov::Node> node = param;
+    for (size_t i = 0; i < depth; i++) {
+        auto fc1 = std::make_shared<ov::opset8::MatMul>(node, makeWeights({256, 1024}, 1, 4));
+        auto relu = std::make_shared<ov::opset8::Relu>(fc1);
+        auto weights2 = ov::opset8::Constant::create(ov::element::f32, {1024, 256}, {1.f});
+        auto fc2 = std::make_shared<ov::opset8::MatMul>(relu, weights2);
+        node = std::make_shared<ov::opset8::Add>(fc2, node);
+    }
+    return std::make_shared<ov::Model>(node, ov::ParameterVector{param});
+}
+
+// Floating point operations of Convolutions and MatMuls (multiply and add)
+double countFlops(const std::shared_ptr<ov::Model>& model) {
+    double flops = 0;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (ov::is_type<ov::opset8::Convolution>(op)) {
+            const auto& weightsShape = op->get_input_shape(1);
+            flops += 2. * ov::shape_size(op->get_output_shape(0)) * ov::shape_size(weightsShape) / weightsShape[0];
+        } else if (ov::is_type<ov::opset8::MatMul>(op)) {
+            const auto& shape = op->get_input_shape(0);
+            const auto inner = ov::as_type_ptr<ov::opset8::MatMul>(op)->get_transpose_a() ? shape[shape.size() - 2]
+                                                                                           : shape.back();
+            flops += 2. * ov::shape_size(op->get_output_shape(0)) * inner;
+        }
+    }
+    return flops;
+}
+
+double countWeights(const std::shared_ptr<ov::Model>& model) {
+    double weights = 0;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (ov::is_type<ov::opset8::Constant>(op)) {
+            weights += static_cast<double>(ov::shape_size(op->get_output_shape(0)));
+        }
+    }
+    return weights;
+}
+
+void prune(const std::shared_ptr<ov::Model>& model) {
+    ov::pass::Manager manager;
+    manager.register_pass<ngraph::pass::Pruning>();
+    manager.register_pass<ov::pass::ConstantFolding>();
+    manager.run_passes(model);
+}
+
+/**
+ * ngraph::pass::Pruning of the model with zero filters (neurons) followed by ConstantFolding of the shrunk weights.
+ * The counters report the floating point operations of Convolutions and MatMuls (`MFLOP`) and the number of
+ * the weights before and after the pruning.
+ */
+void runPruning(benchmark::State& state, const std::function<std::shared_ptr<ov::Model>()>& makeModel) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto model = makeModel();
+        state.ResumeTiming();
+
+        prune(model);
+        benchmark::DoNotOptimize(model.get());
+
+        state.PauseTiming();
+        model.reset();
+        state.ResumeTiming();
+    }
+
+    auto model = makeModel();
+    state.counters["MFLOP before"] = countFlops(model) / 1e6;
+    state.counters["weights before"] = countWeights(model);
+    prune(model);
+    state.counters["MFLOP after"] = countFlops(model) / 1e6;
+    state.counters["weights after"] = countWeights(model);
+}
+
+bool registerPruning() {
+    for (const size_t depth : {4, 16}) {
+        benchmark::RegisterBenchmark(("Pruning/Convolution/" + std::to_string(depth) + "Layers").c_str(),
+                                     runPruning,
+                                     [depth]() { return makeConvolutionModel(depth); })
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("Pruning/FeedForward/" + std::to_string(depth) + "Blocks").c_str(),
+                                     runPruning,
+                                     [depth]() { return makeFeedForwardModel(depth); })
+            ->Unit(benchmark::kMillisecond);
+    }
+    return true;
+}
+
+const bool pruningRegistered = registerPruning();
+
+}  // namespace
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/serialize.hpp>
+
+namespace {
+
+// Constants of the given total size: `count` constants, the half of them are duplicates of the other half if
+// `duplicates` is set, so the writer deduplicates them
+std::shared_ptr<ov::Model> makeConstantsModel(size_t totalSize, size_t count, bool duplicates) {
+    const size_t elements = totalSize / count / sizeof(float);
+    ov::NodeVector constants;
+    for (size_t i = 0; i < count; i++) {
+        const float value = static_cast<float>(duplicates ? i / 2 : i);
+        constants.push_back(std::make_shared<ov::opset8::Constant>(ov::element::f32,
+                                                                   ov::Shape{elements},
+                                                                   std::vector<float>(elements, value)));
+    }
+    return std::make_shared<ov::Model>(constants, ov::ParameterVector{});
+}
+
+/**
+ * ov::pass::Serialize of the model with constants only: the time is spent on hashing of the constants for the
+ * deduplication and on writing of the weights. The `bytes/s` counter is the size of the constants per second.
+ */
+void runSerialize(benchmark::State& state, size_t totalSize, size_t count, bool duplicates) {
+    const auto model = makeConstantsModel(totalSize, count, duplicates);
+    const std::string xmlPath = "ov_core_benchmarks_serialize.xml";
+    const std::string binPath = "ov_core_benchmarks_serialize.bin";
+    for (auto _ : state) {
+        ov::pass::Serialize(xmlPath, binPath).run_on_model(model);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * totalSize));
+
+    std::remove(xmlPath.c_str());
+    std::remove(binPath.c_str());
+}
+
+bool registerSerialize() {
+    for (const size_t totalSize : {size_t{64} << 20, size_t{512} << 20}) {
+        for (const size_t count : {16, 4096}) {
+            for (const bool duplicates : {false, true}) {
+                const auto name = "Serialize/" + std::to_string(totalSize >> 20) + "MB/" + std::to_string(count) +
+                                  "Constants" + (duplicates ? "/Duplicates" : "/Unique");
+                benchmark::RegisterBenchmark(name.c_str(), runSerialize, totalSize, count, duplicates)
+                    ->Unit(benchmark::kMillisecond)
+                    ->UseRealTime();
+            }
+        }
+    }
+    return true;
+}
+
+const bool serializeRegistered = registerSerialize();
+
+}  // namespace
@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_system_conf.h>
+#include "utils/memory_allocator.h"
+#include "utils/numa_utils.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+MemoryAllocator::Ptr makeAllocator(MemoryAllocator::HugePages hugePages, bool pool) {
+    MemoryAllocator::Config config;
+    config.hugePages = hugePages;
+    config.pool = pool;
+    return std::make_shared<MemoryAllocator>(config);
+}
+
+bool isAligned(const std::shared_ptr<void>& ptr, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(ptr.get()) % alignment == 0;
+}
+} // namespace
+
+TEST(MemoryAllocatorTests, SizeClasses) {
+    ASSERT_EQ(MemoryAllocator::getSizeClass(1), 64);
+    ASSERT_EQ(MemoryAllocator::getSizeClass(64), 64);
+    ASSERT_EQ(MemoryAllocator::getSizeClass(65), 80);
+    ASSERT_EQ(MemoryAllocator::getSizeClass(1000), 1024);
+    ASSERT_EQ(MemoryAllocator::getSizeClass(1025), 1280);
+    ASSERT_EQ(MemoryAllocator::getSizeClass(1280), 1280);
+    ASSERT_EQ(MemoryAllocator::getSizeClass(1281), 1536);
+
+    for (size_t size = 1; size < (1ul << 20); size = size * 3 / 2 + 1) {
+        const auto sizeClass = MemoryAllocator::getSizeClass(size);
+        ASSERT_GE(sizeClass, size);
+        ASSERT_LE(sizeClass, size < 64 ? 64 : size + size / 4);
+    }
+}
+
+TEST(MemoryAllocatorTests, PoolReusesReleasedBuffers) {
+    auto allocator = makeAllocator(MemoryAllocator::HugePages::Disabled, true);
+
+    void* released = nullptr;
+    {
+        auto buffer = allocator->allocate(1000, MemoryAllocator::Lifetime::Transient);
+        ASSERT_TRUE(isAligned(buffer, 64));
+        std::memset(buffer.get(), 1, 1000);
+        released = buffer.get();
+    }
+    auto stats = allocator->getStats();
+    ASSERT_EQ(stats["pool_misses"], 1);
+    ASSERT_EQ(stats["pool_cached_bytes"], 1024);
+    ASSERT_EQ(stats["transient_bytes"], 0);
+
+    // the size of the same class is served by the released buffer
+    auto buffer = allocator->allocate(1024, MemoryAllocator::Lifetime::Transient);
+    ASSERT_EQ(buffer.get(), released);
+    stats = allocator->getStats();
+    ASSERT_EQ(stats["pool_hits"], 1);
+    ASSERT_EQ(stats["pool_cached_bytes"], 0);
+    ASSERT_EQ(stats["transient_bytes"], 1024);
+
+    auto other = allocator->allocate(2000, MemoryAllocator::Lifetime::Transient);
+    ASSERT_EQ(allocator->getStats()["pool_misses"], 2);
+}
+
+TEST(MemoryAllocatorTests, BuffersKeepAllocatorAlive) {
+    auto allocator = makeAllocator(MemoryAllocator::HugePages::Disabled, true);
+    auto buffer = allocator->allocate(100, MemoryAllocator::Lifetime::Transient);
+    std::weak_ptr<MemoryAllocator> weakAllocator = allocator;
+    allocator.reset();
+    ASSERT_FALSE(weakAllocator.expired());
+    buffer.reset();
+    ASSERT_TRUE(weakAllocator.expired());
+}
+
+TEST(MemoryAllocatorTests, PersistentBuffers) {
+    auto allocator = makeAllocator(MemoryAllocator::HugePages::Disabled, false);
+    ASSERT_EQ(allocator->allocate(0, MemoryAllocator::Lifetime::Persistent), nullptr);
+    {
+        auto buffer = allocator->allocate(4096, MemoryAllocator::Lifetime::Persistent);
+        ASSERT_TRUE(isAligned(buffer, 64));
+        std::memset(buffer.get(), 1, 4096);
+        auto stats = allocator->getStats();
+        ASSERT_EQ(stats["persistent_bytes"], 4096);
+        ASSERT_EQ(stats["huge_pages_bytes"], 0);
+        ASSERT_EQ(stats["transparent_huge_pages_bytes"], 0);
+    }
+    ASSERT_EQ(allocator->getStats()["persistent_bytes"], 0);
+}
+
+TEST(MemoryAllocatorTests, HugePagesOrFallback) {
+    constexpr size_t size = (4ul << 20) + 123;
+    for (auto hugePages : {MemoryAllocator::HugePages::Transparent,
+                           MemoryAllocator::HugePages::Explicit2M,
+                           MemoryAllocator::HugePages::Explicit1G}) {
+        auto allocator = makeAllocator(hugePages, false);
+        {
+            auto buffer = allocator->allocate(size, MemoryAllocator::Lifetime::Persistent);
+            ASSERT_TRUE(isAligned(buffer, 64));
+            std::memset(buffer.get(), 1, size);
+
+            // the hugetlbfs pool and transparent huge pages depend on the system settings, so any of the mappings
+            // is accepted, but the buffer must be accounted
+            auto stats = allocator->getStats();
+            ASSERT_GE(stats["persistent_bytes"], size);
+            ASSERT_LE(stats["huge_pages_bytes"] + stats["transparent_huge_pages_bytes"], stats["persistent_bytes"]);
+        }
+        auto stats = allocator->getStats();
+        ASSERT_EQ(stats["persistent_bytes"], 0);
+        ASSERT_EQ(stats["huge_pages_bytes"], 0);
+        ASSERT_EQ(stats["transparent_huge_pages_bytes"], 0);
+    }
+}
+
+TEST(MemoryAllocatorTests, Scope) {
+    ASSERT_EQ(MemoryAllocator::allocateInScope(100), nullptr);
+
+    auto allocator = makeAllocator(MemoryAllocator::HugePages::Disabled, true);
+    {
+        MemoryAllocator::Scope scope{allocator, MemoryAllocator::Lifetime::Transient};
+        auto buffer = MemoryAllocator::allocateInScope(100);
+        ASSERT_NE(buffer, nullptr);
+        ASSERT_EQ(allocator->getStats()["transient_bytes"], MemoryAllocator::getSizeClass(100));
+        {
+            // the null allocator disables the allocations in the nested scope
+            MemoryAllocator::Scope nested{nullptr, MemoryAllocator::Lifetime::Persistent};
+            ASSERT_EQ(MemoryAllocator::allocateInScope(100), nullptr);
+        }
+        ASSERT_NE(MemoryAllocator::allocateInScope(100), nullptr);
+    }
+    ASSERT_EQ(MemoryAllocator::allocateInScope(100), nullptr);
+}
+
+TEST(MemoryAllocatorTests, PersistentBuffersAreBoundToNumaNode) {
+    constexpr size_t size = (4ul << 20) + 123;
+    const int numaNodeId = InferenceEngine::getAvailableNUMANodes().front();
+    for (auto hugePages : {MemoryAllocator::HugePages::Transparent,
+                           MemoryAllocator::HugePages::Explicit2M,
+                           MemoryAllocator::HugePages::Explicit1G}) {
+        auto allocator = makeAllocator(hugePages, false);
+        {
+            MemoryAllocator::Scope scope{allocator, MemoryAllocator::Lifetime::Persistent, numaNodeId};
+            auto buffer = MemoryAllocator::allocateInScope(size);
+            std::memset(buffer.get(), 1, size);
+
+            // binding may be unsupported by the platform or forbidden by the process policy (e.g. numactl --membind)
+            auto stats = allocator->getStats();
+            if (stats["numa_bind_failures"] != 0)
+                continue;
+            // the whole mapping is bound, whichever pages back it
+            ASSERT_EQ(stats["numa_bound_bytes"], stats["persistent_bytes"]);
+
+            std::map<int, uint64_t> residentBytes;
+            collectNumaNodesResidentBytes(buffer.get(), size, residentBytes);
+            if (residentBytes.count(-1) == 0) {
+                ASSERT_EQ(residentBytes[numaNodeId], size);
+            }
+        }
+        ASSERT_EQ(allocator->getStats()["numa_bound_bytes"], 0);
+    }
+}
+
+TEST(MemoryAllocatorTests, BuffersOutOfNumaScopeAreNotBound) {
+    auto allocator = makeAllocator(MemoryAllocator::HugePages::Transparent, false);
+    MemoryAllocator::Scope scope{allocator, MemoryAllocator::Lifetime::Persistent};
+    auto buffer = MemoryAllocator::allocateInScope(4ul << 20);
+    auto stats = allocator->getStats();
+    ASSERT_EQ(stats["numa_bound_bytes"], 0);
+    ASSERT_EQ(stats["numa_bind_failures"], 0);
+}
@@ -13,8 +13,10 @@
 #include <ngraph_transformations/op/fully_connected.hpp>
 #include <ngraph_transformations/convert_matmul_to_fc.hpp>
 #include <ngraph_transformations/fc_bias_fusion.hpp>
+#include <ngraph_transformations/mark_fc_weights_decompression.hpp>
 #include <transformations/init_node_info.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <ngraph/pass/manager.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -509,3 +511,99 @@ TEST(TransformationTests, ConvertMatMulToFCTest_second_input_rank_adj_3) {
     auto res = compare_functions(f, f_ref, true);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_transpose_b) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 4, 8 }, { 3 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zero_points = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 1 }, { 1 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_points);
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 1 }, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scales);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MarkFCWeightsDecompression>();
+        m.register_pass<ConvertMatMulToFC>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+        ASSERT_TRUE(ov::pass::constant_folding_is_disabled(convert));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 4, 8 }, { 3 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zero_points = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 1 }, { 1 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_points);
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 1 }, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scales);
+        auto fc = std::make_shared<FullyConnectedNode>(input1, multiply, ngraph::Rank(2));
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ fc }, ngraph::ParameterVector{ input1 });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_no_transpose_b) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 8, 4 }, { -3 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4 }, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scales);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, false);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MarkFCWeightsDecompression>();
+        m.register_pass<ConvertMatMulToFC>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 4, 8 }, { -3 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 1 }, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scales);
+        auto fc = std::make_shared<FullyConnectedNode>(input1, multiply, ngraph::Rank(2));
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ fc }, ngraph::ParameterVector{ input1 });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_not_marked) {
+    auto create_function = []() {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 4, 8 }, { 3 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 1 }, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scales);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, true);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    };
+
+    std::shared_ptr<ngraph::Function> f = create_function(), f_ref = create_function();
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<ConvertMatMulToFC>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
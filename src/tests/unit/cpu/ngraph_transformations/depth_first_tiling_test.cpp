@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include <ngraph_transformations/depth_first_tiling.hpp>
+
+using namespace testing;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> makeConvolutionChain() {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8, 64, 64});
+    auto makeConvolution = [](const ngraph::Output<ngraph::Node>& data) {
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{8, 8, 3, 3}, {0.1f});
+        return std::make_shared<ngraph::opset1::Convolution>(data, weights, ngraph::Strides{1, 1},
+                                                             ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                             ngraph::Strides{1, 1});
+    };
+    auto conv1 = makeConvolution(input);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv1);
+    auto conv2 = makeConvolution(relu);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{conv2}, ngraph::ParameterVector{input});
+}
+
+}  // namespace
+
+TEST(TransformationTests, DepthFirstTilingSplitsChain) {
+    auto f = makeConvolutionChain();
+
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    // 3 tensors of 128KB need 6 bands of 64KB
+    m.register_pass<MKLDNNPlugin::DepthFirstTiling>(64 * 1024);
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    size_t convolutions = 0;
+    std::vector<std::shared_ptr<ngraph::opset1::Concat>> concats;
+    for (const auto& node : f->get_ops()) {
+        if (auto conv = ngraph::as_type_ptr<ngraph::opset1::Convolution>(node)) {
+            convolutions++;
+            const auto& inputShape = conv->get_input_shape(0);
+            const auto& outputShape = conv->get_output_shape(0);
+            // the band padding is kept only at the borders of the image
+            ASSERT_EQ(inputShape[2] + conv->get_pads_begin()[0] + conv->get_pads_end()[0] - 2, outputShape[2]);
+        } else if (auto concat = ngraph::as_type_ptr<ngraph::opset1::Concat>(node)) {
+            concats.push_back(concat);
+        }
+    }
+    ASSERT_EQ(convolutions, 12);
+    ASSERT_EQ(concats.size(), 1);
+    ASSERT_EQ(concats[0]->get_axis(), 2);
+    ASSERT_EQ(f->get_results()[0]->get_input_shape(0), (ngraph::Shape{1, 8, 64, 64}));
+}
+
+TEST(TransformationTests, DepthFirstTilingChainFitsCache) {
+    auto f = makeConvolutionChain();
+    auto f_ref = makeConvolutionChain();
+
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<MKLDNNPlugin::DepthFirstTiling>(16 * 1024 * 1024);
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
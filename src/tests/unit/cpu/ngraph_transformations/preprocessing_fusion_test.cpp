@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include <ngraph_transformations/preprocessing_fusion.hpp>
+#include <ngraph_transformations/op/fused_preprocessing.hpp>
+
+using namespace testing;
+
+TEST(TransformationTests, PreprocessingFusionNV12ResizeMeanScale) {
+    const std::vector<float> mean{123.675f, 116.28f, 103.53f};
+    const std::vector<float> scale{58.395f, 57.12f, 57.375f};
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto y = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{1, 480, 640, 1});
+        auto uv = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{1, 240, 320, 2});
+        auto color = std::make_shared<ngraph::opset8::NV12toBGR>(y, uv);
+        auto convert = std::make_shared<ngraph::opset1::Convert>(color, ngraph::element::f32);
+
+        ngraph::opset4::Interpolate::InterpolateAttrs attrs;
+        attrs.mode = ngraph::opset4::Interpolate::InterpolateMode::LINEAR;
+        attrs.shape_calculation_mode = ngraph::opset4::Interpolate::ShapeCalcMode::SIZES;
+        attrs.pads_begin = {0, 0, 0, 0};
+        attrs.pads_end = {0, 0, 0, 0};
+        auto sizes = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {224, 224});
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{2}, {1.f, 1.f});
+        auto axes = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 2});
+        auto resize = std::make_shared<ngraph::opset4::Interpolate>(convert, sizes, scales, axes, attrs);
+
+        auto meanConst = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 1, 3}, mean);
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(resize, meanConst);
+        auto scaleConst = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 1, 3}, scale);
+        auto divide = std::make_shared<ngraph::opset1::Divide>(subtract, scaleConst);
+        auto order = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 3, 1, 2});
+        auto transpose = std::make_shared<ngraph::opset1::Transpose>(divide, order);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(transpose);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{y, uv});
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MKLDNNPlugin::PreprocessingFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto y = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{1, 480, 640, 1});
+        auto uv = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{1, 240, 320, 2});
+
+        MKLDNNPlugin::FusedPreprocessingNode::Attributes attrs;
+        attrs.colorFormat = MKLDNNPlugin::FusedPreprocessingNode::ColorFormat::NV12_TO_BGR;
+        attrs.roundColor = true;
+        attrs.inputChannelsLast = true;
+        attrs.resizeMode = MKLDNNPlugin::FusedPreprocessingNode::ResizeMode::LINEAR;
+        attrs.outputHeight = 224;
+        attrs.outputWidth = 224;
+        attrs.scale.clear();
+        attrs.shift.clear();
+        for (size_t c = 0; c < 3; c++) {
+            attrs.scale.push_back(1.f / scale[c]);
+            attrs.shift.push_back(-mean[c] / scale[c]);
+        }
+        attrs.outputChannelsLast = false;
+        auto preprocessing = std::make_shared<MKLDNNPlugin::FusedPreprocessingNode>(ngraph::OutputVector{y, uv}, attrs);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(preprocessing);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{y, uv});
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, PreprocessingFusionWithoutResize) {
+    const ngraph::Shape shape{1, 3, 224, 224};
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto makeFunction = [&]() {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, shape);
+        auto convert = std::make_shared<ngraph::opset1::Convert>(input, ngraph::element::f32);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1}, {0.1f, 0.2f, 0.3f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(multiply);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input});
+    };
+    {
+        f = makeFunction();
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MKLDNNPlugin::PreprocessingFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    f_ref = makeFunction();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
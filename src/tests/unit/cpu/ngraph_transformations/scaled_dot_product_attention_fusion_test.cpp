@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include <ngraph_transformations/scaled_dot_product_attention_fusion.hpp>
+#include <ngraph_transformations/op/scaled_dot_product_attention.hpp>
+
+using namespace testing;
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionWithMask) {
+    const ngraph::Shape qkvShape{2, 4, 16, 32};
+    const ngraph::Shape maskShape{2, 1, 1, 16};
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, qkvShape);
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, qkvShape);
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, qkvShape);
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, maskShape);
+        auto scores = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {8.f});
+        auto scaled = std::make_shared<ngraph::opset1::Divide>(scores, scale);
+        auto masked = std::make_shared<ngraph::opset1::Add>(mask, scaled);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(masked, 3);
+        auto attention = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, ngraph::ParameterVector{query, key, value, mask});
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MKLDNNPlugin::ScaledDotProductAttentionFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, qkvShape);
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, qkvShape);
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, qkvShape);
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, maskShape);
+        auto attention = std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(
+            ngraph::OutputVector{query, key, value, mask}, 0.125f, true);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, ngraph::ParameterVector{query, key, value, mask});
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionNotLastAxis) {
+    const ngraph::Shape qkvShape{1, 16, 16};
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto makeFunction = [&]() {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, qkvShape);
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, qkvShape);
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, qkvShape);
+        auto scores = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, 1);
+        auto attention = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, ngraph::ParameterVector{query, key, value});
+    };
+    f = makeFunction();
+    f_ref = makeFunction();
+
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<MKLDNNPlugin::ScaledDotProductAttentionFusion>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_system_conf.h>
+#include "utils/numa_utils.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+uint64_t totalBytes(const std::map<int, uint64_t>& residentBytes) {
+    return std::accumulate(residentBytes.begin(), residentBytes.end(), uint64_t{0},
+                           [](uint64_t sum, const std::pair<const int, uint64_t>& node) { return sum + node.second; });
+}
+} // namespace
+
+TEST(NumaUtilsTests, ResidentBytesOfTouchedMemory) {
+    constexpr size_t size = 1024 * 1024 + 123;
+    std::vector<uint8_t> buffer(size);
+    std::memset(buffer.data(), 1, size);
+
+    std::map<int, uint64_t> residentBytes;
+    collectNumaNodesResidentBytes(buffer.data() + 1, size - 1, residentBytes);
+    ASSERT_EQ(totalBytes(residentBytes), size - 1);
+}
+
+TEST(NumaUtilsTests, BindToAvailableNumaNodes) {
+    constexpr size_t size = 4 * 1024 * 1024;
+    std::vector<uint8_t> buffer(size);
+
+    for (auto numaNodeId : InferenceEngine::getAvailableNUMANodes()) {
+        std::memset(buffer.data(), numaNodeId, size);
+        // binding may be unsupported by the platform or forbidden by the process policy (e.g. numactl --membind)
+        if (!bindToNumaNode(buffer.data(), size, numaNodeId))
+            continue;
+
+        std::map<int, uint64_t> residentBytes;
+        collectNumaNodesResidentBytes(buffer.data(), size, residentBytes);
+        ASSERT_EQ(totalBytes(residentBytes), size);
+        if (residentBytes.count(-1))
+            continue;
+        // the bound range consists of whole pages inside the buffer, so the most of bytes must be on the node
+        ASSERT_GT(residentBytes[numaNodeId], size / 2);
+        ASSERT_TRUE(std::all_of(buffer.begin(), buffer.end(), [&](uint8_t v) { return v == static_cast<uint8_t>(numaNodeId); }));
+    }
+}
+
+TEST(NumaUtilsTests, InvalidArguments) {
+    std::vector<uint8_t> buffer(16);
+    ASSERT_FALSE(bindToNumaNode(nullptr, 4096, 0));
+    ASSERT_FALSE(bindToNumaNode(buffer.data(), buffer.size(), -1));
+
+    std::map<int, uint64_t> residentBytes;
+    collectNumaNodesResidentBytes(nullptr, 4096, residentBytes);
+    ASSERT_TRUE(residentBytes.empty());
+}
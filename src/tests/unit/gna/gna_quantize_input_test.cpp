@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "preprocessing.hpp"
+#include "runtime/quantize_input.hpp"
+
+using namespace GNAPluginNS;
+
+namespace {
+
+// num_frames, num_group, num_vector_elements, num_vector_stride, interleaved, low_precision
+using QuantizeInputParams = std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, bool, bool>;
+
+// The scalar conversion of the plugin which QuantizeInput must reproduce bit exactly
+template <typename T>
+std::vector<T> Reference(const std::vector<float>& src,
+                         uint32_t num_frames, uint32_t num_group,
+                         uint32_t num_vector_elements, uint32_t num_vector_stride,
+                         bool interleaved, float scale_factor) {
+    std::vector<T> dst(num_group * num_vector_stride, 0);
+    for (uint32_t i = 0; i < num_frames; i++) {
+        for (uint32_t j = 0; j < num_vector_elements; j++) {
+            const float value = src[i * num_vector_elements + j] * scale_factor;
+            const T quantized = sizeof(T) == 1 ? static_cast<T>(ConvertFloatToInt8(value))
+                                               : static_cast<T>(ConvertFloatToInt16(value));
+            dst[interleaved ? j * num_group + i : i * num_vector_stride + j] = quantized;
+        }
+    }
+    return dst;
+}
+
+// Values which hit the rounding and the saturation: the half-way values (and their float neighbours) for
+// the unit scale factor, the values beyond the limits of int8 and int16, zeros and the random ones
+std::vector<float> MakeInput(size_t size) {
+    const std::vector<float> special = {0.5f, -0.5f, 1.5f, -1.5f, 2.5f, -2.5f, 126.5f, -127.5f, 127.5f, -128.5f,
+                                        32766.5f, -32767.5f, 32767.5f, -32768.5f, 1e6f, -1e6f, 0.f, -0.f,
+                                        std::nextafter(0.5f, 0.f), std::nextafter(0.5f, 1.f),
+                                        std::nextafter(-0.5f, 0.f), std::nextafter(-0.5f, -1.f),
+                                        8388607.5f, -8388607.5f};
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-40000.f, 40000.f);
+    std::vector<float> input(size);
+    for (size_t i = 0; i < size; i++) {
+        input[i] = i % 3 == 0 ? special[(i / 3) % special.size()] : distribution(generator);
+    }
+    return input;
+}
+
+class GNAQuantizeInputTest : public ::testing::TestWithParam<QuantizeInputParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<QuantizeInputParams>& obj) {
+        uint32_t num_frames, num_group, num_vector_elements, num_vector_stride;
+        bool interleaved, low_precision;
+        std::tie(num_frames, num_group, num_vector_elements, num_vector_stride, interleaved, low_precision) = obj.param;
+        return "frames" + std::to_string(num_frames) + "_group" + std::to_string(num_group) +
+               "_elements" + std::to_string(num_vector_elements) + "_stride" + std::to_string(num_vector_stride) +
+               (interleaved ? "_interleaved" : "_noninterleaved") + (low_precision ? "_I8" : "_I16");
+    }
+
+protected:
+    template <typename T>
+    void Compare(float scale_factor) {
+        uint32_t num_frames, num_group, num_vector_elements, num_vector_stride;
+        bool interleaved, low_precision;
+        std::tie(num_frames, num_group, num_vector_elements, num_vector_stride, interleaved, low_precision) = GetParam();
+
+        const auto src = MakeInput(num_frames * num_vector_elements);
+        // the destination is filled with garbage to check that the padding is written
+        std::vector<T> dst(num_group * num_vector_stride);
+        std::memset(dst.data(), 0x5A, dst.size() * sizeof(T));
+        runtime::XARCH::QuantizeInput(dst.data(), src.data(), num_frames, num_group, num_vector_elements,
+                                      num_vector_stride, interleaved, low_precision, scale_factor);
+
+        const auto expected = Reference<T>(src, num_frames, num_group, num_vector_elements, num_vector_stride,
+                                           interleaved, scale_factor);
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(expected[i], dst[i]) << "at " << i << " with scale factor " << scale_factor;
+        }
+    }
+
+    void Compare(float scale_factor) {
+        if (std::get<5>(GetParam())) {
+            Compare<int8_t>(scale_factor);
+        } else {
+            Compare<int16_t>(scale_factor);
+        }
+    }
+};
+
+TEST_P(GNAQuantizeInputTest, MatchesScalarConversion) {
+    // the unit scale keeps the half-way values, the others produce the products rounded near .5
+    for (const float scale_factor : {1.f, 0.1f, 3.f, 2048.f, 1.f / 3.f}) {
+        Compare(scale_factor);
+    }
+}
+
+// 8x8 blocks with the tails in both dimensions, the partial groups and the padded strides.
+// The non-interleaved orientation also runs the 16 element AVX-512 vectors with the 8 element and scalar tails.
+std::vector<QuantizeInputParams> MakeParams() {
+    const std::vector<std::pair<uint32_t, uint32_t>> frames = {{1, 1}, {3, 8}, {8, 8}, {5, 16}, {16, 16}, {13, 13}};
+    const std::vector<std::pair<uint32_t, uint32_t>> elements = {{8, 8}, {29, 32}, {35, 48}, {64, 64}, {7, 7}};
+    std::vector<QuantizeInputParams> params;
+    for (const auto& frame : frames) {
+        for (const auto& element : elements) {
+            for (const bool interleaved : {true, false}) {
+                for (const bool low_precision : {true, false}) {
+                    params.emplace_back(frame.first, frame.second, element.first, element.second,
+                                        interleaved, low_precision);
+                }
+            }
+        }
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_QuantizeInput, GNAQuantizeInputTest,
+                         ::testing::ValuesIn(MakeParams()),
+                         GNAQuantizeInputTest::getTestCaseName);
+
+}  // namespace
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 #include "runtime/pwl.h"
 #include "common_test_utils/data_utils.hpp"
@@ -103,4 +105,26 @@ TEST_F(PwlTest, neghalflog) {
     EXPECT_FALSE(GetPwl(DnnActivation::fromType(kActNegHalfLog), 1e-10, LOG_DOMAIN, 0, pwl));
 }
 
+TEST_F(PwlTest, designReusesSearchForDifferentScales) {
+    auto segmentsEqual = [](const std::vector<gna_pwl_segment_t>& a, const std::vector<gna_pwl_segment_t>& b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(),
+            [](const gna_pwl_segment_t& x, const gna_pwl_segment_t& y) {
+                return x.xBase == y.xBase && x.yBase == y.yBase && x.slope == y.slope;
+            });
+    };
+    const auto sigmoid = DnnActivation::fromType(kActSigmoid);
+
+    PwlSearchCacheClear();
+    std::vector<gna_pwl_segment_t> designed, reused, redesigned;
+    PwlDesignOpt(sigmoid, designed, 2048.0f, 16384.0f, PWL_MAX_ERR_PERCENT, false);
+    ASSERT_EQ(PwlSearchCacheSize(), 1);
+    PwlDesignOpt(sigmoid, reused, 1024.0f, 16384.0f, PWL_MAX_ERR_PERCENT, false);
+    ASSERT_EQ(PwlSearchCacheSize(), 1);
+
+    PwlSearchCacheClear();
+    PwlDesignOpt(sigmoid, redesigned, 1024.0f, 16384.0f, PWL_MAX_ERR_PERCENT, false);
+    EXPECT_TRUE(segmentsEqual(reused, redesigned));
+    EXPECT_FALSE(segmentsEqual(designed, reused));
+}
+
 } // namespace
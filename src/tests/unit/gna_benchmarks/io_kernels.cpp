@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "ie_system_conf.h"
+#include "gna_tensor_tools.hpp"
+#include "preprocessing.hpp"
+#include "runtime/quantize_input.hpp"
+
+using namespace GNAPluginNS;
+
+namespace {
+
+// Frames are grouped by 8 at most, the vector sizes are typical for the speech models
+const std::vector<uint32_t> frameCounts = {1, 4, 8};
+const std::vector<uint32_t> vectorSizes = {256, 440, 1024, 4096};
+constexpr uint32_t groupSize = 8;
+
+std::string isaLabel() {
+    if (InferenceEngine::with_cpu_x86_avx512f())
+        return "AVX512F";
+    if (InferenceEngine::with_cpu_x86_avx2())
+        return "AVX2";
+    return "ANY";
+}
+
+std::string caseName(const std::string& kernel, const std::string& precision, bool interleaved,
+                     uint32_t frames, uint32_t elements) {
+    return kernel + "/" + precision + (interleaved ? "/interleaved/" : "/deinterleaved/") +
+           std::to_string(frames) + "x" + std::to_string(elements);
+}
+
+// Element by element conversion which GNAPlugin::copyInputData used before the vectorized kernels
+template <typename T>
+void scalarQuantizeInput(T* dst, const float* src, uint32_t num_frames, uint32_t num_group,
+                         uint32_t num_vector_elements, uint32_t num_vector_stride, bool interleaved, float scaleFactor) {
+    const auto convert = [](float value) -> T {
+        return sizeof(T) == 2 ? ConvertFloatToInt16(value) : ConvertFloatToInt8(value);
+    };
+    if (interleaved) {
+        for (uint32_t i = 0; i < num_frames; i++) {
+            for (uint32_t j = 0; j < num_vector_elements; j++) {
+                dst[j * num_group + i] = convert(src[i * num_vector_elements + j] * scaleFactor);
+            }
+            for (uint32_t j = num_vector_elements; j < num_vector_stride; j++) {
+                dst[j * num_group + i] = 0;
+            }
+        }
+        for (uint32_t i = num_frames; i < num_group; i++) {
+            for (uint32_t j = 0; j < num_vector_stride; j++) {
+                dst[j * num_group + i] = 0;
+            }
+        }
+    } else {
+        for (uint32_t i = 0; i < num_frames; i++) {
+            T* ptr_dst_vec = dst + i * num_vector_stride;
+            std::memset(ptr_dst_vec, 0, num_vector_stride * sizeof(T));
+            for (uint32_t j = 0; j < num_vector_elements; j++) {
+                ptr_dst_vec[j] = convert(src[i * num_vector_elements + j] * scaleFactor);
+            }
+        }
+        std::memset(dst + num_frames * num_vector_stride, 0, (num_group - num_frames) * num_vector_stride * sizeof(T));
+    }
+}
+
+// Copy which GNAPlugin::ExportScores used before: the precision of the scores was checked for every element
+void scalarTransposeScores(int32_t* dst, const int8_t* src, uint32_t num_frames, uint32_t num_group,
+                           uint32_t num_vector_elements, uint32_t num_bytes_per_element_input) {
+    for (uint32_t i = 0; i < num_frames; i++) {
+        for (uint32_t j = 0; j < num_vector_elements; j++) {
+            auto input_ptr = src + (j * num_group + i) * num_bytes_per_element_input;
+            auto dst_ptr = dst + (i * num_vector_elements + j);
+            switch (num_bytes_per_element_input) {
+                case 1:
+                    *dst_ptr = static_cast<int32_t>(*reinterpret_cast<const int8_t*>(input_ptr));
+                    break;
+                case 2:
+                    *dst_ptr = static_cast<int32_t>(*reinterpret_cast<const int16_t*>(input_ptr));
+                    break;
+                default:
+                    *dst_ptr = *reinterpret_cast<const int32_t*>(input_ptr);
+                    break;
+            }
+        }
+    }
+}
+
+std::vector<float> randomFrames(size_t size) {
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(-4.0f, 4.0f);
+    std::vector<float> frames(size);
+    for (auto& value : frames) {
+        value = distribution(generator);
+    }
+    return frames;
+}
+
+template <typename T>
+void quantizeInput(benchmark::State& state, bool vectorized, bool interleaved, uint32_t frames, uint32_t elements) {
+    // rows of the weight matrix are aligned to 8 elements
+    const uint32_t stride = (elements + 7) / 8 * 8;
+    const bool lowPrecision = sizeof(T) == 1;
+    const float scaleFactor = lowPrecision ? 16.0f : 2048.0f;
+    const auto src = randomFrames(frames * elements);
+    std::vector<T> dst(groupSize * stride);
+
+    for (auto _ : state) {
+        if (vectorized) {
+            runtime::XARCH::QuantizeInput(dst.data(), src.data(), frames, groupSize, elements, stride, interleaved,
+                                          lowPrecision, scaleFactor);
+        } else {
+            scalarQuantizeInput(dst.data(), src.data(), frames, groupSize, elements, stride, interleaved, scaleFactor);
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+
+    const auto bytes = static_cast<double>(src.size() * sizeof(float) + dst.size() * sizeof(T));
+    state.counters["GB/s"] = benchmark::Counter(state.iterations() * bytes * 1e-9, benchmark::Counter::kIsRate);
+    state.SetLabel(vectorized ? isaLabel() : "scalar");
+}
+
+template <typename TSrc>
+void transposeScores(benchmark::State& state, bool typed, uint32_t frames, uint32_t elements) {
+    const std::vector<TSrc> src(groupSize * elements, 1);
+    std::vector<int32_t> dst(frames * elements);
+
+    for (auto _ : state) {
+        if (typed) {
+            TransposeScores(dst.data(), src.data(), frames, groupSize, elements, elements);
+        } else {
+            scalarTransposeScores(dst.data(), reinterpret_cast<const int8_t*>(src.data()), frames, groupSize, elements,
+                                  sizeof(TSrc));
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+
+    const auto bytes = static_cast<double>(frames * elements * (sizeof(TSrc) + sizeof(int32_t)));
+    state.counters["GB/s"] = benchmark::Counter(state.iterations() * bytes * 1e-9, benchmark::Counter::kIsRate);
+    state.SetLabel(typed ? "typed" : "scalar");
+}
+
+bool registerBenchmarks() {
+    for (const auto frames : frameCounts) {
+        for (const auto elements : vectorSizes) {
+            for (const bool interleaved : {true, false}) {
+                for (const bool vectorized : {true, false}) {
+                    const std::string kernel = vectorized ? "QuantizeInput" : "QuantizeInputScalar";
+                    benchmark::RegisterBenchmark(caseName(kernel, "I16", interleaved, frames, elements).c_str(),
+                                                 quantizeInput<int16_t>, vectorized, interleaved, frames, elements);
+                    benchmark::RegisterBenchmark(caseName(kernel, "I8", interleaved, frames, elements).c_str(),
+                                                 quantizeInput<int8_t>, vectorized, interleaved, frames, elements);
+                }
+            }
+            // scores are exported to the 32-bit output
+            for (const bool typed : {true, false}) {
+                const std::string kernel = typed ? "TransposeScores" : "TransposeScoresScalar";
+                benchmark::RegisterBenchmark(caseName(kernel, "I16", true, frames, elements).c_str(),
+                                             transposeScores<int16_t>, typed, frames, elements);
+                benchmark::RegisterBenchmark(caseName(kernel, "I32", true, frames, elements).c_str(),
+                                             transposeScores<int32_t>, typed, frames, elements);
+            }
+        }
+    }
+    return true;
+}
+
+const bool registered = registerBenchmarks();
+
+}  // namespace
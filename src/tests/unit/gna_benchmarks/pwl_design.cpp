@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "runtime/pwl.h"
+
+namespace {
+
+DnnActivation makePow(float exponent) {
+    auto activation = DnnActivation::fromType(kActPow);
+    activation.args.pow = {exponent, 1.0f, 0.0f};
+    return activation;
+}
+
+// Activations which GNAGraphCompiler designs for a network at the load, the input scale factors
+// differ between the layers, since they come from the statistics of the layer inputs
+struct DesignCase {
+    std::string name;
+    std::vector<DnnActivation> activations;
+    std::vector<float> inputScales;
+};
+
+std::vector<DesignCase> designCases() {
+    std::vector<DnnActivation> lstmCell = {
+        DnnActivation::fromType(kActSigmoid),  // input gate
+        DnnActivation::fromType(kActSigmoid),  // forget gate
+        DnnActivation::fromType(kActSigmoid),  // output gate
+        DnnActivation::fromType(kActTanh),     // cell candidate
+        DnnActivation::fromType(kActTanh),     // cell output
+    };
+    std::vector<DnnActivation> lstmNetwork;
+    for (int layer = 0; layer < 12; layer++) {
+        lstmNetwork.insert(lstmNetwork.end(), lstmCell.begin(), lstmCell.end());
+    }
+    return {
+        {"LSTMx12", lstmNetwork, {2048.0f, 1024.0f, 512.0f}},
+        {"Exp", {DnnActivation::fromType(kActExp)}, {2048.0f}},
+        {"Log", {DnnActivation::fromType(kActLog)}, {2048.0f}},
+        {"Pow", {makePow(2.0f), makePow(0.5f)}, {2048.0f}},
+    };
+}
+
+// The cold case empties the memoized searches before every network, so only the layers of one network share them
+void designNetwork(benchmark::State& state, const DesignCase& designCase, bool cached) {
+    std::vector<gna_pwl_segment_t> segments;
+    PwlSearchCacheClear();
+    for (auto _ : state) {
+        if (!cached) {
+            PwlSearchCacheClear();
+        }
+        for (size_t i = 0; i < designCase.activations.size(); i++) {
+            const auto scale = designCase.inputScales[i % designCase.inputScales.size()];
+            PwlDesignOpt(designCase.activations[i], segments, scale, 16384.0f, PWL_MAX_ERR_PERCENT, false);
+            benchmark::DoNotOptimize(segments.data());
+        }
+    }
+    state.counters["activations/s"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * designCase.activations.size()), benchmark::Counter::kIsRate);
+    state.counters["cached"] = static_cast<double>(PwlSearchCacheSize());
+}
+
+bool registerBenchmarks() {
+    for (const auto& designCase : designCases()) {
+        benchmark::RegisterBenchmark(("PwlDesign/" + designCase.name + "/cold").c_str(),
+                                     designNetwork, designCase, false)->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark(("PwlDesign/" + designCase.name + "/warm").c_str(),
+                                     designNetwork, designCase, true)->Unit(benchmark::kMicrosecond);
+    }
+    return true;
+}
+
+const bool registered = registerBenchmarks();
+
+}  // namespace
@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <gtest/gtest.h>
+
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <threading/ie_immediate_executor.hpp>
+
+using namespace InferenceEngine;
+
+// The global allocation functions count the allocations while the counting is enabled by the test
+namespace {
+std::atomic<bool> countAllocations{false};
+std::atomic<size_t> allocations{0};
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (countAllocations) {
+        ++allocations;
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+struct AllocationCounter {
+    AllocationCounter() {
+        allocations = 0;
+        countAllocations = true;
+    }
+    ~AllocationCounter() {
+        countAllocations = false;
+    }
+    size_t count() const {
+        return allocations;
+    }
+};
+
+struct EmptyInferRequest : public IInferRequestInternal {
+    EmptyInferRequest() : IInferRequestInternal(InputsDataMap{}, OutputsDataMap{}) {}
+    void InferImpl() override {
+        ++inferences;
+    }
+    void checkBlobs() override {}
+    size_t inferences = 0;
+};
+
+struct MultiStageInferRequest : public AsyncInferRequestThreadSafeDefault {
+    MultiStageInferRequest(const IInferRequestInternal::Ptr& request, const ITaskExecutor::Ptr& executor)
+        : AsyncInferRequestThreadSafeDefault(request, executor, executor) {
+        _pipeline.push_back({executor, [this] {
+                                 ++postprocessed;
+                             }});
+    }
+    ~MultiStageInferRequest() {
+        StopAndWait();
+    }
+    size_t postprocessed = 0;
+};
+
+constexpr size_t warmupInferences = 10;
+constexpr size_t inferences = 1000;
+
+}  // namespace
+
+TEST(InferRequestThreadSafeDefaultAllocationsTests, startAsyncDoesNotAllocateInSteadyState) {
+    auto syncRequest = std::make_shared<EmptyInferRequest>();
+    auto executor = std::make_shared<ImmediateExecutor>();
+    MultiStageInferRequest request{syncRequest, executor};
+    size_t callbacks = 0;
+    request.SetCallback([&](std::exception_ptr) {
+        ++callbacks;
+    });
+    for (size_t i = 0; i < warmupInferences; i++) {
+        request.StartAsync();
+        request.Wait(InferRequest::WaitMode::RESULT_READY);
+    }
+
+    size_t allocated = 0;
+    {
+        AllocationCounter counter;
+        for (size_t i = 0; i < inferences; i++) {
+            request.StartAsync();
+            request.Wait(InferRequest::WaitMode::RESULT_READY);
+        }
+        allocated = counter.count();
+    }
+
+    ASSERT_EQ(0, allocated);
+    ASSERT_EQ(warmupInferences + inferences, syncRequest->inferences);
+    ASSERT_EQ(warmupInferences + inferences, request.postprocessed);
+    ASSERT_EQ(warmupInferences + inferences, callbacks);
+}
+
+TEST(InferRequestThreadSafeDefaultAllocationsTests, inferDoesNotAllocateInSteadyState) {
+    auto syncRequest = std::make_shared<EmptyInferRequest>();
+    MultiStageInferRequest request{syncRequest, std::make_shared<ImmediateExecutor>()};
+    for (size_t i = 0; i < warmupInferences; i++) {
+        request.Infer();
+    }
+
+    size_t allocated = 0;
+    {
+        AllocationCounter counter;
+        for (size_t i = 0; i < inferences; i++) {
+            request.Infer();
+        }
+        allocated = counter.count();
+    }
+
+    ASSERT_EQ(0, allocated);
+    ASSERT_EQ(warmupInferences + inferences, syncRequest->inferences);
+}
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <deque>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -47,6 +49,12 @@ struct DeferedExecutor : public ITaskExecutor {
     std::deque<Task> tasks;
 };
 
+struct ThreadPerTaskExecutor : public ITaskExecutor {
+    void run(Task task) override {
+        std::thread(std::move(task)).detach();
+    }
+};
+
 class InferRequestThreadSafeDefaultTests : public ::testing::Test {
 protected:
     shared_ptr<AsyncInferRequestThreadSafeDefault> testRequest;
@@ -194,3 +202,76 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, callbackIsCalledForRequestRestartedByCallback) {
+    // the restarted pipeline ends inside of the running callback, as the stages are run immediately
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal,
+                                                                  std::make_shared<ImmediateExecutor>(),
+                                                                  nullptr);
+    std::vector<std::exception_ptr> exceptions;
+    size_t running = 0;
+    testRequest->SetCallback([&](std::exception_ptr exceptionPtr) {
+        ASSERT_EQ(0, running++);
+        exceptions.push_back(exceptionPtr);
+        if (exceptions.size() < 3) {
+            testRequest->StartAsync();
+        }
+        running--;
+    });
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(3)
+            .WillOnce(Return())
+            .WillOnce(Throw(std::exception()))
+            .WillOnce(Return());
+    testRequest->StartAsync();
+    ASSERT_EQ(3, exceptions.size());
+    ASSERT_EQ(nullptr, exceptions[0]);
+    ASSERT_NE(nullptr, exceptions[1]);
+    ASSERT_EQ(nullptr, exceptions[2]);
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, inferInsideOfCallbackDoesNotCallCallback) {
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal,
+                                                                  std::make_shared<ImmediateExecutor>(),
+                                                                  nullptr);
+    size_t callbacks = 0;
+    testRequest->SetCallback([&](std::exception_ptr) {
+        if (callbacks++ == 0) {
+            testRequest->Infer();
+        }
+    });
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(3);
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(1, callbacks);
+    // the callback is returned to the request
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(2, callbacks);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canDestroyRequestRestartedByCallback) {
+    // the restarted pipeline ends while the callback sleeps, so its completion is deferred
+    auto taskExecutor = std::make_shared<ThreadPerTaskExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillRepeatedly(Return());
+    auto request = testRequest.get();
+    std::atomic<bool> destroyed{false};
+    std::atomic<size_t> callbacks{0};
+    testRequest->SetCallback([&, request](std::exception_ptr) {
+        ASSERT_FALSE(destroyed);
+        ++callbacks;
+        request->StartAsync();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+    testRequest->StartAsync();
+    while (callbacks < 3) {
+        std::this_thread::yield();
+    }
+    // the stopped request neither calls the callback nor starts the pipeline restarted by it
+    testRequest = {};
+    destroyed = true;
+    const size_t callbacksBeforeDestruction = callbacks;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_EQ(callbacksBeforeDestruction, callbacks);
+}
@@ -0,0 +1,169 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "ie_cache_manager.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std::chrono;
+
+class FileStorageCacheManagerTests : public Test {
+public:
+    std::string m_cacheDir;
+
+    void SetUp() override {
+        // Generate unique directory name based on test name, thread id and timestamp
+        auto testInfo = UnitTest::GetInstance()->current_test_info();
+        std::stringstream ss;
+        ss << std::hash<std::string>()(std::string(testInfo->test_case_name()) + testInfo->name()) << "_"
+           << std::this_thread::get_id() << "_"
+           << duration_cast<microseconds>(high_resolution_clock::now().time_since_epoch()).count();
+        m_cacheDir = ss.str();
+        CommonTestUtils::createDirectory(m_cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "index");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "tmp");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+
+    std::shared_ptr<ICacheManager> createManager(uint64_t maxSize = 0) const {
+        return std::make_shared<FileStorageCacheManager>(std::string(m_cacheDir), maxSize);
+    }
+
+    std::string blobFile(const std::string& id) const {
+        return m_cacheDir + "/" + id + ".blob";
+    }
+
+    static void write(ICacheManager& manager, const std::string& id, size_t size) {
+        manager.writeCacheEntry(id, [&](std::ostream& stream) {
+            stream << std::string(size, 'a');
+        });
+    }
+
+    static bool read(ICacheManager& manager, const std::string& id) {
+        bool found = false;
+        manager.readCacheEntry(id, [&](std::istream&) {
+            found = true;
+        });
+        return found;
+    }
+
+    size_t filesCount(const std::string& ext) const {
+        return CommonTestUtils::listFilesWithExt(m_cacheDir, ext).size();
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, WriteRead) {
+    auto manager = createManager();
+    write(*manager, "net", 10);
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("net")));
+    ASSERT_EQ(filesCount("tmp"), 0);
+
+    std::string content;
+    manager->readCacheEntry("net", [&](std::istream& stream) {
+        stream >> content;
+    });
+    ASSERT_EQ(content, std::string(10, 'a'));
+    ASSERT_FALSE(read(*manager, "unknown"));
+
+    manager->removeCacheEntry("net");
+    ASSERT_FALSE(CommonTestUtils::fileExists(blobFile("net")));
+}
+
+TEST_F(FileStorageCacheManagerTests, FailedWriteKeepsPreviousBlob) {
+    auto manager = createManager();
+    write(*manager, "net", 10);
+
+    // the partially written blob must not be observable by readers
+    ASSERT_THROW(manager->writeCacheEntry("net", [](std::ostream& stream) {
+        stream << "partial";
+        throw std::runtime_error("export failed");
+    }), std::runtime_error);
+    ASSERT_EQ(filesCount("tmp"), 0);
+
+    std::string content;
+    manager->readCacheEntry("net", [&](std::istream& stream) {
+        stream >> content;
+    });
+    ASSERT_EQ(content, std::string(10, 'a'));
+}
+
+TEST_F(FileStorageCacheManagerTests, NoIndexWithoutSizeLimit) {
+    auto manager = createManager();
+    write(*manager, "net", 10);
+    ASSERT_EQ(filesCount("index"), 0);
+}
+
+TEST_F(FileStorageCacheManagerTests, EvictLeastRecentlyUsed) {
+    auto manager = createManager(250);
+    write(*manager, "net1", 100);
+    std::this_thread::sleep_for(milliseconds(5));
+    write(*manager, "net2", 100);
+    std::this_thread::sleep_for(milliseconds(5));
+    // reading makes net1 the most recently used
+    ASSERT_TRUE(read(*manager, "net1"));
+    std::this_thread::sleep_for(milliseconds(5));
+    write(*manager, "net3", 100);
+
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("net1")));
+    ASSERT_FALSE(CommonTestUtils::fileExists(blobFile("net2")));
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("net3")));
+    ASSERT_EQ(filesCount("index"), 1);
+}
+
+TEST_F(FileStorageCacheManagerTests, JustWrittenBlobIsNotEvicted) {
+    auto manager = createManager(10);
+    write(*manager, "net1", 100);
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("net1")));
+
+    std::this_thread::sleep_for(milliseconds(5));
+    write(*manager, "net2", 100);
+    ASSERT_FALSE(CommonTestUtils::fileExists(blobFile("net1")));
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("net2")));
+}
+
+TEST_F(FileStorageCacheManagerTests, IndexIsSharedBetweenManagers) {
+    write(*createManager(250), "net1", 100);
+    std::this_thread::sleep_for(milliseconds(5));
+    write(*createManager(250), "net2", 100);
+    std::this_thread::sleep_for(milliseconds(5));
+    write(*createManager(250), "net3", 100);
+
+    ASSERT_FALSE(CommonTestUtils::fileExists(blobFile("net1")));
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("net2")));
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("net3")));
+
+    // the limit is applied to the existing entries on creation
+    createManager(150);
+    ASSERT_FALSE(CommonTestUtils::fileExists(blobFile("net2")));
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("net3")));
+}
+
+TEST_F(FileStorageCacheManagerTests, UnindexedBlobsAreEvictedFirst) {
+    // blobs cached without the size limit aren't indexed
+    write(*createManager(), "old", 100);
+    auto manager = createManager(250);
+    std::this_thread::sleep_for(milliseconds(5));
+    write(*manager, "net1", 100);
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("old")));
+
+    std::this_thread::sleep_for(milliseconds(5));
+    write(*manager, "net2", 100);
+    ASSERT_FALSE(CommonTestUtils::fileExists(blobFile("old")));
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("net1")));
+    ASSERT_TRUE(CommonTestUtils::fileExists(blobFile("net2")));
+}
@@ -0,0 +1,287 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "itt_collector.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace openvino::itt::internal;
+using namespace ::testing;
+
+namespace {
+
+// Node of the flame graph report
+struct ReportNode {
+    std::string name;
+    double value = -1;
+    double start = -1;
+    std::vector<ReportNode> children;
+};
+
+// Parser of the report format: objects with "name", "value", "start" and "children" fields
+class ReportParser {
+public:
+    explicit ReportParser(std::string text) : text(std::move(text)) {}
+
+    ReportNode parse() {
+        auto node = parseNode();
+        skipSpaces();
+        EXPECT_EQ(pos, text.size()) << "Unexpected data after the root node";
+        return node;
+    }
+
+private:
+    void skipSpaces() {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+            ++pos;
+    }
+
+    void expect(char c) {
+        skipSpaces();
+        if (pos >= text.size() || text[pos] != c)
+            throw std::runtime_error(std::string("Expected '") + c + "' at " + std::to_string(pos));
+        ++pos;
+    }
+
+    bool accept(char c) {
+        skipSpaces();
+        if (pos < text.size() && text[pos] == c) {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    std::string parseString() {
+        expect('"');
+        std::string result;
+        while (pos < text.size() && text[pos] != '"') {
+            if (text[pos] == '\\') {
+                ++pos;
+                if (text[pos] == 'u') {
+                    result += static_cast<char>(std::stoi(text.substr(pos + 1, 4), nullptr, 16));
+                    pos += 4;
+                } else {
+                    result += text[pos];
+                }
+            } else {
+                result += text[pos];
+            }
+            ++pos;
+        }
+        expect('"');
+        return result;
+    }
+
+    double parseNumber() {
+        skipSpaces();
+        size_t length = 0;
+        const auto value = std::stod(text.substr(pos), &length);
+        pos += length;
+        return value;
+    }
+
+    ReportNode parseNode() {
+        ReportNode node;
+        expect('{');
+        do {
+            const auto key = parseString();
+            expect(':');
+            if (key == "name") {
+                node.name = parseString();
+            } else if (key == "value") {
+                node.value = parseNumber();
+            } else if (key == "start") {
+                node.start = parseNumber();
+            } else if (key == "children") {
+                expect('[');
+                if (!accept(']')) {
+                    do {
+                        node.children.push_back(parseNode());
+                    } while (accept(','));
+                    expect(']');
+                }
+            } else {
+                throw std::runtime_error("Unexpected key " + key);
+            }
+        } while (accept(','));
+        expect('}');
+        return node;
+    }
+
+    std::string text;
+    size_t pos = 0;
+};
+
+}  // namespace
+
+class ITTCollectorTests : public Test {
+public:
+    std::string reportPath;
+
+    void SetUp() override {
+        auto testInfo = UnitTest::GetInstance()->current_test_info();
+        reportPath = std::string("itt_collector_") + testInfo->name() + ".json";
+    }
+
+    void TearDown() override {
+        std::remove(reportPath.c_str());
+    }
+
+    ReportNode readReport() const {
+        std::ifstream stream(reportPath);
+        std::stringstream buffer;
+        buffer << stream.rdbuf();
+        return ReportParser(buffer.str()).parse();
+    }
+
+    static void task(Collector& collector, const char* name, const std::function<void()>& body = {}) {
+        collector.taskBegin(collector.name(name));
+        if (body)
+            body();
+        collector.taskEnd();
+    }
+};
+
+TEST_F(ITTCollectorTests, NestedTasks) {
+    Collector collector(reportPath);
+    task(collector, "read_model");
+    task(collector, "compile_model", [&]() {
+        task(collector, "transformations", [&]() {
+            task(collector, "pass_1");
+            task(collector, "pass_2");
+        });
+        task(collector, "init_graph");
+    });
+    collector.write();
+
+    ReportNode report;
+    ASSERT_NO_THROW(report = readReport());
+    EXPECT_EQ(report.name, "first_inference");
+    EXPECT_EQ(report.start, 0);
+    ASSERT_EQ(report.children.size(), 1);
+
+    const auto& thread = report.children[0];
+    EXPECT_EQ(thread.name, "thread_0");
+    ASSERT_EQ(thread.children.size(), 2);
+    EXPECT_EQ(thread.children[0].name, "read_model");
+    EXPECT_TRUE(thread.children[0].children.empty());
+
+    const auto& compile = thread.children[1];
+    EXPECT_EQ(compile.name, "compile_model");
+    ASSERT_EQ(compile.children.size(), 2);
+    EXPECT_EQ(compile.children[0].name, "transformations");
+    EXPECT_EQ(compile.children[1].name, "init_graph");
+    ASSERT_EQ(compile.children[0].children.size(), 2);
+    EXPECT_EQ(compile.children[0].children[0].name, "pass_1");
+    EXPECT_EQ(compile.children[0].children[1].name, "pass_2");
+
+    // Children are inside of their parents
+    for (const auto& child : compile.children) {
+        EXPECT_GE(child.start, compile.start);
+        EXPECT_LE(child.start + child.value, compile.start + compile.value + 0.001);
+    }
+    EXPECT_GE(report.value, compile.start + compile.value - 0.001);
+}
+
+TEST_F(ITTCollectorTests, TasksOfThreadsAreSeparated) {
+    Collector collector(reportPath);
+    task(collector, "main", [&]() {
+        std::thread worker([&]() {
+            task(collector, "worker");
+        });
+        worker.join();
+    });
+    collector.write();
+
+    ReportNode report;
+    ASSERT_NO_THROW(report = readReport());
+    ASSERT_EQ(report.children.size(), 2);
+    ASSERT_EQ(report.children[0].children.size(), 1);
+    EXPECT_EQ(report.children[0].children[0].name, "main");
+    EXPECT_TRUE(report.children[0].children[0].children.empty());
+    ASSERT_EQ(report.children[1].children.size(), 1);
+    EXPECT_EQ(report.children[1].children[0].name, "worker");
+}
+
+TEST_F(ITTCollectorTests, LimitKeepsParents) {
+    Collector collector(reportPath, 3);
+    task(collector, "root", [&]() {
+        task(collector, "child_1", [&]() {
+            task(collector, "grandchild_1");
+            task(collector, "grandchild_2");
+        });
+        task(collector, "child_2");
+    });
+    collector.write();
+
+    ReportNode report;
+    ASSERT_NO_THROW(report = readReport());
+    ASSERT_EQ(report.children.size(), 1);
+    ASSERT_EQ(report.children[0].children.size(), 1);
+    const auto& root = report.children[0].children[0];
+    EXPECT_EQ(root.name, "root");
+    ASSERT_EQ(root.children.size(), 1);
+    EXPECT_EQ(root.children[0].name, "child_1");
+    ASSERT_EQ(root.children[0].children.size(), 1);
+    EXPECT_EQ(root.children[0].children[0].name, "grandchild_1");
+}
+
+TEST_F(ITTCollectorTests, NotEndedTaskEndsAtWrite) {
+    Collector collector(reportPath);
+    collector.taskBegin(collector.name("infer"));
+    task(collector, "node");
+    collector.write();
+    collector.taskEnd();
+
+    ReportNode report;
+    ASSERT_NO_THROW(report = readReport());
+    ASSERT_EQ(report.children.size(), 1);
+    ASSERT_EQ(report.children[0].children.size(), 1);
+    const auto& infer = report.children[0].children[0];
+    EXPECT_EQ(infer.name, "infer");
+    ASSERT_EQ(infer.children.size(), 1);
+    EXPECT_EQ(infer.children[0].name, "node");
+    EXPECT_GE(infer.value, infer.children[0].value);
+}
+
+TEST_F(ITTCollectorTests, NamesAreEscaped) {
+    Collector collector(reportPath);
+    const std::string name = "node \"conv\\1\"\n";
+    task(collector, name.c_str());
+    collector.write();
+
+    ReportNode report;
+    ASSERT_NO_THROW(report = readReport());
+    ASSERT_EQ(report.children.size(), 1);
+    ASSERT_EQ(report.children[0].children.size(), 1);
+    EXPECT_EQ(report.children[0].children[0].name, name);
+}
+
+TEST_F(ITTCollectorTests, NamesAreStored) {
+    Collector collector(reportPath);
+    std::string name = "pass";
+    const auto stored = collector.name(name.c_str());
+    name = "changed";
+    EXPECT_STREQ(stored, "pass");
+    EXPECT_EQ(stored, collector.name("pass"));
+}
+
+TEST_F(ITTCollectorTests, NoReportWithoutTasks) {
+    Collector collector(reportPath);
+    collector.taskEnd();
+    collector.write();
+    EXPECT_FALSE(CommonTestUtils::fileExists(reportPath));
+}
@@ -46,6 +46,12 @@ static const char data_shapes_message[] =
 static const char statistics_path_message[] =
     "Required. Path to a file to write statistics.";
 
+/// @brief message for first inference report argument
+static const char report_first_inference_message[] =
+    "Not required. Path to a flame graph JSON file to write the first inference latency breakdown: model reading, \n"
+    "transformations, graph initialization, weights reordering and the first inference. \n"
+    "Requires OpenVINO built with ENABLE_FIRST_INFERENCE_REPORT.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -76,6 +82,10 @@ DEFINE_bool(c, false, model_cache_message);
 /// It is a required parameter
 DEFINE_string(s, "", statistics_path_message);
 
+/// @brief Define parameter for set path to a file to write the first inference report <br>
+/// It is a non-required parameter
+DEFINE_string(report_first_inference, "", report_first_inference_message);
+
 /**
  * @brief This function show a help message
  */
@@ -91,4 +101,5 @@ static void showUsage() {
   std::cout << "    -c                   " << model_cache_message << std::endl;
   std::cout << "    -reshape_shapes      " << reshape_shapes_message << std::endl;
   std::cout << "    -data_shapes         " << data_shapes_message << std::endl;
+  std::cout << "    -report_first_inference \"<path>\" " << report_first_inference_message << std::endl;
 }
\ No newline at end of file
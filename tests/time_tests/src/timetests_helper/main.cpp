@@ -7,6 +7,7 @@
 #include "reshape_utils.h"
 #include "timetests_helper/timer.h"
 
+#include <cstdlib>
 #include <iostream>
 
 
@@ -59,6 +60,15 @@ int main(int argc, char **argv) {
   if (!parseAndCheckCommandLine(argc, argv))
     return -1;
 
+  // The report is collected by OpenVINO itself, so it has to be requested before the pipeline is started
+  if (!FLAGS_report_first_inference.empty()) {
+#ifdef _WIN32
+    _putenv_s("OV_FIRST_INFERENCE_REPORT", FLAGS_report_first_inference.c_str());
+#else
+    setenv("OV_FIRST_INFERENCE_REPORT", FLAGS_report_first_inference.c_str(), 1);
+#endif
+  }
+
   auto dynamicShapes = parseReshapeShapes(FLAGS_reshape_shapes);
   auto staticShapes = parseDataShapes(FLAGS_data_shapes);
 